@@ -15,6 +15,7 @@
 #include "amd_family.h"
 #include "sid.h"
 #include "util/hash_table.h"
+#include "util/list.h"
 #include "util/macros.h"
 #include "util/simple_mtx.h"
 #include "util/u_atomic.h"
@@ -71,9 +72,33 @@
 #define CIASICIDGFXENGINE_ARCTICISLAND 0x0000000D
 #endif
 
+/* Number of surface layouts remembered by ac_compute_surface. */
+#define AC_SURFACE_CACHE_SIZE 64
+
+struct ac_surface_cache_key {
+   const struct radeon_info *info;
+   struct ac_surf_info surf_info;
+   uint8_t is_1d, is_3d, is_cube, is_array;
+   enum radeon_surf_mode mode;
+   /* The surface as passed in, because callers can pre-set some layout fields. */
+   struct radeon_surf surf;
+};
+
+struct ac_surface_cache_entry {
+   struct ac_surface_cache_key key;
+   struct radeon_surf surf;
+   struct list_head link;
+};
+
 struct ac_addrlib {
    ADDR_HANDLE handle;
    simple_mtx_t lock;
+
+   /* LRU cache of computed surface layouts, the most recently used entry first. */
+   simple_mtx_t cache_lock;
+   struct hash_table *cache;
+   struct list_head cache_lru;
+   unsigned cache_size;
 };
 
 unsigned ac_pipe_config_to_num_pipes(unsigned pipe_config)
@@ -499,6 +524,16 @@ static ADDR_E_RETURNCODE ADDR_API freeSysMem(const ADDR_FREESYSMEM_INPUT *pInput
    return ADDR_OK;
 }
 
+static uint32_t ac_surface_cache_hash(const void *key)
+{
+   return _mesa_hash_data(key, sizeof(struct ac_surface_cache_key));
+}
+
+static bool ac_surface_cache_equals(const void *a, const void *b)
+{
+   return memcmp(a, b, sizeof(struct ac_surface_cache_key)) == 0;
+}
+
 struct ac_addrlib *ac_addrlib_create(const struct radeon_info *info,
                                      uint64_t *max_alignment)
 {
@@ -569,11 +604,18 @@ struct ac_addrlib *ac_addrlib_create(const struct radeon_info *info,
 
    addrlib->handle = addrCreateOutput.hLib;
    simple_mtx_init(&addrlib->lock, mtx_plain);
+   simple_mtx_init(&addrlib->cache_lock, mtx_plain);
+   addrlib->cache = _mesa_hash_table_create(NULL, ac_surface_cache_hash, ac_surface_cache_equals);
+   list_inithead(&addrlib->cache_lru);
    return addrlib;
 }
 
 void ac_addrlib_destroy(struct ac_addrlib *addrlib)
 {
+   list_for_each_entry_safe(struct ac_surface_cache_entry, entry, &addrlib->cache_lru, link)
+      free(entry);
+   _mesa_hash_table_destroy(addrlib->cache, NULL);
+   simple_mtx_destroy(&addrlib->cache_lock);
    simple_mtx_destroy(&addrlib->lock);
    AddrDestroy(addrlib->handle);
    free(addrlib);
@@ -2512,16 +2554,12 @@ static int gfx9_compute_surface(struct ac_addrlib *addrlib, const struct radeon_
    return 0;
 }
 
-int ac_compute_surface(struct ac_addrlib *addrlib, const struct radeon_info *info,
-                       const struct ac_surf_config *config, enum radeon_surf_mode mode,
-                       struct radeon_surf *surf)
+static int ac_compute_surface_uncached(struct ac_addrlib *addrlib, const struct radeon_info *info,
+                                       const struct ac_surf_config *config,
+                                       enum radeon_surf_mode mode, struct radeon_surf *surf)
 {
    int r;
 
-   r = surf_config_sanity(config, surf->flags);
-   if (r)
-      return r;
-
    /* Images are emulated on some CDNA chips. */
    if (!info->has_image_opcodes)
       mode = RADEON_SURF_MODE_LINEAR_ALIGNED;
@@ -2580,6 +2618,88 @@ int ac_compute_surface(struct ac_addrlib *addrlib, const struct radeon_info *inf
    return 0;
 }
 
+int ac_compute_surface(struct ac_addrlib *addrlib, const struct radeon_info *info,
+                       const struct ac_surf_config *config, enum radeon_surf_mode mode,
+                       struct radeon_surf *surf)
+{
+   int r;
+
+   r = surf_config_sanity(config, surf->flags);
+   if (r)
+      return r;
+
+   /* Surfaces that take a tile swizzle from a surface index counter must get a new one every
+    * time, so they can't use the cache.
+    */
+   if (config->info.surf_index || config->info.fmask_surf_index || !addrlib->cache)
+      return ac_compute_surface_uncached(addrlib, info, config, mode, surf);
+
+   /* Build the key field by field, so that padding is always zero. */
+   struct ac_surface_cache_key key;
+   memset(&key, 0, sizeof(key));
+   key.info = info;
+   key.surf_info.width = config->info.width;
+   key.surf_info.height = config->info.height;
+   key.surf_info.depth = config->info.depth;
+   key.surf_info.samples = config->info.samples;
+   key.surf_info.storage_samples = config->info.storage_samples;
+   key.surf_info.levels = config->info.levels;
+   key.surf_info.num_channels = config->info.num_channels;
+   key.surf_info.array_size = config->info.array_size;
+   key.is_1d = config->is_1d;
+   key.is_3d = config->is_3d;
+   key.is_cube = config->is_cube;
+   key.is_array = config->is_array;
+   key.mode = mode;
+   memcpy(&key.surf, surf, sizeof(*surf));
+
+   uint32_t hash = ac_surface_cache_hash(&key);
+
+   simple_mtx_lock(&addrlib->cache_lock);
+   struct hash_entry *he = _mesa_hash_table_search_pre_hashed(addrlib->cache, hash, &key);
+   if (he) {
+      struct ac_surface_cache_entry *entry = he->data;
+
+      list_del(&entry->link);
+      list_add(&entry->link, &addrlib->cache_lru);
+      *surf = entry->surf;
+      simple_mtx_unlock(&addrlib->cache_lock);
+      return 0;
+   }
+   simple_mtx_unlock(&addrlib->cache_lock);
+
+   r = ac_compute_surface_uncached(addrlib, info, config, mode, surf);
+   if (r)
+      return r;
+
+   simple_mtx_lock(&addrlib->cache_lock);
+   /* Another thread may have added the same layout in the meantime. */
+   if (!_mesa_hash_table_search_pre_hashed(addrlib->cache, hash, &key)) {
+      struct ac_surface_cache_entry *entry;
+
+      if (addrlib->cache_size == AC_SURFACE_CACHE_SIZE) {
+         /* Reuse the least recently used entry. */
+         entry = list_last_entry(&addrlib->cache_lru, struct ac_surface_cache_entry, link);
+         list_del(&entry->link);
+         _mesa_hash_table_remove_key(addrlib->cache, &entry->key);
+         addrlib->cache_size--;
+      } else {
+         entry = malloc(sizeof(*entry));
+      }
+
+      if (entry) {
+         entry->key = key;
+         entry->surf = *surf;
+         list_add(&entry->link, &addrlib->cache_lru);
+         _mesa_hash_table_insert_pre_hashed(addrlib->cache, hash, &entry->key, entry);
+         addrlib->cache_size++;
+      }
+   }
+   simple_mtx_unlock(&addrlib->cache_lock);
+
+   return 0;
+}
+
 /* This is meant to be used for disabling DCC. */
 void ac_surface_zero_dcc_fields(struct radeon_surf *surf)
 {
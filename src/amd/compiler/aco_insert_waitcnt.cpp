@@ -990,6 +990,7 @@ void
 handle_block(Program* program, Block& block, wait_ctx& ctx)
 {
    std::vector<aco_ptr<Instruction>> new_instructions;
+   new_instructions.reserve(block.instructions.size());
 
    wait_imm queued_imm;
    alu_delay_info queued_delay;
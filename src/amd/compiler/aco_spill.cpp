@@ -1172,6 +1172,7 @@ process_block(spill_ctx& ctx, unsigned block_idx, Block* block, RegisterDemand s
    assert(!ctx.processed[block_idx]);
 
    std::vector<aco_ptr<Instruction>> instructions;
+   instructions.reserve(block->instructions.size());
    unsigned idx = 0;
 
    /* phis are handled separately */
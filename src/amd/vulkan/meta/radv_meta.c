@@ -435,8 +435,13 @@ radv_device_init_meta(struct radv_device *device)
       .pfnFree = meta_free,
    };
 
-   bool loaded_cache = radv_load_meta_pipeline(device);
-   bool on_demand = !loaded_cache;
+   /* Meta pipelines are created the first time they are used unless
+    * RADV_DEBUG=eagermeta is set.  Most of them are never needed by a given
+    * application, and the built-in cache loaded here still makes the
+    * on-demand compiles cheap.
+    */
+   radv_load_meta_pipeline(device);
+   bool on_demand = !(device->instance->debug_flags & RADV_DEBUG_EAGER_META);
 
    mtx_init(&device->meta_state.mtx, mtx_plain);
 
@@ -515,7 +520,7 @@ radv_device_init_meta(struct radv_device *device)
        * Work around it by forcing ACO for now.
        */
       bool use_llvm = device->physical_device->use_llvm;
-      if (loaded_cache || use_llvm) {
+      if (!on_demand || use_llvm) {
          device->physical_device->use_llvm = false;
          result = radv_device_init_accel_struct_build_state(device);
          device->physical_device->use_llvm = use_llvm;
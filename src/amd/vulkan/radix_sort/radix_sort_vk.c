@@ -500,24 +500,48 @@ radix_sort_vk_sort_devaddr(radix_sort_vk_t const *                   rs,
                            VkDevice                                  device,
                            VkCommandBuffer                           cb,
                            VkDeviceAddress *                         keyvals_sorted)
+{
+  radix_sort_vk_sort_devaddr_batch(rs, 1, info, device, cb, keyvals_sorted);
+}
+
+//
+//
+//
+void
+radix_sort_vk_sort_devaddr_batch(radix_sort_vk_t const *                   rs,
+                                 uint32_t                                  info_count,
+                                 radix_sort_vk_sort_devaddr_info_t const * infos,
+                                 VkDevice                                  device,
+                                 VkCommandBuffer                           cb,
+                                 VkDeviceAddress *                         keyvals_sorted)
 {
   //
   // Anything to do?
   //
-  if ((info->count <= 1) || (info->key_bits == 0))
+  bool any_sort = false;
+
+  for (uint32_t ii = 0; ii < info_count; ii++)
     {
-      *keyvals_sorted = info->keyvals_even.devaddr;
+      assert(infos[ii].key_bits == infos[0].key_bits);
 
-      return;
+      keyvals_sorted[ii] = infos[ii].keyvals_even.devaddr;
+
+      if ((infos[ii].count > 1) && (infos[ii].key_bits != 0))
+        any_sort = true;
     }
 
+  if (!any_sort)
+    return;
+
 #ifdef RS_VK_ENABLE_EXTENSIONS
   //
   // Any extensions?
   //
+  // Extensions are only honored when sorting a single set of keyvals.
+  //
   struct radix_sort_vk_ext_timestamps * ext_timestamps = NULL;
 
-  void * ext_next = info->ext;
+  void * ext_next = (info_count == 1) ? infos[0].ext : NULL;
 
   while (ext_next != NULL)
     {
@@ -551,6 +575,9 @@ radix_sort_vk_sort_devaddr(radix_sort_vk_t const *                   rs,
     // Note that the `partitions` buffer can be zeroed anytime before the first
     // scatter.
     //
+    // When sorting several sets of keyvals, each step is recorded for all of
+    // them before the barrier that ends it, so the sorts share the barriers.
+    //
     ////////////////////////////////////////////////////////////////////////
 
     //
@@ -574,10 +601,9 @@ radix_sort_vk_sort_devaddr(radix_sort_vk_t const *                   rs,
   //
   uint32_t const keyval_bytes = rs->config.keyval_dwords * (uint32_t)sizeof(uint32_t);
   uint32_t const keyval_bits  = keyval_bytes * 8;
-  uint32_t const key_bits     = MIN_MACRO(uint32_t, info->key_bits, keyval_bits);
+  uint32_t const key_bits     = MIN_MACRO(uint32_t, infos[0].key_bits, keyval_bits);
   uint32_t const passes       = (key_bits + RS_RADIX_LOG2 - 1) / RS_RADIX_LOG2;
-
-  *keyvals_sorted = ((passes & 1) != 0) ? info->keyvals_odd : info->keyvals_even.devaddr;
+  uint32_t const first_pass   = keyval_bytes - passes;
 
   ////////////////////////////////////////////////////////////////////////
   //
@@ -599,56 +625,62 @@ radix_sort_vk_sort_devaddr(radix_sort_vk_t const *                   rs,
   //
 
   //
-  // How many scatter blocks?
-  //
-  uint32_t const scatter_wg_size   = 1 << rs->config.scatter.workgroup_size_log2;
-  uint32_t const scatter_block_kvs = scatter_wg_size * rs->config.scatter.block_rows;
-  uint32_t const scatter_blocks    = (info->count + scatter_block_kvs - 1) / scatter_block_kvs;
-  uint32_t const count_ru_scatter  = scatter_blocks * scatter_block_kvs;
-
-  //
-  // How many histogram blocks?
+  // How many keyvals per scatter and histogram block?
   //
   // Note that it's OK to have more max-valued digits counted by the histogram
   // than sorted by the scatters because the sort is stable.
   //
-  uint32_t const histo_wg_size   = 1 << rs->config.histogram.workgroup_size_log2;
-  uint32_t const histo_block_kvs = histo_wg_size * rs->config.histogram.block_rows;
-  uint32_t const histo_blocks    = (count_ru_scatter + histo_block_kvs - 1) / histo_block_kvs;
-  uint32_t const count_ru_histo  = histo_blocks * histo_block_kvs;
+  uint32_t const scatter_wg_size   = 1 << rs->config.scatter.workgroup_size_log2;
+  uint32_t const scatter_block_kvs = scatter_wg_size * rs->config.scatter.block_rows;
+  uint32_t const histo_wg_size     = 1 << rs->config.histogram.workgroup_size_log2;
+  uint32_t const histo_block_kvs   = histo_wg_size * rs->config.histogram.block_rows;
 
-  //
-  // Fill with max values
-  //
-  if (count_ru_histo > info->count)
+  for (uint32_t ii = 0; ii < info_count; ii++)
     {
-      info->fill_buffer(cb,
-                        &info->keyvals_even,
-                        info->count * keyval_bytes,
-                        (count_ru_histo - info->count) * keyval_bytes,
-                        0xFFFFFFFF);
-    }
+      radix_sort_vk_sort_devaddr_info_t const * const info = infos + ii;
 
-  //
-  // Zero histograms and invalidate partitions.
-  //
-  // Note that the partition invalidation only needs to be performed once
-  // because the even/odd scatter dispatches rely on the the previous pass to
-  // leave the partitions in an invalid state.
-  //
-  // Note that the last workgroup doesn't read/write a partition so it doesn't
-  // need to be initialized.
-  //
-  uint32_t const histo_partition_count = passes + scatter_blocks - 1;
-  uint32_t       pass_idx              = (keyval_bytes - passes);
+      if (info->count <= 1)
+        continue;
 
-  VkDeviceSize const fill_base = pass_idx * (RS_RADIX_SIZE * sizeof(uint32_t));
+      keyvals_sorted[ii] = ((passes & 1) != 0) ? info->keyvals_odd : info->keyvals_even.devaddr;
 
-  info->fill_buffer(cb,
-                    &info->internal,
-                    rs->internal.histograms.offset + fill_base,
-                    histo_partition_count * (RS_RADIX_SIZE * sizeof(uint32_t)),
-                    0);
+      uint32_t const scatter_blocks   = (info->count + scatter_block_kvs - 1) / scatter_block_kvs;
+      uint32_t const count_ru_scatter = scatter_blocks * scatter_block_kvs;
+      uint32_t const histo_blocks     = (count_ru_scatter + histo_block_kvs - 1) / histo_block_kvs;
+      uint32_t const count_ru_histo   = histo_blocks * histo_block_kvs;
+
+      //
+      // Fill with max values
+      //
+      if (count_ru_histo > info->count)
+        {
+          info->fill_buffer(cb,
+                            &info->keyvals_even,
+                            info->count * keyval_bytes,
+                            (count_ru_histo - info->count) * keyval_bytes,
+                            0xFFFFFFFF);
+        }
+
+      //
+      // Zero histograms and invalidate partitions.
+      //
+      // Note that the partition invalidation only needs to be performed once
+      // because the even/odd scatter dispatches rely on the the previous pass to
+      // leave the partitions in an invalid state.
+      //
+      // Note that the last workgroup doesn't read/write a partition so it doesn't
+      // need to be initialized.
+      //
+      uint32_t const histo_partition_count = passes + scatter_blocks - 1;
+
+      VkDeviceSize const fill_base = first_pass * (RS_RADIX_SIZE * sizeof(uint32_t));
+
+      info->fill_buffer(cb,
+                        &info->internal,
+                        rs->internal.histograms.offset + fill_base,
+                        histo_partition_count * (RS_RADIX_SIZE * sizeof(uint32_t)),
+                        0);
+    }
 
   ////////////////////////////////////////////////////////////////////////
   //
@@ -664,31 +696,38 @@ radix_sort_vk_sort_devaddr(radix_sort_vk_t const *                   rs,
 
   vk_barrier_transfer_w_to_compute_r(cb);
 
-  // clang-format off
-  VkDeviceAddress const devaddr_histograms   = info->internal.devaddr + rs->internal.histograms.offset;
-  VkDeviceAddress const devaddr_keyvals_even = info->keyvals_even.devaddr;
-  // clang-format on
+  vkCmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_COMPUTE, rs->pipelines.named.histogram);
 
-  //
-  // Dispatch histogram
-  //
-  struct rs_push_histogram const push_histogram = {
+  for (uint32_t ii = 0; ii < info_count; ii++)
+    {
+      radix_sort_vk_sort_devaddr_info_t const * const info = infos + ii;
 
-    .devaddr_histograms = devaddr_histograms,
-    .devaddr_keyvals    = devaddr_keyvals_even,
-    .passes             = passes
-  };
+      if (info->count <= 1)
+        continue;
 
-  vkCmdPushConstants(cb,
-                     rs->pipeline_layouts.named.histogram,
-                     VK_SHADER_STAGE_COMPUTE_BIT,
-                     0,
-                     sizeof(push_histogram),
-                     &push_histogram);
+      uint32_t const scatter_blocks   = (info->count + scatter_block_kvs - 1) / scatter_block_kvs;
+      uint32_t const count_ru_scatter = scatter_blocks * scatter_block_kvs;
+      uint32_t const histo_blocks     = (count_ru_scatter + histo_block_kvs - 1) / histo_block_kvs;
 
-  vkCmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_COMPUTE, rs->pipelines.named.histogram);
+      //
+      // Dispatch histogram
+      //
+      struct rs_push_histogram const push_histogram = {
+
+        .devaddr_histograms = info->internal.devaddr + rs->internal.histograms.offset,
+        .devaddr_keyvals    = info->keyvals_even.devaddr,
+        .passes             = passes
+      };
+
+      vkCmdPushConstants(cb,
+                         rs->pipeline_layouts.named.histogram,
+                         VK_SHADER_STAGE_COMPUTE_BIT,
+                         0,
+                         sizeof(push_histogram),
+                         &push_histogram);
 
-  vkCmdDispatch(cb, histo_blocks, 1, 1);
+      vkCmdDispatch(cb, histo_blocks, 1, 1);
+    }
 
   ////////////////////////////////////////////////////////////////////////
   //
@@ -702,106 +741,89 @@ radix_sort_vk_sort_devaddr(radix_sort_vk_t const *                   rs,
 
   vk_barrier_compute_w_to_compute_r(cb);
 
-  struct rs_push_prefix const push_prefix = {
+  vkCmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_COMPUTE, rs->pipelines.named.prefix);
 
-    .devaddr_histograms = devaddr_histograms,
-  };
+  for (uint32_t ii = 0; ii < info_count; ii++)
+    {
+      radix_sort_vk_sort_devaddr_info_t const * const info = infos + ii;
 
-  vkCmdPushConstants(cb,
-                     rs->pipeline_layouts.named.prefix,
-                     VK_SHADER_STAGE_COMPUTE_BIT,
-                     0,
-                     sizeof(push_prefix),
-                     &push_prefix);
+      if (info->count <= 1)
+        continue;
 
-  vkCmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_COMPUTE, rs->pipelines.named.prefix);
+      struct rs_push_prefix const push_prefix = {
 
-  vkCmdDispatch(cb, passes, 1, 1);
+        .devaddr_histograms = info->internal.devaddr + rs->internal.histograms.offset,
+      };
+
+      vkCmdPushConstants(cb,
+                         rs->pipeline_layouts.named.prefix,
+                         VK_SHADER_STAGE_COMPUTE_BIT,
+                         0,
+                         sizeof(push_prefix),
+                         &push_prefix);
+
+      vkCmdDispatch(cb, passes, 1, 1);
+    }
 
   ////////////////////////////////////////////////////////////////////////
   //
   // Pipeline: SCATTER
   //
-#ifdef RS_VK_ENABLE_EXTENSIONS
-  rs_ext_cmd_write_timestamp(ext_timestamps, cb, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
-#endif
-
-  vk_barrier_compute_w_to_compute_r(cb);
-
-  // clang-format off
-  uint32_t        const histogram_offset    = pass_idx * (RS_RADIX_SIZE * sizeof(uint32_t));
-  VkDeviceAddress const devaddr_keyvals_odd = info->keyvals_odd;
-  VkDeviceAddress const devaddr_partitions  = info->internal.devaddr + rs->internal.partitions.offset;
-  // clang-format on
-
-  struct rs_push_scatter push_scatter = {
-
-    .devaddr_keyvals_even = devaddr_keyvals_even,
-    .devaddr_keyvals_odd  = devaddr_keyvals_odd,
-    .devaddr_partitions   = devaddr_partitions,
-    .devaddr_histograms   = devaddr_histograms + histogram_offset,
-    .pass_offset          = (pass_idx & 3) * RS_RADIX_LOG2,
-  };
-
-  {
-    uint32_t const pass_dword = pass_idx / 4;
-
-    vkCmdPushConstants(cb,
-                       rs->pipeline_layouts.named.scatter[pass_dword].even,
-                       VK_SHADER_STAGE_COMPUTE_BIT,
-                       0,
-                       sizeof(push_scatter),
-                       &push_scatter);
-
-    vkCmdBindPipeline(cb,
-                      VK_PIPELINE_BIND_POINT_COMPUTE,
-                      rs->pipelines.named.scatter[pass_dword].even);
-  }
-
-  bool is_even = true;
+  uint32_t histogram_offset = first_pass * (RS_RADIX_SIZE * sizeof(uint32_t));
+  bool     is_even          = true;
 
-  while (true)
+  for (uint32_t pass_idx = first_pass; pass_idx < keyval_bytes; pass_idx++)
     {
-      vkCmdDispatch(cb, scatter_blocks, 1, 1);
-
-      //
-      // Continue?
-      //
-      if (++pass_idx >= keyval_bytes)
-        break;
-
 #ifdef RS_VK_ENABLE_EXTENSIONS
       rs_ext_cmd_write_timestamp(ext_timestamps, cb, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT);
 #endif
-      vk_barrier_compute_w_to_compute_r(cb);
 
-      // clang-format off
-      is_even                         ^= true;
-      push_scatter.devaddr_histograms += (RS_RADIX_SIZE * sizeof(uint32_t));
-      push_scatter.pass_offset         = (pass_idx & 3) * RS_RADIX_LOG2;
-      // clang-format on
+      vk_barrier_compute_w_to_compute_r(cb);
 
       uint32_t const pass_dword = pass_idx / 4;
 
       //
-      // Update push constants that changed
+      // Bind new pipeline
       //
       VkPipelineLayout const pl = is_even ? rs->pipeline_layouts.named.scatter[pass_dword].even  //
                                           : rs->pipeline_layouts.named.scatter[pass_dword].odd;
-      vkCmdPushConstants(cb,
-                         pl,
-                         VK_SHADER_STAGE_COMPUTE_BIT,
-                         OFFSETOF_MACRO(struct rs_push_scatter, devaddr_histograms),
-                         sizeof(push_scatter.devaddr_histograms) + sizeof(push_scatter.pass_offset),
-                         &push_scatter.devaddr_histograms);
-
-      //
-      // Bind new pipeline
-      //
-      VkPipeline const p = is_even ? rs->pipelines.named.scatter[pass_dword].even  //
-                                   : rs->pipelines.named.scatter[pass_dword].odd;
+      VkPipeline const       p  = is_even ? rs->pipelines.named.scatter[pass_dword].even  //
+                                          : rs->pipelines.named.scatter[pass_dword].odd;
 
       vkCmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_COMPUTE, p);
+
+      for (uint32_t ii = 0; ii < info_count; ii++)
+        {
+          radix_sort_vk_sort_devaddr_info_t const * const info = infos + ii;
+
+          if (info->count <= 1)
+            continue;
+
+          uint32_t const scatter_blocks = (info->count + scatter_block_kvs - 1) / scatter_block_kvs;
+
+          // clang-format off
+          struct rs_push_scatter const push_scatter = {
+
+            .devaddr_keyvals_even = info->keyvals_even.devaddr,
+            .devaddr_keyvals_odd  = info->keyvals_odd,
+            .devaddr_partitions   = info->internal.devaddr + rs->internal.partitions.offset,
+            .devaddr_histograms   = info->internal.devaddr + rs->internal.histograms.offset + histogram_offset,
+            .pass_offset          = (pass_idx & 3) * RS_RADIX_LOG2,
+          };
+          // clang-format on
+
+          vkCmdPushConstants(cb,
+                             pl,
+                             VK_SHADER_STAGE_COMPUTE_BIT,
+                             0,
+                             sizeof(push_scatter),
+                             &push_scatter);
+
+          vkCmdDispatch(cb, scatter_blocks, 1, 1);
+        }
+
+      is_even ^= true;
+      histogram_offset += (RS_RADIX_SIZE * sizeof(uint32_t));
     }
 
 #ifdef RS_VK_ENABLE_EXTENSIONS
@@ -64,6 +64,22 @@ radix_sort_vk_sort_devaddr(radix_sort_vk_t const *                   rs,
                            VkCommandBuffer                           cb,
                            VkDeviceAddress *                         keyvals_sorted);
 
+//
+// Sort several sets of keyvals, recording each step of the sort for all of
+// them before the barrier that ends it.  This avoids one set of barriers per
+// sort when sorting many small sets.
+//
+// All infos must have the same `key_bits`.  Extensions are only honored when
+// `info_count` is 1.
+//
+void
+radix_sort_vk_sort_devaddr_batch(radix_sort_vk_t const *                   rs,
+                                 uint32_t                                  info_count,
+                                 radix_sort_vk_sort_devaddr_info_t const * infos,
+                                 VkDevice                                  device,
+                                 VkCommandBuffer                           cb,
+                                 VkDeviceAddress *                         keyvals_sorted);
+
 //
 // Indirect dispatch sorting using buffer device addresses
 // -------------------------------------------------------
@@ -610,6 +610,18 @@ struct bvh_state {
    struct build_config config;
 };
 
+static bool
+any_build_uses_internal_type(uint32_t infoCount, const struct bvh_state *bvh_states,
+                             enum internal_build_type internal_type)
+{
+   for (uint32_t i = 0; i < infoCount; ++i) {
+      if (bvh_states[i].config.internal_type == internal_type)
+         return true;
+   }
+
+   return false;
+}
+
 static uint32_t
 pack_geometry_id_and_flags(uint32_t geometry_id, uint32_t flags)
 {
@@ -734,40 +746,57 @@ morton_generate(VkCommandBuffer commandBuffer, uint32_t infoCount,
    cmd_buffer->state.flush_bits |= flush_bits;
 }
 
-static void
+static VkResult
 morton_sort(VkCommandBuffer commandBuffer, uint32_t infoCount,
             const VkAccelerationStructureBuildGeometryInfoKHR *pInfos, struct bvh_state *bvh_states,
             enum radv_cmd_flush_bits flush_bits)
 {
    RADV_FROM_HANDLE(radv_cmd_buffer, cmd_buffer, commandBuffer);
-   for (uint32_t i = 0; i < infoCount; ++i) {
-      struct radix_sort_vk_memory_requirements requirements;
-      radix_sort_vk_get_memory_requirements(cmd_buffer->device->meta_state.accel_struct_build.radix_sort,
-                                            bvh_states[i].node_count, &requirements);
+   radix_sort_vk_t *rs = cmd_buffer->device->meta_state.accel_struct_build.radix_sort;
+
+   /* Sort all builds at once, so that they share the barriers between the sort passes instead of
+    * serializing batches of many small BLAS builds.
+    */
+   const VkAllocationCallbacks *alloc = &cmd_buffer->device->vk.alloc;
+   radix_sort_vk_sort_devaddr_info_t *infos =
+      vk_alloc(alloc, infoCount * sizeof(*infos), 8, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+   VkDeviceAddress *result_addrs =
+      vk_alloc(alloc, infoCount * sizeof(*result_addrs), 8, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND);
+   if (!infos || !result_addrs) {
+      vk_free(alloc, infos);
+      vk_free(alloc, result_addrs);
+      return VK_ERROR_OUT_OF_HOST_MEMORY;
+   }
 
-      struct radix_sort_vk_sort_devaddr_info info = cmd_buffer->device->meta_state.accel_struct_build.radix_sort_info;
-      info.count = bvh_states[i].node_count;
+   for (uint32_t i = 0; i < infoCount; ++i) {
+      infos[i] = cmd_buffer->device->meta_state.accel_struct_build.radix_sort_info;
+      infos[i].count = bvh_states[i].node_count;
 
-      info.keyvals_even.buffer = VK_NULL_HANDLE;
-      info.keyvals_even.offset = 0;
-      info.keyvals_even.devaddr = pInfos[i].scratchData.deviceAddress + bvh_states[i].scratch.sort_buffer_offset[0];
+      infos[i].keyvals_even.buffer = VK_NULL_HANDLE;
+      infos[i].keyvals_even.offset = 0;
+      infos[i].keyvals_even.devaddr = pInfos[i].scratchData.deviceAddress + bvh_states[i].scratch.sort_buffer_offset[0];
 
-      info.keyvals_odd = pInfos[i].scratchData.deviceAddress + bvh_states[i].scratch.sort_buffer_offset[1];
+      infos[i].keyvals_odd = pInfos[i].scratchData.deviceAddress + bvh_states[i].scratch.sort_buffer_offset[1];
 
-      info.internal.buffer = VK_NULL_HANDLE;
-      info.internal.offset = 0;
-      info.internal.devaddr = pInfos[i].scratchData.deviceAddress + bvh_states[i].scratch.sort_internal_offset;
+      infos[i].internal.buffer = VK_NULL_HANDLE;
+      infos[i].internal.offset = 0;
+      infos[i].internal.devaddr = pInfos[i].scratchData.deviceAddress + bvh_states[i].scratch.sort_internal_offset;
+   }
 
-      VkDeviceAddress result_addr;
-      radix_sort_vk_sort_devaddr(cmd_buffer->device->meta_state.accel_struct_build.radix_sort, &info,
-                                 radv_device_to_handle(cmd_buffer->device), commandBuffer, &result_addr);
+   radix_sort_vk_sort_devaddr_batch(rs, infoCount, infos, radv_device_to_handle(cmd_buffer->device), commandBuffer,
+                                    result_addrs);
 
-      assert(result_addr == info.keyvals_even.devaddr || result_addr == info.keyvals_odd);
+   for (uint32_t i = 0; i < infoCount; ++i) {
+      assert(result_addrs[i] == infos[i].keyvals_even.devaddr || result_addrs[i] == infos[i].keyvals_odd);
 
-      bvh_states[i].scratch_offset = (uint32_t)(result_addr - pInfos[i].scratchData.deviceAddress);
+      bvh_states[i].scratch_offset = (uint32_t)(result_addrs[i] - pInfos[i].scratchData.deviceAddress);
    }
 
+   vk_free(alloc, infos);
+   vk_free(alloc, result_addrs);
+
    cmd_buffer->state.flush_bits |= flush_bits;
+   return VK_SUCCESS;
 }
 
 static void
@@ -776,6 +805,11 @@ lbvh_build_internal(VkCommandBuffer commandBuffer, uint32_t infoCount,
                     enum radv_cmd_flush_bits flush_bits)
 {
    RADV_FROM_HANDLE(radv_cmd_buffer, cmd_buffer, commandBuffer);
+
+   /* Don't emit the barrier between the two LBVH passes if every build uses PLOC. */
+   if (!any_build_uses_internal_type(infoCount, bvh_states, INTERNAL_BUILD_TYPE_LBVH))
+      return;
+
    radv_CmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
                         cmd_buffer->device->meta_state.accel_struct_build.lbvh_main_pipeline);
    for (uint32_t i = 0; i < infoCount; ++i) {
@@ -828,6 +862,10 @@ ploc_build_internal(VkCommandBuffer commandBuffer, uint32_t infoCount,
                     bool extended_sah)
 {
    RADV_FROM_HANDLE(radv_cmd_buffer, cmd_buffer, commandBuffer);
+
+   if (!any_build_uses_internal_type(infoCount, bvh_states, INTERNAL_BUILD_TYPE_PLOC))
+      return;
+
    radv_CmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE,
                         extended_sah ? cmd_buffer->device->meta_state.accel_struct_build.ploc_extended_pipeline
                                      : cmd_buffer->device->meta_state.accel_struct_build.ploc_pipeline);
@@ -1077,7 +1115,13 @@ radv_CmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t i
 
    morton_generate(commandBuffer, infoCount, pInfos, bvh_states, flush_bits);
 
-   morton_sort(commandBuffer, infoCount, pInfos, bvh_states, flush_bits);
+   result = morton_sort(commandBuffer, infoCount, pInfos, bvh_states, flush_bits);
+   if (result != VK_SUCCESS) {
+      vk_command_buffer_set_error(&cmd_buffer->vk, result);
+      free(bvh_states);
+      radv_meta_restore(&saved_state, cmd_buffer);
+      return;
+   }
 
    cmd_buffer->state.flush_bits |= flush_bits;
 
@@ -128,6 +128,8 @@
 /* 256 KiB << 5 = 8 MiB */
 #define RADV_SHADER_ALLOC_MAX_ARENA_SIZE_SHIFT 5u
 #define RADV_SHADER_ALLOC_MIN_SIZE_CLASS       8
+/* Size and alignment of arenas with RADV_PERFTEST=hugeshaderarenas. */
+#define RADV_SHADER_ALLOC_HUGE_ARENA_SIZE      (2 * 1024 * 1024)
 #define RADV_SHADER_ALLOC_MAX_SIZE_CLASS       15
 #define RADV_SHADER_ALLOC_NUM_FREE_LISTS       (RADV_SHADER_ALLOC_MAX_SIZE_CLASS - RADV_SHADER_ALLOC_MIN_SIZE_CLASS + 1)
 
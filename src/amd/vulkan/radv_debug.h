@@ -72,6 +72,7 @@ enum {
    RADV_DEBUG_NO_GPL = 1ull << 41,
    RADV_DEBUG_VIDEO_ARRAY_PATH = 1ull << 42,
    RADV_DEBUG_NO_RT = 1ull << 43,
+   RADV_DEBUG_EAGER_META = 1ull << 44,
 };
 
 enum {
@@ -89,6 +90,9 @@ enum {
    RADV_PERFTEST_NGG_STREAMOUT = 1u << 11,
    RADV_PERFTEST_VIDEO_DECODE = 1u << 12,
    RADV_PERFTEST_DMA_SHADERS = 1u << 13,
+   RADV_PERFTEST_PARALLEL_NIR = 1u << 14,
+   RADV_PERFTEST_HUGE_SHADER_ARENAS = 1u << 15,
+   RADV_PERFTEST_FAST_GPL_LIBS = 1u << 16,
 };
 
 bool radv_init_trace(struct radv_device *device);
@@ -1019,6 +1019,16 @@ radv_CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCr
    device->load_grid_size_from_user_sgpr = device->physical_device->rad_info.gfx_level >= GFX10_3;
 
    device->keep_shader_info = keep_shader_info;
+
+   /* A graphics pipeline has at most 5 stages, one of them is optimized by
+    * the thread creating the pipeline.
+    */
+   if ((device->instance->perftest_flags & RADV_PERFTEST_PARALLEL_NIR) &&
+       !util_queue_init(&device->nir_queue, "radv_nir", 32, 4, UTIL_QUEUE_INIT_RESIZE_IF_FULL, NULL)) {
+      result = VK_ERROR_INITIALIZATION_FAILED;
+      goto fail;
+   }
+
    result = radv_device_init_meta(device);
    if (result != VK_SUCCESS)
       goto fail;
@@ -1107,6 +1117,8 @@ fail:
       device->ws->buffer_destroy(device->ws, device->gfx_init);
 
    radv_device_finish_notifier(device);
+   if (util_queue_is_initialized(&device->nir_queue))
+      util_queue_destroy(&device->nir_queue);
    radv_device_finish_vs_prologs(device);
    radv_device_finish_ps_epilogs(device);
    radv_device_finish_border_color(device);
@@ -1159,6 +1171,8 @@ radv_DestroyDevice(VkDevice _device, const VkAllocationCallbacks *pAllocator)
       device->ws->buffer_destroy(device->ws, device->gfx_init);
 
    radv_device_finish_notifier(device);
+   if (util_queue_is_initialized(&device->nir_queue))
+      util_queue_destroy(&device->nir_queue);
    radv_device_finish_vs_prologs(device);
    radv_device_finish_ps_epilogs(device);
    radv_device_finish_border_color(device);
@@ -1343,5 +1343,12 @@ radv_prepare_dgc(struct radv_cmd_buffer *cmd_buffer, const VkGeneratedCommandsIn
    radv_buffer_finish(&token_buffer);
    radv_meta_restore(&saved_state, cmd_buffer);
 
-   cmd_buffer->state.flush_bits |= RADV_CMD_FLAG_CS_PARTIAL_FLUSH | RADV_CMD_FLAG_INV_VCACHE | RADV_CMD_FLAG_INV_L2;
+   cmd_buffer->state.flush_bits |= RADV_CMD_FLAG_CS_PARTIAL_FLUSH | RADV_CMD_FLAG_INV_VCACHE;
+
+   /* The CP fetches the generated IB through L2 on GFX9+, so the L2 only needs to be invalidated
+    * when it isn't coherent with shader writes.
+    */
+   const struct radeon_info *rad_info = &cmd_buffer->device->physical_device->rad_info;
+   if (rad_info->gfx_level < GFX9 || (rad_info->gfx_level >= GFX10 && rad_info->tcc_rb_non_coherent))
+      cmd_buffer->state.flush_bits |= RADV_CMD_FLAG_INV_L2;
 }
@@ -77,6 +77,7 @@ static const struct debug_control radv_debug_options[] = {{"nofastclears", RADV_
                                                           {"nogpl", RADV_DEBUG_NO_GPL},
                                                           {"videoarraypath", RADV_DEBUG_VIDEO_ARRAY_PATH},
                                                           {"nort", RADV_DEBUG_NO_RT},
+                                                          {"eagermeta", RADV_DEBUG_EAGER_META},
                                                           {NULL, 0}};
 
 const char *
@@ -100,6 +101,9 @@ static const struct debug_control radv_perftest_options[] = {{"localbos", RADV_P
                                                              {"ngg_streamout", RADV_PERFTEST_NGG_STREAMOUT},
                                                              {"video_decode", RADV_PERFTEST_VIDEO_DECODE},
                                                              {"dmashaders", RADV_PERFTEST_DMA_SHADERS},
+                                                             {"parallel_nir", RADV_PERFTEST_PARALLEL_NIR},
+                                                             {"hugeshaderarenas", RADV_PERFTEST_HUGE_SHADER_ARENAS},
+                                                             {"fastgpllibs", RADV_PERFTEST_FAST_GPL_LIBS},
                                                              {NULL, 0}};
 
 const char *
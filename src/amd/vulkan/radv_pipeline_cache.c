@@ -299,20 +299,38 @@ radv_pipeline_cache_object_deserialize(struct vk_pipeline_cache *cache, const vo
 
    object->base.data_size = total_size;
 
+   STACK_ARRAY(const void *, hashes, num_shaders);
+   STACK_ARRAY(struct vk_pipeline_cache_object *, shaders, num_shaders);
+   if (!hashes || !shaders) {
+      STACK_ARRAY_FINISH(hashes);
+      STACK_ARRAY_FINISH(shaders);
+      vk_pipeline_cache_object_unref(&device->vk, &object->base);
+      return NULL;
+   }
+
+   for (unsigned i = 0; i < num_shaders; i++)
+      hashes[i] = blob_read_bytes(blob, sizeof(blake3_hash));
+
+   /* Fetch all of the shaders that aren't in memory from the disk cache at once. */
+   vk_pipeline_cache_lookup_objects(cache, num_shaders, hashes, sizeof(blake3_hash), &radv_shader_ops, shaders);
+
+   bool complete = true;
    for (unsigned i = 0; i < num_shaders; i++) {
-      const uint8_t *hash = blob_read_bytes(blob, sizeof(blake3_hash));
-      struct vk_pipeline_cache_object *shader =
-         vk_pipeline_cache_lookup_object(cache, hash, sizeof(blake3_hash), &radv_shader_ops, NULL);
-
-      if (!shader) {
-         /* If some shader could not be created from cache, better return NULL here than having
-          * an incomplete cache object which needs to be fixed up later.
-          */
-         vk_pipeline_cache_object_unref(&device->vk, &object->base);
-         return NULL;
-      }
+      if (shaders[i])
+         object->shaders[i] = container_of(shaders[i], struct radv_shader, base);
+      else
+         complete = false;
+   }
+
+   STACK_ARRAY_FINISH(hashes);
+   STACK_ARRAY_FINISH(shaders);
 
-      object->shaders[i] = container_of(shader, struct radv_shader, base);
+   if (!complete) {
+      /* If some shader could not be created from cache, better return NULL here than having
+       * an incomplete cache object which needs to be fixed up later.
+       */
+      vk_pipeline_cache_object_unref(&device->vk, &object->base);
+      return NULL;
    }
 
    const size_t data_size = ps_epilog_binary_size + (num_stack_sizes * sizeof(uint32_t));
@@ -1821,6 +1821,17 @@ radv_generate_graphics_pipeline_key(const struct radv_device *device, const stru
                                                              pCreateInfo->flags, pCreateInfo->pNext);
 
    key.lib_flags = lib_flags;
+
+   /* Libraries that retain link-time optimization info are going to be
+    * linked with optimizations later, so the application only uses them for
+    * fast-linked pipelines in the meantime. Skip the optimizations, the
+    * scheduler in particular, to reduce first-use stutter.
+    */
+   if ((device->instance->perftest_flags & RADV_PERFTEST_FAST_GPL_LIBS) &&
+       (pCreateInfo->flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR) &&
+       (pCreateInfo->flags & VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT))
+      key.optimisations_disabled = 1;
+
    key.has_multiview_view_index = state->rp ? !!state->rp->view_mask : 0;
 
    if (pipeline->dynamic_states & RADV_DYNAMIC_VERTEX_INPUT) {
@@ -2228,6 +2239,31 @@ radv_pipeline_create_gs_copy_shader(struct radv_device *device, struct radv_pipe
    return copy_shader;
 }
 
+struct radv_nir_to_asm_data {
+   struct radv_device *device;
+   struct radv_pipeline_stage *stages;
+   const struct radv_pipeline_key *pipeline_key;
+   bool keep_executable_info;
+   bool keep_statistic_info;
+   nir_shader *shaders[MESA_VULKAN_SHADER_STAGES][2];
+   unsigned shader_count[MESA_VULKAN_SHADER_STAGES];
+   struct radv_shader_binary **binaries;
+};
+
+static void
+radv_stage_nir_to_asm(UNUSED nir_shader *nir, unsigned stage, void *data)
+{
+   struct radv_nir_to_asm_data *asm_data = data;
+   int64_t stage_start = os_time_get_nano();
+
+   asm_data->binaries[stage] =
+      radv_shader_nir_to_asm(asm_data->device, &asm_data->stages[stage], asm_data->shaders[stage],
+                             asm_data->shader_count[stage], asm_data->pipeline_key, asm_data->keep_executable_info,
+                             asm_data->keep_statistic_info);
+
+   asm_data->stages[stage].feedback.duration += os_time_get_nano() - stage_start;
+}
+
 static void
 radv_pipeline_nir_to_asm(struct radv_device *device, struct radv_graphics_pipeline *pipeline,
                          struct vk_pipeline_cache *cache, struct radv_pipeline_stage *stages,
@@ -2236,12 +2272,23 @@ radv_pipeline_nir_to_asm(struct radv_device *device, struct radv_graphics_pipeli
                          bool keep_statistic_info, VkShaderStageFlagBits active_nir_stages,
                          struct radv_shader_binary **binaries, struct radv_shader_binary **gs_copy_binary)
 {
+   struct radv_nir_to_asm_data asm_data = {
+      .device = device,
+      .stages = stages,
+      .pipeline_key = pipeline_key,
+      .keep_executable_info = keep_executable_info,
+      .keep_statistic_info = keep_statistic_info,
+      .binaries = binaries,
+   };
+   nir_shader *nir_stages[MESA_VULKAN_SHADER_STAGES] = {NULL};
+
    for (int s = MESA_VULKAN_SHADER_STAGES - 1; s >= 0; s--) {
       if (!(active_nir_stages & (1 << s)) || pipeline->base.shaders[s])
          continue;
 
-      nir_shader *shaders[2] = {stages[s].nir, NULL};
-      unsigned shader_count = 1;
+      nir_shader **shaders = asm_data.shaders[s];
+      shaders[0] = stages[s].nir;
+      asm_data.shader_count[s] = 1;
 
       /* On GFX9+, TES is merged with GS and VS is merged with TCS or GS. */
       if (device->physical_device->rad_info.gfx_level >= GFX9 &&
@@ -2256,15 +2303,34 @@ radv_pipeline_nir_to_asm(struct radv_device *device, struct radv_graphics_pipeli
 
          shaders[0] = stages[pre_stage].nir;
          shaders[1] = stages[s].nir;
-         shader_count = 2;
+         asm_data.shader_count[s] = 2;
       }
 
+      nir_stages[s] = stages[s].nir;
+
+      active_nir_stages &= ~(1 << shaders[0]->info.stage);
+      if (shaders[1])
+         active_nir_stages &= ~(1 << shaders[1]->info.stage);
+   }
+
+   /* Every NIR shader is only used by one backend compilation, so the stages
+    * can be compiled in parallel. Don't do that when dumping shaders because
+    * the output of the stages would be interleaved.
+    */
+   struct util_queue *queue =
+      (device->instance->debug_flags & RADV_DEBUG_DUMP_SHADERS) ? NULL : &device->nir_queue;
+   nir_shaders_run_parallel(queue, nir_stages, MESA_VULKAN_SHADER_STAGES, radv_stage_nir_to_asm, &asm_data);
+
+   for (int s = MESA_VULKAN_SHADER_STAGES - 1; s >= 0; s--) {
+      if (!nir_stages[s])
+         continue;
+
+      nir_shader **shaders = asm_data.shaders[s];
+      unsigned shader_count = asm_data.shader_count[s];
       int64_t stage_start = os_time_get_nano();
 
       bool dump_shader = radv_can_dump_shader(device, shaders[0], false);
 
-      binaries[s] = radv_shader_nir_to_asm(device, &stages[s], shaders, shader_count, pipeline_key,
-                                           keep_executable_info, keep_statistic_info);
       pipeline->base.shaders[s] = radv_shader_create(device, cache, binaries[s], keep_executable_info || dump_shader);
       radv_shader_generate_debug_info(device, dump_shader, binaries[s], pipeline->base.shaders[s], shaders,
                                       shader_count, &stages[s].info);
@@ -2276,10 +2342,6 @@ radv_pipeline_nir_to_asm(struct radv_device *device, struct radv_graphics_pipeli
       }
 
       stages[s].feedback.duration += os_time_get_nano() - stage_start;
-
-      active_nir_stages &= ~(1 << shaders[0]->info.stage);
-      if (shaders[1])
-         active_nir_stages &= ~(1 << shaders[1]->info.stage);
    }
 }
 
@@ -2493,6 +2555,27 @@ radv_skip_graphics_pipeline_compile(const struct radv_device *device, const stru
    return binary_stages == pipeline->active_stages;
 }
 
+struct radv_optimize_stage_data {
+   struct radv_device *device;
+   struct radv_pipeline_stage *stages;
+   bool optimize_conservatively;
+};
+
+static void
+radv_optimize_stage(nir_shader *nir, unsigned stage, void *data)
+{
+   struct radv_optimize_stage_data *optimize_data = data;
+   int64_t stage_start = os_time_get_nano();
+
+   radv_optimize_nir(nir, optimize_data->optimize_conservatively);
+
+   /* Gather info again, information such as outputs_read can be out-of-date. */
+   nir_shader_gather_info(nir, nir_shader_get_entrypoint(nir));
+   radv_nir_lower_io(optimize_data->device, nir);
+
+   optimize_data->stages[stage].feedback.duration += os_time_get_nano() - stage_start;
+}
+
 static VkResult
 radv_graphics_pipeline_compile(struct radv_graphics_pipeline *pipeline, const VkGraphicsPipelineCreateInfo *pCreateInfo,
                                struct radv_pipeline_layout *pipeline_layout, struct radv_device *device,
@@ -2631,18 +2714,18 @@ radv_graphics_pipeline_compile(struct radv_graphics_pipeline *pipeline, const Vk
       NIR_PASS(_, stages[MESA_SHADER_FRAGMENT].nir, radv_nir_lower_fs_barycentric, pipeline_key, rast_prim);
    }
 
-   radv_foreach_stage(i, active_nir_stages)
-   {
-      int64_t stage_start = os_time_get_nano();
-
-      radv_optimize_nir(stages[i].nir, optimize_conservatively);
+   struct radv_optimize_stage_data optimize_data = {
+      .device = device,
+      .stages = stages,
+      .optimize_conservatively = optimize_conservatively,
+   };
+   nir_shader *nir_stages[MESA_VULKAN_SHADER_STAGES];
 
-      /* Gather info again, information such as outputs_read can be out-of-date. */
-      nir_shader_gather_info(stages[i].nir, nir_shader_get_entrypoint(stages[i].nir));
-      radv_nir_lower_io(device, stages[i].nir);
+   for (unsigned i = 0; i < MESA_VULKAN_SHADER_STAGES; i++)
+      nir_stages[i] = stages[i].nir;
 
-      stages[i].feedback.duration += os_time_get_nano() - stage_start;
-   }
+   nir_shaders_run_parallel(&device->nir_queue, nir_stages, MESA_VULKAN_SHADER_STAGES, radv_optimize_stage,
+                            &optimize_data);
 
    if (stages[MESA_SHADER_FRAGMENT].nir) {
       radv_nir_lower_poly_line_smooth(stages[MESA_SHADER_FRAGMENT].nir, pipeline_key);
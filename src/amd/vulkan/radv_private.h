@@ -52,6 +52,7 @@
 #include "util/list.h"
 #include "util/macros.h"
 #include "util/rwlock.h"
+#include "util/u_queue.h"
 #include "util/xmlconfig.h"
 #include "vk_alloc.h"
 #include "vk_buffer.h"
@@ -1076,6 +1077,11 @@ struct radv_device {
    uint64_t allocated_memory_size[VK_MAX_MEMORY_HEAPS];
    mtx_t overallocation_mutex;
 
+   /* Runs the per-stage NIR optimizations of a pipeline in parallel
+    * (RADV_PERFTEST=parallel_nir).
+    */
+   struct util_queue nir_queue;
+
    /* RADV_FORCE_VRS. */
    struct radv_notifier notifier;
    enum radv_force_vrs force_vrs;
@@ -1179,6 +1179,52 @@ radv_DestroyQueryPool(VkDevice _device, VkQueryPool _pool, const VkAllocationCal
    radv_destroy_query_pool(device, pAllocator, pool);
 }
 
+/* Timestamp-like queries are a single 64-bit value that doubles as the
+ * availability marker, so large ranges of them (as used by GPU profilers) can
+ * be copied out in one tight loop with the result flags decoded once.
+ */
+static VkResult
+radv_get_timestamp_query_pool_results(struct radv_query_pool *pool, uint32_t firstQuery, uint32_t queryCount,
+                                      char *data, VkDeviceSize stride, VkQueryResultFlags flags)
+{
+   const bool wait = flags & VK_QUERY_RESULT_WAIT_BIT;
+   const bool partial = flags & VK_QUERY_RESULT_PARTIAL_BIT;
+   const bool with_availability = flags & VK_QUERY_RESULT_WITH_AVAILABILITY_BIT;
+   const bool use_64bit = flags & VK_QUERY_RESULT_64_BIT;
+   const char *src = pool->ptr + firstQuery * pool->stride;
+   VkResult result = VK_SUCCESS;
+
+   for (unsigned query_idx = 0; query_idx < queryCount; ++query_idx, data += stride, src += pool->stride) {
+      p_atomic_uint64_t const *src64 = (p_atomic_uint64_t const *)src;
+      uint64_t value;
+
+      do {
+         value = p_atomic_read(src64);
+      } while (value == TIMESTAMP_NOT_READY && wait);
+
+      const bool available = value != TIMESTAMP_NOT_READY;
+
+      if (!available && !partial)
+         result = VK_NOT_READY;
+
+      if (use_64bit) {
+         uint64_t *dest = (uint64_t *)data;
+         if (available || partial)
+            dest[0] = value;
+         if (with_availability)
+            dest[1] = available;
+      } else {
+         uint32_t *dest = (uint32_t *)data;
+         if (available || partial)
+            dest[0] = (uint32_t)value;
+         if (with_availability)
+            dest[1] = available;
+      }
+   }
+
+   return result;
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL
 radv_GetQueryPoolResults(VkDevice _device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount,
                          size_t dataSize, void *pData, VkDeviceSize stride, VkQueryResultFlags flags)
@@ -1191,6 +1237,17 @@ radv_GetQueryPoolResults(VkDevice _device, VkQueryPool queryPool, uint32_t first
    if (vk_device_is_lost(&device->vk))
       return VK_ERROR_DEVICE_LOST;
 
+   switch (pool->type) {
+   case VK_QUERY_TYPE_TIMESTAMP:
+   case VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR:
+   case VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SERIALIZATION_SIZE_KHR:
+   case VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SERIALIZATION_BOTTOM_LEVEL_POINTERS_KHR:
+   case VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SIZE_KHR:
+      return radv_get_timestamp_query_pool_results(pool, firstQuery, queryCount, data, stride, flags);
+   default:
+      break;
+   }
+
    for (unsigned query_idx = 0; query_idx < queryCount; ++query_idx, data += stride) {
       char *dest = data;
       unsigned query = firstQuery + query_idx;
@@ -1198,34 +1255,6 @@ radv_GetQueryPoolResults(VkDevice _device, VkQueryPool queryPool, uint32_t first
       uint32_t available;
 
       switch (pool->type) {
-      case VK_QUERY_TYPE_TIMESTAMP:
-      case VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR:
-      case VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SERIALIZATION_SIZE_KHR:
-      case VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SERIALIZATION_BOTTOM_LEVEL_POINTERS_KHR:
-      case VK_QUERY_TYPE_ACCELERATION_STRUCTURE_SIZE_KHR: {
-         p_atomic_uint64_t const *src64 = (p_atomic_uint64_t const *)src;
-         uint64_t value;
-
-         do {
-            value = p_atomic_read(src64);
-         } while (value == TIMESTAMP_NOT_READY && (flags & VK_QUERY_RESULT_WAIT_BIT));
-
-         available = value != TIMESTAMP_NOT_READY;
-
-         if (!available && !(flags & VK_QUERY_RESULT_PARTIAL_BIT))
-            result = VK_NOT_READY;
-
-         if (flags & VK_QUERY_RESULT_64_BIT) {
-            if (available || (flags & VK_QUERY_RESULT_PARTIAL_BIT))
-               *(uint64_t *)dest = value;
-            dest += 8;
-         } else {
-            if (available || (flags & VK_QUERY_RESULT_PARTIAL_BIT))
-               *(uint32_t *)dest = (uint32_t)value;
-            dest += 4;
-         }
-         break;
-      }
       case VK_QUERY_TYPE_OCCLUSION: {
          p_atomic_uint64_t const *src64 = (p_atomic_uint64_t const *)src;
          uint32_t db_count = device->physical_device->rad_info.max_render_backends;
@@ -1118,6 +1118,8 @@ struct traversal_data {
 
    struct radv_ray_tracing_pipeline *pipeline;
    const struct radv_pipeline_key *key;
+
+   bool has_any_hit;
 };
 
 static void
@@ -1164,6 +1166,17 @@ visit_any_hit_shaders(struct radv_device *device, nir_builder *b, struct travers
       nir_pop_if(b, NULL);
 }
 
+static bool
+pipeline_has_any_hit_shaders(const struct radv_ray_tracing_pipeline *pipeline)
+{
+   for (unsigned i = 0; i < pipeline->group_count; ++i) {
+      if (pipeline->groups[i].type == VK_RAY_TRACING_SHADER_GROUP_TYPE_TRIANGLES_HIT_GROUP_KHR &&
+          pipeline->groups[i].any_hit_shader != VK_SHADER_UNUSED_KHR)
+         return true;
+   }
+   return false;
+}
+
 static void
 handle_candidate_triangle(nir_builder *b, struct radv_triangle_intersection *intersection,
                           const struct radv_ray_traversal_args *args, const struct radv_ray_flags *ray_flags)
@@ -1185,7 +1198,12 @@ handle_candidate_triangle(nir_builder *b, struct radv_triangle_intersection *int
    nir_store_var(b, data->vars->ahit_accept, nir_imm_true(b), 0x1);
    nir_store_var(b, data->vars->ahit_terminate, nir_imm_false(b), 0x1);
 
-   nir_push_if(b, nir_inot(b, intersection->base.opaque));
+   /* Without any-hit shaders every candidate triangle is accepted as is, so
+    * the SBT lookup and the inner variable copies for non-opaque hits fold
+    * away.
+    */
+   nir_ssa_def *run_any_hit = data->has_any_hit ? nir_inot(b, intersection->base.opaque) : nir_imm_false(b);
+   nir_push_if(b, run_any_hit);
    {
       struct rt_variables inner_vars = create_inner_vars(b, data->vars);
 
@@ -1429,6 +1447,7 @@ radv_build_traversal_shader(struct radv_device *device, struct radv_ray_tracing_
       .barycentrics = barycentrics,
       .pipeline = pipeline,
       .key = key,
+      .has_any_hit = pipeline_has_any_hit_shaders(pipeline),
    };
 
    struct radv_ray_traversal_args args = {
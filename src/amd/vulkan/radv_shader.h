@@ -29,6 +29,7 @@
 #define RADV_SHADER_H
 
 #include "util/mesa-blake3.h"
+#include "util/simple_mtx.h"
 #include "util/u_math.h"
 #include "vulkan/runtime/vk_pipeline_cache.h"
 #include "vulkan/vulkan.h"
@@ -30,6 +30,7 @@
 #include "drm-uapi/amdgpu_drm.h"
 
 #include "util/os_time.h"
+#include "util/u_math.h"
 #include "util/u_memory.h"
 #include "ac_debug.h"
 #include "radv_amdgpu_bo.h"
@@ -802,27 +803,35 @@ radv_amdgpu_count_cs_array_bo(struct radeon_cmdbuf **cs_array, unsigned num_cs)
    return num_bo;
 }
 
-static unsigned
-radv_amdgpu_add_cs_to_bo_list(struct radv_amdgpu_cs *cs, struct drm_amdgpu_bo_list_entry *handles, unsigned num_handles)
+/* Open-addressed set of BO handles used to deduplicate the BO list at submit time. GEM handles
+ * are never 0, so 0 marks an empty slot.
+ */
+struct radv_amdgpu_bo_set {
+   uint32_t *handles;
+   uint32_t mask;
+};
+
+static bool
+radv_amdgpu_bo_set_insert(struct radv_amdgpu_bo_set *set, uint32_t bo_handle)
 {
-   if (!cs->num_buffers)
-      return num_handles;
+   uint32_t i = bo_handle & set->mask;
 
-   if (num_handles == 0 && !cs->num_virtual_buffers) {
-      memcpy(handles, cs->handles, cs->num_buffers * sizeof(struct drm_amdgpu_bo_list_entry));
-      return cs->num_buffers;
+   while (set->handles[i]) {
+      if (set->handles[i] == bo_handle)
+         return false;
+      i = (i + 1) & set->mask;
    }
 
-   int unique_bo_so_far = num_handles;
+   set->handles[i] = bo_handle;
+   return true;
+}
+
+static unsigned
+radv_amdgpu_add_cs_to_bo_list(struct radv_amdgpu_cs *cs, struct radv_amdgpu_bo_set *set,
+                              struct drm_amdgpu_bo_list_entry *handles, unsigned num_handles)
+{
    for (unsigned j = 0; j < cs->num_buffers; ++j) {
-      bool found = false;
-      for (unsigned k = 0; k < unique_bo_so_far; ++k) {
-         if (handles[k].bo_handle == cs->handles[j].bo_handle) {
-            found = true;
-            break;
-         }
-      }
-      if (!found) {
+      if (radv_amdgpu_bo_set_insert(set, cs->handles[j].bo_handle)) {
          handles[num_handles] = cs->handles[j];
          ++num_handles;
       }
@@ -831,14 +840,7 @@ radv_amdgpu_add_cs_to_bo_list(struct radv_amdgpu_cs *cs, struct drm_amdgpu_bo_li
       struct radv_amdgpu_winsys_bo *virtual_bo = radv_amdgpu_winsys_bo(cs->virtual_buffers[j]);
       for (unsigned k = 0; k < virtual_bo->bo_count; ++k) {
          struct radv_amdgpu_winsys_bo *bo = virtual_bo->bos[k];
-         bool found = false;
-         for (unsigned m = 0; m < num_handles; ++m) {
-            if (handles[m].bo_handle == bo->bo_handle) {
-               found = true;
-               break;
-            }
-         }
-         if (!found) {
+         if (radv_amdgpu_bo_set_insert(set, bo->bo_handle)) {
             handles[num_handles].bo_handle = bo->bo_handle;
             handles[num_handles].bo_priority = bo->priority;
             ++num_handles;
@@ -850,12 +852,12 @@ radv_amdgpu_add_cs_to_bo_list(struct radv_amdgpu_cs *cs, struct drm_amdgpu_bo_li
 }
 
 static unsigned
-radv_amdgpu_add_cs_array_to_bo_list(struct radeon_cmdbuf **cs_array, unsigned num_cs,
+radv_amdgpu_add_cs_array_to_bo_list(struct radeon_cmdbuf **cs_array, unsigned num_cs, struct radv_amdgpu_bo_set *set,
                                     struct drm_amdgpu_bo_list_entry *handles, unsigned num_handles)
 {
    for (unsigned i = 0; i < num_cs; ++i) {
       for (struct radv_amdgpu_cs *cs = radv_amdgpu_cs(cs_array[i]); cs; cs = cs->chained_to) {
-         num_handles = radv_amdgpu_add_cs_to_bo_list(cs, handles, num_handles);
+         num_handles = radv_amdgpu_add_cs_to_bo_list(cs, set, handles, num_handles);
       }
    }
 
@@ -916,13 +918,27 @@ radv_amdgpu_get_bo_list(struct radv_amdgpu_winsys *ws, struct radeon_cmdbuf **cs
       if (!handles)
          return VK_ERROR_OUT_OF_HOST_MEMORY;
 
+      /* Keep the set at most half full so that probe sequences stay short. */
+      struct radv_amdgpu_bo_set set;
+      set.mask = util_next_power_of_two(total_buffer_count * 2) - 1;
+      set.handles = calloc(set.mask + 1, sizeof(uint32_t));
+      if (!set.handles) {
+         free(handles);
+         return VK_ERROR_OUT_OF_HOST_MEMORY;
+      }
+
       num_handles = radv_amdgpu_copy_global_bo_list(ws, handles);
-      num_handles = radv_amdgpu_add_cs_array_to_bo_list(cs_array, count, handles, num_handles);
-      num_handles =
-         radv_amdgpu_add_cs_array_to_bo_list(initial_preamble_array, num_initial_preambles, handles, num_handles);
+      for (unsigned i = 0; i < num_handles; ++i)
+         radv_amdgpu_bo_set_insert(&set, handles[i].bo_handle);
+
+      num_handles = radv_amdgpu_add_cs_array_to_bo_list(cs_array, count, &set, handles, num_handles);
       num_handles =
-         radv_amdgpu_add_cs_array_to_bo_list(continue_preamble_array, num_continue_preambles, handles, num_handles);
-      num_handles = radv_amdgpu_add_cs_array_to_bo_list(postamble_array, num_postambles, handles, num_handles);
+         radv_amdgpu_add_cs_array_to_bo_list(initial_preamble_array, num_initial_preambles, &set, handles, num_handles);
+      num_handles = radv_amdgpu_add_cs_array_to_bo_list(continue_preamble_array, num_continue_preambles, &set, handles,
+                                                        num_handles);
+      num_handles = radv_amdgpu_add_cs_array_to_bo_list(postamble_array, num_postambles, &set, handles, num_handles);
+
+      free(set.handles);
    }
 
    *rhandles = handles;
@@ -23,6 +23,7 @@
 
 #include "broadcom/common/v3d_device_info.h"
 #include "v3d_compiler.h"
+#include "util/os_time.h"
 #include "util/u_prim.h"
 #include "compiler/nir/nir_schedule.h"
 #include "compiler/nir/nir_builder.h"
@@ -1813,6 +1814,7 @@ uint64_t *v3d_compile(const struct v3d_compiler *compiler,
 
         uint32_t best_spill_fill_count = UINT32_MAX;
         struct v3d_compile *best_c = NULL;
+        int64_t compile_start = os_time_get_nano();
         for (int32_t strat = 0; strat < ARRAY_SIZE(strategies); strat++) {
                 /* Fallback strategy */
                 if (strat > 0) {
@@ -1846,8 +1848,24 @@ uint64_t *v3d_compile(const struct v3d_compiler *compiler,
                                      strat, &strategies[strat],
                                      strat == ARRAY_SIZE(strategies) - 1);
 
+                int64_t attempt_start = os_time_get_nano();
                 v3d_attempt_compile(c);
 
+                if (V3D_DBG(PERF)) {
+                        fprintf(stderr, "Strategy '%s' for %s prog %d/%d: "
+                                "%s, %d spills, %d fills, %.3f ms\n",
+                                strategies[strat].name,
+                                vir_get_stage_name(c),
+                                c->program_id, c->variant_id,
+                                c->compilation_result ==
+                                V3D_COMPILATION_SUCCEEDED ? "succeeded" :
+                                c->compilation_result ==
+                                V3D_COMPILATION_FAILED_REGISTER_ALLOCATION ?
+                                "RA failed" : "failed",
+                                c->spills, c->fills,
+                                (os_time_get_nano() - attempt_start) / 1e6);
+                }
+
                 /* Broken shader or driver bug */
                 if (c->compilation_result == V3D_COMPILATION_FAILED)
                         break;
@@ -1900,6 +1918,14 @@ uint64_t *v3d_compile(const struct v3d_compiler *compiler,
         if (best_c && c != best_c)
                 set_best_compile(&c, best_c);
 
+        if (V3D_DBG(PERF)) {
+                fprintf(stderr, "Compile of %s prog %d/%d took %.3f ms, "
+                        "picked strategy '%s'\n",
+                        vir_get_stage_name(c), c->program_id, c->variant_id,
+                        (os_time_get_nano() - compile_start) / 1e6,
+                        strategies[c->compile_strategy_idx].name);
+        }
+
         if (V3D_DBG(PERF) &&
             c->compilation_result !=
             V3D_COMPILATION_FAILED_REGISTER_ALLOCATION &&
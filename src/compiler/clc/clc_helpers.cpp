@@ -1139,12 +1139,15 @@ clc_link_spirv_binaries(const struct clc_linker_args *args,
                         const struct clc_logger *logger,
                         struct clc_binary *out_spirv)
 {
-   std::vector<std::vector<uint32_t>> binaries;
+   /* Hand the input objects to the linker in place instead of copying each
+    * one into a std::vector first.
+    */
+   std::vector<const uint32_t *> binaries(args->num_in_objs);
+   std::vector<size_t> binary_sizes(args->num_in_objs);
 
    for (unsigned i = 0; i < args->num_in_objs; i++) {
-      const uint32_t *data = static_cast<const uint32_t *>(args->in_objs[i]->data);
-      std::vector<uint32_t> bin(data, data + (args->in_objs[i]->size / 4));
-      binaries.push_back(bin);
+      binaries[i] = static_cast<const uint32_t *>(args->in_objs[i]->data);
+      binary_sizes[i] = args->in_objs[i]->size / 4;
    }
 
    SPIRVMessageConsumer msgconsumer(logger);
@@ -1154,7 +1157,9 @@ clc_link_spirv_binaries(const struct clc_linker_args *args,
    options.SetAllowPartialLinkage(args->create_library);
    options.SetCreateLibrary(args->create_library);
    std::vector<uint32_t> linkingResult;
-   spv_result_t status = spvtools::Link(context, binaries, &linkingResult, options);
+   spv_result_t status = spvtools::Link(context, binaries.data(),
+                                        binary_sizes.data(), binaries.size(),
+                                        &linkingResult, options);
    if (status != SPV_SUCCESS) {
       return -1;
    }
@@ -1486,6 +1486,11 @@ add_builtin_define(glcpp_parser_t *parser, const char *name, int value)
  */
 #define INITIAL_PP_OUTPUT_BUF_SIZE 4048
 
+/* Expected number of predefined macros: the extension macros plus a few
+ * version and profile macros.
+ */
+#define GLCPP_BUILTIN_DEFINES_RESERVE 256
+
 glcpp_parser_t *
 glcpp_parser_create(struct gl_context *gl_ctx,
                     glcpp_extension_iterator extensions, void *state)
@@ -2519,10 +2524,16 @@ _glcpp_parser_handle_version_declaration(glcpp_parser_t *parser, intmax_t versio
    if (version >= 130 || parser->is_gles)
       add_builtin_define (parser, "GL_FRAGMENT_PRECISION_HIGH", 1);
 
-   /* Add all the extension macros available in this context */
-   if (parser->extensions)
+   /* Add all the extension macros available in this context. There are a
+    * couple hundred of them, so size the table once up front instead of
+    * growing it one size step at a time.
+    */
+   if (parser->extensions) {
+      _mesa_hash_table_reserve(parser->defines,
+                               GLCPP_BUILTIN_DEFINES_RESERVE);
       parser->extensions(parser->state, add_builtin_define, parser,
                          version, parser->is_gles);
+   }
 
    if (parser->extension_list) {
       /* If MESA_shader_integer_functions is supported, then the building
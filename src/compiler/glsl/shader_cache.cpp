@@ -60,6 +60,7 @@
 #include "serialize.h"
 #include "shader_cache.h"
 #include "util/mesa-sha1.h"
+#include "util/u_dynarray.h"
 #include "string_to_uint_map.h"
 #include "main/mtypes.h"
 
@@ -76,11 +77,50 @@ compile_shaders(struct gl_context *ctx, struct gl_shader_program *prog) {
    }
 }
 
+struct binding {
+   const char *name;
+   unsigned value;
+};
+
+static void
+collect_binding(const char *key, unsigned value, void *closure)
+{
+   struct util_dynarray *bindings = (struct util_dynarray *) closure;
+   struct binding b = { key, value };
+   util_dynarray_append(bindings, struct binding, b);
+}
+
+static int
+compare_binding(const void *a, const void *b)
+{
+   return strcmp(((const struct binding *) a)->name,
+                 ((const struct binding *) b)->name);
+}
+
+/**
+ * Append the bindings of \p map to \p buf sorted by name, so that the
+ * cache key doesn't depend on the order the application made the
+ * glBind*Location calls in or on the hash table layout.
+ */
 static void
-create_binding_str(const char *key, unsigned value, void *closure)
+append_bindings_str(char **buf, const char *prefix,
+                    string_to_uint_map *map)
 {
-   char **bindings_str = (char **) closure;
-   ralloc_asprintf_append(bindings_str, "%s:%u,", key, value);
+   struct util_dynarray bindings;
+   util_dynarray_init(&bindings, NULL);
+
+   map->iterate(collect_binding, &bindings);
+   if (bindings.size) {
+      qsort(bindings.data,
+            util_dynarray_num_elements(&bindings, struct binding),
+            sizeof(struct binding), compare_binding);
+   }
+
+   ralloc_strcat(buf, prefix);
+   util_dynarray_foreach(&bindings, struct binding, b)
+      ralloc_asprintf_append(buf, "%s:%u,", b->name, b->value);
+
+   util_dynarray_fini(&bindings);
 }
 
 void
@@ -159,12 +199,10 @@ shader_cache_read_program_metadata(struct gl_context *ctx,
    /* Include bindings when creating sha1. These bindings change the resulting
     * binary so they are just as important as the shader source.
     */
-   char *buf = ralloc_strdup(NULL, "vb: ");
-   prog->AttributeBindings->iterate(create_binding_str, &buf);
-   ralloc_strcat(&buf, "fb: ");
-   prog->FragDataBindings->iterate(create_binding_str, &buf);
-   ralloc_strcat(&buf, "fbi: ");
-   prog->FragDataIndexBindings->iterate(create_binding_str, &buf);
+   char *buf = ralloc_strdup(NULL, "");
+   append_bindings_str(&buf, "vb: ", prog->AttributeBindings);
+   append_bindings_str(&buf, "fb: ", prog->FragDataBindings);
+   append_bindings_str(&buf, "fbi: ", prog->FragDataIndexBindings);
    ralloc_asprintf_append(&buf, "tf: %d ", prog->TransformFeedback.BufferMode);
    for (unsigned int i = 0; i < prog->TransformFeedback.NumVarying; i++) {
       ralloc_asprintf_append(&buf, "%s ",
@@ -215,6 +253,12 @@ shader_cache_read_program_metadata(struct gl_context *ctx,
    uint8_t *buffer = (uint8_t *) disk_cache_get(cache, prog->data->sha1,
                                                 &size);
    if (buffer == NULL) {
+      if (ctx->_Shader->Flags & GLSL_CACHE_INFO) {
+         _mesa_sha1_format(sha1buf, prog->data->sha1);
+         fprintf(stderr, "shader program meta data not in cache: %s\n",
+                 sha1buf);
+      }
+
       /* Cached program not found. We may have seen the individual shaders
        * before and skipped compiling but they may not have been used together
        * in this combination before. Fall back to linking shaders but first
@@ -2880,7 +2880,9 @@ typedef struct nir_block {
    unsigned num_dom_children;
    struct nir_block **dom_children;
 
-   /* Set of nir_blocks on the dominance frontier of this block */
+   /* Set of nir_blocks on the dominance frontier of this block.  This is
+    * NULL until dominance metadata is first computed for the block.
+    */
    struct set *dom_frontier;
 
    /*
@@ -4723,6 +4725,15 @@ void nir_shader_replace(nir_shader *dest, nir_shader *src);
 
 void nir_shader_serialize_deserialize(nir_shader *s);
 
+struct util_queue;
+
+typedef void (*nir_shader_job_func)(nir_shader *shader, unsigned index,
+                                    void *data);
+
+void nir_shaders_run_parallel(struct util_queue *queue,
+                              nir_shader **shaders, unsigned num_shaders,
+                              nir_shader_job_func func, void *data);
+
 #ifndef NDEBUG
 void nir_validate_shader(nir_shader *shader, const char *when);
 void nir_validate_ssa_dominance(nir_shader *shader, const char *when);
@@ -4803,6 +4814,44 @@ static inline bool should_print_nir(UNUSED nir_shader *shader) { return false; }
       nir_print_shader(nir, stdout);                                 \
 )
 
+/* Variants of NIR_PASS for optimization loops that run a sequence of
+ * passes until none of them makes progress.
+ *
+ * idempotent_set records the passes that made no progress since the shader
+ * last changed: running them again can't do anything, so they are skipped
+ * until another pass in the loop makes progress and clears the set.  Passes
+ * that can make progress when run twice in a row on the same shader must
+ * use NIR_LOOP_PASS_NOT_IDEMPOTENT, which still clears the set but never
+ * adds the pass to it.  Any change made to the shader outside of these
+ * macros inside the loop must clear the set as well.  idempotent_set may be
+ * NULL (e.g. if allocating it failed), in which case no pass is skipped.
+ */
+#define NIR_LOOP_PASS(progress, idempotent_set, nir, pass, ...) do {  \
+   bool nir_loop_pass_progress = false;                               \
+   if (!idempotent_set ||                                             \
+       !_mesa_set_search(idempotent_set, (void *)pass))               \
+      NIR_PASS(nir_loop_pass_progress, nir, pass, ##__VA_ARGS__);     \
+   if (nir_loop_pass_progress) {                                      \
+      UNUSED bool _;                                                  \
+      _mesa_set_clear(idempotent_set, NULL);                          \
+      progress = true;                                                \
+   } else if (idempotent_set) {                                       \
+      _mesa_set_add(idempotent_set, (void *)pass);                    \
+   }                                                                  \
+} while (0)
+
+#define NIR_LOOP_PASS_NOT_IDEMPOTENT(progress, idempotent_set, nir, pass, ...) do { \
+   bool nir_loop_pass_progress = false;                               \
+   if (!idempotent_set ||                                             \
+       !_mesa_set_search(idempotent_set, (void *)pass))               \
+      NIR_PASS(nir_loop_pass_progress, nir, pass, ##__VA_ARGS__);     \
+   if (nir_loop_pass_progress) {                                      \
+      UNUSED bool _;                                                  \
+      _mesa_set_clear(idempotent_set, NULL);                          \
+      progress = true;                                                \
+   }                                                                  \
+} while (0)
+
 #define NIR_SKIP(name) should_skip_nir(#name)
 
 /** An instruction filtering callback with writemask
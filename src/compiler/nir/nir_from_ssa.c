@@ -35,6 +35,7 @@
 struct from_ssa_state {
    nir_builder builder;
    void *dead_ctx;
+   void *lin_ctx;
    struct exec_list dead_instrs;
    bool phi_webs_only;
    bool reg_intrinsics;
@@ -158,12 +159,12 @@ get_merge_node(nir_ssa_def *def, struct from_ssa_state *state)
    if (entry)
       return entry->data;
 
-   merge_set *set = rzalloc(state->dead_ctx, merge_set);
+   merge_set *set = linear_zalloc_child(state->lin_ctx, sizeof(*set));
    exec_list_make_empty(&set->nodes);
    set->size = 1;
    set->divergent = def->divergent;
 
-   merge_node *node = ralloc(state->dead_ctx, merge_node);
+   merge_node *node = linear_alloc_child(state->lin_ctx, sizeof(*node));
    node->set = set;
    node->def = def;
    exec_list_push_head(&set->nodes, &node->node);
@@ -1346,6 +1347,7 @@ nir_convert_from_ssa_impl(nir_function_impl *impl,
 
    state.builder = nir_builder_create(impl);
    state.dead_ctx = ralloc_context(NULL);
+   state.lin_ctx = linear_alloc_parent(state.dead_ctx, 0);
    state.phi_webs_only = phi_webs_only;
    state.reg_intrinsics = reg_intrinsics;
    state.merge_node_table = _mesa_pointer_hash_table_create(NULL);
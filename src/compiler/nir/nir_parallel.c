@@ -0,0 +1,97 @@
+/*
+ * Copyright 2023 The Mesa Authors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "nir.h"
+#include "util/u_queue.h"
+
+/**
+ * \file nir_parallel.c
+ *
+ * Runs the same processing, typically a driver's optimization loop, on a
+ * set of independent shaders using a util_queue.
+ *
+ * NIR passes only ever touch the shader they run on, so as long as the
+ * shaders don't share any memory this is safe, and the result is the same
+ * as running them one after the other.  In particular, each shader must be
+ * its own ralloc context and must not be the ralloc parent of another one
+ * of the set: nir_sweep() and NIR_DEBUG=clone re-parent the children of a
+ * shader.
+ */
+
+struct nir_shader_job {
+   struct util_queue_fence fence;
+   nir_shader *shader;
+   unsigned index;
+   nir_shader_job_func func;
+   void *data;
+};
+
+static void
+nir_shader_job_execute(void *data, void *gdata, int thread_index)
+{
+   struct nir_shader_job *job = data;
+
+   job->func(job->shader, job->index, job->data);
+}
+
+/**
+ * Call func(shaders[i], i, data) for every non-NULL shader of the array.
+ *
+ * All but one of the calls are queued on queue and the last one is run on
+ * the calling thread, which then waits for the others.  With a NULL or
+ * uninitialized queue, or on allocation failure, everything runs in order
+ * on the calling thread.
+ */
+void
+nir_shaders_run_parallel(struct util_queue *queue,
+                         nir_shader **shaders, unsigned num_shaders,
+                         nir_shader_job_func func, void *data)
+{
+   unsigned num_jobs = 0;
+
+   for (unsigned i = 0; i < num_shaders; i++) {
+      if (shaders[i])
+         num_jobs++;
+   }
+
+   struct nir_shader_job *jobs = NULL;
+   if (num_jobs > 1 && queue && util_queue_is_initialized(queue))
+      jobs = calloc(num_jobs - 1, sizeof(*jobs));
+
+   if (!jobs) {
+      for (unsigned i = 0; i < num_shaders; i++) {
+         if (shaders[i])
+            func(shaders[i], i, data);
+      }
+      return;
+   }
+
+   unsigned j = 0;
+   for (unsigned i = 0; i < num_shaders; i++) {
+      if (!shaders[i])
+         continue;
+
+      if (j == num_jobs - 1) {
+         func(shaders[i], i, data);
+         break;
+      }
+
+      struct nir_shader_job *job = &jobs[j++];
+      util_queue_fence_init(&job->fence);
+      job->shader = shaders[i];
+      job->index = i;
+      job->func = func;
+      job->data = data;
+      util_queue_add_job(queue, job, &job->fence,
+                         nir_shader_job_execute, NULL, 0);
+   }
+
+   for (unsigned i = 0; i < num_jobs - 1; i++) {
+      util_queue_fence_wait(&jobs[i].fence);
+      util_queue_fence_destroy(&jobs[i].fence);
+   }
+
+   free(jobs);
+}
@@ -859,10 +859,21 @@ nir_algebraic_instr(nir_builder *build, nir_instr *instr,
    for (const struct transform *xform = &table->transforms[table->transform_offsets[xform_idx]];
         xform->condition_offset != ~0;
         xform++) {
+      const nir_search_expression *search =
+         &table->values[xform->search].expression;
+
+      /* The automaton state only encodes the opcode tree, not bit sizes, so
+       * a state reached by a 32-bit instruction still lists every 16- and
+       * 64-bit specialization of the same pattern.  Reject those here
+       * before nir_replace_instr() sets up a match and walks all of the
+       * commutative combinations only to fail on the root.
+       */
+      if (search->value.bit_size > 0 && search->value.bit_size != bit_size)
+         continue;
+
       if (condition_flags[xform->condition_offset] &&
-          !(table->values[xform->search].expression.inexact && ignore_inexact) &&
-          nir_replace_instr(build, alu, range_ht, states, table,
-                            &table->values[xform->search].expression,
+          !(search->inexact && ignore_inexact) &&
+          nir_replace_instr(build, alu, range_ht, states, table, search,
                             &table->values[xform->replace].value, worklist, dead_instrs)) {
          _mesa_hash_table_clear(range_ht, NULL);
          return true;
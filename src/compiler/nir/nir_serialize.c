@@ -71,6 +71,9 @@ typedef struct {
 
    struct blob_reader *blob;
 
+   /* the function impl currently being read */
+   nir_function_impl *impl;
+
    /* the next index to assign to a NIR in-memory object */
    uint32_t next_idx;
 
@@ -112,6 +115,19 @@ read_add_object(read_ctx *ctx, void *obj)
    ctx->idx_table[ctx->next_idx++] = obj;
 }
 
+/* Register a deserialized SSA def and give it its index right away.  Defs
+ * are created before their instruction is inserted, so otherwise
+ * nir_instr_insert() would have to walk up the CF tree to find the impl for
+ * every single def.
+ */
+static void
+read_add_def(read_ctx *ctx, nir_ssa_def *def)
+{
+   assert(def->index == UINT_MAX);
+   def->index = ctx->impl->ssa_alloc++;
+   read_add_object(ctx, def);
+}
+
 static void *
 read_lookup_object(read_ctx *ctx, uint32_t idx)
 {
@@ -778,7 +794,7 @@ read_dest(read_ctx *ctx, nir_dest *dst, nir_instr *instr,
          num_components = decode_num_components_in_3bits(dest.ssa.num_components);
       nir_ssa_dest_init(instr, dst, num_components, bit_size);
       dst->ssa.divergent = dest.ssa.divergent;
-      read_add_object(ctx, &dst->ssa);
+      read_add_def(ctx, &dst->ssa);
    } else {
       dst->reg.reg = read_object(ctx);
       dst->reg.base_offset = blob_read_uint32(ctx->blob);
@@ -1460,7 +1476,7 @@ read_load_const(read_ctx *ctx, union packed_instr header)
       break;
    }
 
-   read_add_object(ctx, &lc->def);
+   read_add_def(ctx, &lc->def);
    return lc;
 }
 
@@ -1489,7 +1505,7 @@ read_ssa_undef(read_ctx *ctx, union packed_instr header)
 
    undef->def.divergent = false;
 
-   read_add_object(ctx, &undef->def);
+   read_add_def(ctx, &undef->def);
    return undef;
 }
 
@@ -2004,6 +2020,7 @@ static nir_function_impl *
 read_function_impl(read_ctx *ctx)
 {
    nir_function_impl *fi = nir_function_impl_create_bare(ctx->nir);
+   ctx->impl = fi;
 
    fi->structured = blob_read_uint8(ctx->blob);
    bool preamble = blob_read_uint8(ctx->blob);
@@ -2019,6 +2036,7 @@ read_function_impl(read_ctx *ctx)
    read_fixup_phis(ctx);
 
    fi->valid_metadata = 0;
+   ctx->impl = NULL;
 
    return fi;
 }
@@ -72,6 +72,9 @@ sweep_block(nir_shader *nir, nir_block *block)
    ralloc_free(block->live_out);
    block->live_out = NULL;
 
+   ralloc_free(block->dom_frontier);
+   block->dom_frontier = NULL;
+
    nir_foreach_instr(instr, block) {
       gc_mark_live(nir->gctx, instr);
 
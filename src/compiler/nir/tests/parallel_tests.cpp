@@ -0,0 +1,133 @@
+/*
+ * Copyright 2023 The Mesa Authors
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <gtest/gtest.h>
+
+#include "nir.h"
+#include "nir_builder.h"
+#include "util/u_atomic.h"
+#include "util/u_queue.h"
+
+namespace {
+
+#define NUM_SHADERS 6
+
+class nir_parallel_test : public ::testing::Test {
+protected:
+   nir_parallel_test();
+   ~nir_parallel_test();
+
+   nir_shader *shaders[NUM_SHADERS];
+   struct util_queue queue;
+};
+
+nir_parallel_test::nir_parallel_test()
+{
+   glsl_type_singleton_init_or_ref();
+
+   static const nir_shader_compiler_options options = { };
+   for (unsigned i = 0; i < NUM_SHADERS; i++) {
+      nir_builder b = nir_builder_init_simple_shader(MESA_SHADER_COMPUTE, &options,
+                                                     "parallel test %u", i);
+
+      /* Give every shader a different amount of dead code. */
+      nir_ssa_def *def = nir_imm_int(&b, i);
+      for (unsigned j = 0; j <= i; j++)
+         def = nir_iadd_imm(&b, def, j);
+
+      shaders[i] = b.shader;
+   }
+
+   util_queue_init(&queue, "nir_test", 8, 3, 0, NULL);
+}
+
+nir_parallel_test::~nir_parallel_test()
+{
+   util_queue_destroy(&queue);
+
+   for (unsigned i = 0; i < NUM_SHADERS; i++)
+      ralloc_free(shaders[i]);
+
+   glsl_type_singleton_decref();
+}
+
+struct run_state {
+   nir_shader **shaders;
+   int calls[NUM_SHADERS];
+};
+
+static void
+run_dce(nir_shader *shader, unsigned index, void *data)
+{
+   struct run_state *state = (struct run_state *)data;
+
+   EXPECT_EQ(shader, state->shaders[index]);
+   p_atomic_inc(&state->calls[index]);
+
+   NIR_PASS_V(shader, nir_opt_dce);
+}
+
+static unsigned
+count_instrs(nir_shader *shader)
+{
+   unsigned count = 0;
+
+   nir_foreach_block(block, nir_shader_get_entrypoint(shader)) {
+      nir_foreach_instr(instr, block)
+         count++;
+   }
+
+   return count;
+}
+
+} /* namespace */
+
+TEST_F(nir_parallel_test, runs_every_shader_once)
+{
+   struct run_state state = { shaders, { 0 } };
+
+   nir_shaders_run_parallel(&queue, shaders, NUM_SHADERS, run_dce, &state);
+
+   for (unsigned i = 0; i < NUM_SHADERS; i++) {
+      EXPECT_EQ(state.calls[i], 1);
+      EXPECT_EQ(count_instrs(shaders[i]), 0);
+   }
+}
+
+TEST_F(nir_parallel_test, skips_null_shaders)
+{
+   struct run_state state = { shaders, { 0 } };
+   nir_shader *sparse[NUM_SHADERS] = { NULL };
+
+   sparse[1] = shaders[1];
+   sparse[4] = shaders[4];
+
+   nir_shaders_run_parallel(&queue, sparse, NUM_SHADERS, run_dce, &state);
+
+   for (unsigned i = 0; i < NUM_SHADERS; i++)
+      EXPECT_EQ(state.calls[i], sparse[i] ? 1 : 0);
+
+   EXPECT_EQ(count_instrs(shaders[1]), 0);
+   EXPECT_NE(count_instrs(shaders[2]), 0);
+}
+
+TEST_F(nir_parallel_test, matches_serial)
+{
+   nir_shader *serial[NUM_SHADERS];
+   struct run_state state = { serial, { 0 } };
+
+   for (unsigned i = 0; i < NUM_SHADERS; i++)
+      serial[i] = nir_shader_clone(NULL, shaders[i]);
+
+   nir_shaders_run_parallel(NULL, serial, NUM_SHADERS, run_dce, &state);
+
+   state.shaders = shaders;
+   nir_shaders_run_parallel(&queue, shaders, NUM_SHADERS, run_dce, &state);
+
+   for (unsigned i = 0; i < NUM_SHADERS; i++) {
+      EXPECT_EQ(count_instrs(shaders[i]), count_instrs(serial[i]));
+      ralloc_free(serial[i]);
+   }
+}
@@ -178,6 +178,7 @@ vtn_cfg_handle_prepass_instruction(struct vtn_builder *b, SpvOp opcode,
       b->func->linkage = SpvLinkageTypeMax;
       b->func->control = w[3];
       list_inithead(&b->func->constructs);
+      util_dynarray_init(&b->func->callees, b);
 
       UNUSED const struct glsl_type *result_type = vtn_get_type(b, w[1])->type;
       struct vtn_value *val = vtn_push_value(b, w[2], vtn_value_type_function);
@@ -284,6 +285,11 @@ vtn_cfg_handle_prepass_instruction(struct vtn_builder *b, SpvOp opcode,
       break;
    }
 
+   case SpvOpFunctionCall:
+      vtn_assert(b->func);
+      util_dynarray_append(&b->func->callees, uint32_t, w[3]);
+      break;
+
    case SpvOpSelectionMerge:
    case SpvOpLoopMerge:
       vtn_assert(b->block && b->block->merge == NULL);
@@ -384,12 +390,48 @@ vtn_parse_switch(struct vtn_builder *b,
    _mesa_hash_table_destroy(block_to_case, NULL);
 }
 
+/* Mark every function reachable from the entry point through OpFunctionCall
+ * as referenced, so that the rest of the CFG work and the NIR emission can
+ * skip the functions only used by other entry points of the module.
+ */
+static void
+vtn_mark_referenced_functions(struct vtn_builder *b)
+{
+   struct util_dynarray worklist;
+   util_dynarray_init(&worklist, NULL);
+
+   struct vtn_function *entry = b->entry_point->func;
+   entry->referenced = true;
+   util_dynarray_append(&worklist, struct vtn_function *, entry);
+
+   while (util_dynarray_num_elements(&worklist, struct vtn_function *)) {
+      struct vtn_function *func =
+         util_dynarray_pop(&worklist, struct vtn_function *);
+
+      util_dynarray_foreach(&func->callees, uint32_t, id) {
+         struct vtn_function *callee =
+            vtn_value(b, *id, vtn_value_type_function)->func;
+         if (!callee->referenced) {
+            callee->referenced = true;
+            util_dynarray_append(&worklist, struct vtn_function *, callee);
+         }
+      }
+   }
+
+   util_dynarray_fini(&worklist);
+}
+
 void
 vtn_build_cfg(struct vtn_builder *b, const uint32_t *words, const uint32_t *end)
 {
    vtn_foreach_instruction(b, words, end,
                            vtn_cfg_handle_prepass_instruction);
 
+   if (!b->options->create_library) {
+      vtn_assert(b->entry_point->value_type == vtn_value_type_function);
+      vtn_mark_referenced_functions(b);
+   }
+
    if (b->shader->info.stage == MESA_SHADER_KERNEL)
       return;
 
@@ -205,6 +205,11 @@ struct vtn_function {
    SpvLinkageType linkage;
    SpvFunctionControlMask control;
 
+   /* SPIR-V IDs of the functions called by OpFunctionCall in this function,
+    * used to find the functions reachable from the entry point.
+    */
+   struct util_dynarray callees;
+
    unsigned block_count;
 
    /* Ordering of blocks to be processed by structured control flow.  See
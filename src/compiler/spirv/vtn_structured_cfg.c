@@ -1085,6 +1085,10 @@ void
 vtn_build_structured_cfg(struct vtn_builder *b, const uint32_t *words, const uint32_t *end)
 {
    vtn_foreach_function(func, &b->functions) {
+      /* Functions not reachable from the entry point are never emitted. */
+      if (!b->options->create_library && !func->referenced)
+         continue;
+
       b->func = func;
 
       sort_blocks(b);
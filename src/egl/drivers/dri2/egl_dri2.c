@@ -627,9 +627,23 @@ dri2_add_pbuffer_configs_for_visuals(_EGLDisplay *disp)
    unsigned int config_count = 0;
 
    for (unsigned i = 0; dri2_dpy->driver_configs[i] != NULL; i++) {
+      int shifts[4];
+      unsigned int sizes[4];
+
+      /* Reject the visuals which can't match before walking all of the
+       * config's attributes in dri2_add_config.
+       */
+      dri2_get_shifts_and_sizes(dri2_dpy->core, dri2_dpy->driver_configs[i],
+                                shifts, sizes);
+
       for (unsigned j = 0; j < ARRAY_SIZE(dri2_pbuffer_visuals); j++) {
          struct dri2_egl_config *dri2_conf;
 
+         if (memcmp(dri2_pbuffer_visuals[j].rgba_shifts, shifts,
+                    sizeof(shifts)) ||
+             memcmp(dri2_pbuffer_visuals[j].rgba_sizes, sizes, sizeof(sizes)))
+            continue;
+
          dri2_conf = dri2_add_config(disp, dri2_dpy->driver_configs[i],
                                      config_count + 1, EGL_PBUFFER_BIT, NULL,
                                      dri2_pbuffer_visuals[j].rgba_shifts,
@@ -1370,19 +1370,16 @@ depends_on(struct ir3_instruction *instr, struct ir3_instruction *prior)
 }
 
 static void
-add_barrier_deps(struct ir3_block *block, struct ir3_instruction *instr)
+add_barrier_deps(struct ir3_instruction **instrs, unsigned count,
+                 unsigned idx)
 {
-   struct list_head *prev = instr->node.prev;
-   struct list_head *next = instr->node.next;
+   struct ir3_instruction *instr = instrs[idx];
 
    /* add dependencies on previous instructions that must be scheduled
     * prior to the current instruction
     */
-   while (prev != &block->instr_list) {
-      struct ir3_instruction *pi =
-         list_entry(prev, struct ir3_instruction, node);
-
-      prev = prev->prev;
+   for (int i = (int)idx - 1; i >= 0; i--) {
+      struct ir3_instruction *pi = instrs[i];
 
       if (is_meta(pi))
          continue;
@@ -1399,11 +1396,8 @@ add_barrier_deps(struct ir3_block *block, struct ir3_instruction *instr)
    /* add dependencies on this instruction to following instructions
     * that must be scheduled after the current instruction:
     */
-   while (next != &block->instr_list) {
-      struct ir3_instruction *ni =
-         list_entry(next, struct ir3_instruction, node);
-
-      next = next->next;
+   for (unsigned i = idx + 1; i < count; i++) {
+      struct ir3_instruction *ni = instrs[i];
 
       if (is_meta(ni))
          continue;
@@ -1433,12 +1427,36 @@ ir3_sched_add_deps(struct ir3 *ir)
    bool progress = false;
 
    foreach_block (block, &ir->block_list) {
+      /* Only instructions with a barrier class or conflict can end up with
+       * a barrier dependency (see depends_on()), so gather those first
+       * rather than walking the whole block for each barrier, which gets
+       * quadratic for large shaders.
+       */
+      unsigned count = 0;
       foreach_instr (instr, &block->instr_list) {
-         if (instr->barrier_class) {
-            add_barrier_deps(block, instr);
+         if (instr->barrier_class || instr->barrier_conflict)
+            count++;
+      }
+
+      if (!count)
+         continue;
+
+      struct ir3_instruction **instrs =
+         ralloc_array(NULL, struct ir3_instruction *, count);
+      unsigned i = 0;
+      foreach_instr (instr, &block->instr_list) {
+         if (instr->barrier_class || instr->barrier_conflict)
+            instrs[i++] = instr;
+      }
+
+      for (i = 0; i < count; i++) {
+         if (instrs[i]->barrier_class) {
+            add_barrier_deps(instrs, count, i);
             progress = true;
          }
       }
+
+      ralloc_free(instrs);
    }
 
    return progress;
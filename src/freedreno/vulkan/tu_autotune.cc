@@ -11,6 +11,10 @@
 #include "tu_image.h"
 #include "tu_pass.h"
 
+#include "util/blob.h"
+#include "util/disk_cache.h"
+#include "util/u_process.h"
+
 /* How does it work?
  *
  * - For each renderpass we calculate the number of samples passed
@@ -72,6 +76,11 @@ struct tu_renderpass_history {
    uint32_t num_results;
 
    uint32_t avg_samples;
+
+   /* avg_samples was loaded from the disk cache and no result has been
+    * added in this run yet.
+    */
+   bool persisted;
 };
 
 /* Holds per-submission cs which writes the fence. */
@@ -195,7 +204,7 @@ get_history(struct tu_autotune *at, uint64_t rp_key, uint32_t *avg_samples)
    if (entry) {
       struct tu_renderpass_history *history =
          (struct tu_renderpass_history *) entry->data;
-      if (history->num_results > 0) {
+      if (history->num_results > 0 || history->persisted) {
          *avg_samples = p_atomic_read(&history->avg_samples);
          has_history = true;
       }
@@ -221,6 +230,7 @@ history_add_result(struct tu_device *dev, struct tu_renderpass_history *history,
 {
    list_delinit(&result->node);
    list_add(&result->node, &history->results);
+   history->persisted = false;
 
    if (history->num_results < MAX_HISTORY_RESULTS) {
       history->num_results++;
@@ -390,6 +400,101 @@ renderpass_key_hash(const void *_a)
    return *((uint64_t *) _a) & 0xffffffff;
 }
 
+/* The history of the previous run is stored in the disk cache under this
+ * key, as an array of (renderpass key, avg_samples) pairs, so that a new
+ * process doesn't start from the fallback heuristic for every renderpass.
+ * The key includes the executable and the application/engine info, since
+ * renderpass keys of different applications have nothing in common.
+ */
+static void
+compute_history_cache_key(struct tu_autotune *at, struct disk_cache *cache,
+                          cache_key key)
+{
+   const struct vk_app_info *app_info = &at->device->instance->vk.app_info;
+   const char *process_name = util_get_process_name();
+
+   struct blob blob;
+   blob_init(&blob);
+   blob_write_string(&blob, "tu_autotune_history");
+   blob_write_string(&blob, process_name ? process_name : "");
+   blob_write_string(&blob, app_info->app_name ? app_info->app_name : "");
+   blob_write_uint32(&blob, app_info->app_version);
+   blob_write_string(&blob, app_info->engine_name ? app_info->engine_name : "");
+   blob_write_uint32(&blob, app_info->engine_version);
+
+   disk_cache_compute_key(cache, blob.data, blob.size, key);
+   blob_finish(&blob);
+}
+
+static void
+load_history(struct tu_autotune *at, struct disk_cache *cache)
+{
+   cache_key key;
+   compute_history_cache_key(at, cache, key);
+
+   size_t size;
+   void *data = disk_cache_get(cache, key, &size);
+   if (!data)
+      return;
+
+   struct blob_reader blob;
+   blob_reader_init(&blob, data, size);
+
+   uint32_t count = blob_read_uint32(&blob);
+   for (uint32_t i = 0; i < count; i++) {
+      uint64_t rp_key = blob_read_uint64(&blob);
+      uint32_t avg_samples = blob_read_uint32(&blob);
+      if (blob.overrun)
+         break;
+
+      if (_mesa_hash_table_search(at->ht, &rp_key))
+         continue;
+
+      struct tu_renderpass_history *history =
+         (struct tu_renderpass_history *) calloc(1, sizeof(*history));
+      if (!history)
+         break;
+
+      history->key = rp_key;
+      history->avg_samples = avg_samples;
+      history->persisted = true;
+      list_inithead(&history->results);
+      _mesa_hash_table_insert(at->ht, &history->key, history);
+   }
+
+   free(data);
+}
+
+static void
+store_history(struct tu_autotune *at, struct disk_cache *cache)
+{
+   struct blob blob;
+   blob_init(&blob);
+
+   uint32_t count = 0;
+   intptr_t count_offset = blob_reserve_uint32(&blob);
+   hash_table_foreach(at->ht, entry) {
+      struct tu_renderpass_history *history =
+         (struct tu_renderpass_history *) entry->data;
+      if (history->num_results == 0 && !history->persisted)
+         continue;
+
+      blob_write_uint64(&blob, history->key);
+      blob_write_uint32(&blob, history->avg_samples);
+      count++;
+   }
+
+   if (count_offset >= 0 && !blob.out_of_memory) {
+      blob_overwrite_uint32(&blob, count_offset, count);
+
+      cache_key key;
+      compute_history_cache_key(at, cache, key);
+      disk_cache_put(cache, key, blob.data, blob.size, NULL);
+   }
+
+   blob_finish(&blob);
+}
+
 VkResult
 tu_autotune_init(struct tu_autotune *at, struct tu_device *dev)
 {
@@ -407,6 +512,9 @@ tu_autotune_init(struct tu_autotune *at, struct tu_device *dev)
    /* start from 1 because tu6_global::autotune_fence is initialized to 0 */
    at->fence_counter = 1;
 
+   if (dev->physical_device->vk.disk_cache)
+      load_history(at, dev->physical_device->vk.disk_cache);
+
    return VK_SUCCESS;
 }
 
@@ -428,6 +536,9 @@ tu_autotune_fini(struct tu_autotune *at, struct tu_device *dev)
       }
    }
 
+   if (dev->physical_device->vk.disk_cache)
+      store_history(at, dev->physical_device->vk.disk_cache);
+
    tu_autotune_free_results(dev, &at->pending_results);
 
    mtx_lock(&dev->autotune_mutex);
@@ -12,6 +12,7 @@
 #include <fcntl.h>
 #include <poll.h>
 #include <sys/sysinfo.h>
+#include <unistd.h>
 
 #include "git_sha1.h"
 #include "util/u_debug.h"
@@ -2131,6 +2132,18 @@ tu_CreateDevice(VkPhysicalDevice physicalDevice,
       }
    }
 
+   /* Like ir3_gallium, use half of the cores.  If the queue can't be
+    * created, the variants are simply compiled serially.
+    */
+   unsigned num_compile_threads = sysconf(_SC_NPROCESSORS_ONLN) / 2;
+   if (num_compile_threads > 1) {
+      util_queue_init(&device->compile_queue, "tu_compile", 16,
+                      num_compile_threads,
+                      UTIL_QUEUE_INIT_RESIZE_IF_FULL |
+                         UTIL_QUEUE_INIT_SET_FULL_THREAD_AFFINITY,
+                      NULL);
+   }
+
    /* initial sizes, these will increase if there is overflow */
    device->vsc_draw_strm_pitch = 0x1000 + VSC_PAD;
    device->vsc_prim_strm_pitch = 0x4000 + VSC_PAD;
@@ -2307,6 +2320,8 @@ fail_global_bo_map:
    tu_bo_finish(device, device->global_bo);
    vk_free(&device->vk.alloc, device->bo_list);
 fail_global_bo:
+   if (util_queue_is_initialized(&device->compile_queue))
+      util_queue_destroy(&device->compile_queue);
    ir3_compiler_destroy(device->compiler);
    util_sparse_array_finish(&device->bo_map);
    if (physical_device->has_set_iova)
@@ -2354,6 +2369,9 @@ tu_DestroyDevice(VkDevice _device, const VkAllocationCallbacks *pAllocator)
 
    tu_destroy_dynamic_rendering(device);
 
+   if (util_queue_is_initialized(&device->compile_queue))
+      util_queue_destroy(&device->compile_queue);
+
    ir3_compiler_destroy(device->compiler);
 
    vk_pipeline_cache_destroy(device->mem_cache, &device->vk.alloc);
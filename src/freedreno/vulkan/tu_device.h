@@ -21,6 +21,7 @@
 #include "tu_util.h"
 
 #include "util/vma.h"
+#include "util/u_queue.h"
 #include "util/u_vector.h"
 
 /* queue types */
@@ -237,6 +238,11 @@ struct tu_device
 
    struct ir3_compiler *compiler;
 
+   /* Worker threads used to compile the variants of independent pipeline
+    * stages in parallel.  Left uninitialized on single-core systems.
+    */
+   struct util_queue compile_queue;
+
    /* Backup in-memory cache to be used if the app doesn't provide one */
    struct vk_pipeline_cache *mem_cache;
 
@@ -2659,6 +2659,62 @@ tu_nir_cache_insert(struct vk_pipeline_cache *cache,
    return container_of(object, struct tu_nir_shaders, base);
 }
 
+struct tu_variant_compile_job {
+   struct ir3_shader *shader;
+   const struct ir3_shader_key *key;
+   bool keep_ir;
+
+   struct ir3_shader_variant *variant;
+   int64_t duration;
+
+   struct util_queue_fence fence;
+};
+
+static void
+tu_variant_compile_job_execute(void *data, void *gdata, int thread_index)
+{
+   struct tu_variant_compile_job *job = (struct tu_variant_compile_job *) data;
+   int64_t start = os_time_get_nano();
+
+   job->variant =
+      ir3_shader_create_variant(job->shader, job->key, job->keep_ir);
+
+   job->duration = os_time_get_nano() - start;
+}
+
+/* Compile a set of variants, in parallel when the device has a compile
+ * queue.  Creating a variant may finalize the NIR of its ir3_shader, so each
+ * job must target a different shader.  The last job runs on the calling
+ * thread.
+ */
+static void
+tu_compile_variants(struct tu_device *dev,
+                    struct tu_variant_compile_job *jobs,
+                    unsigned job_count)
+{
+   if (!job_count)
+      return;
+
+   if (job_count == 1 || !util_queue_is_initialized(&dev->compile_queue)) {
+      for (unsigned i = 0; i < job_count; i++)
+         tu_variant_compile_job_execute(&jobs[i], NULL, 0);
+      return;
+   }
+
+   for (unsigned i = 0; i < job_count - 1; i++) {
+      util_queue_fence_init(&jobs[i].fence);
+      util_queue_add_job(&dev->compile_queue, &jobs[i], &jobs[i].fence,
+                         tu_variant_compile_job_execute, NULL, 0);
+   }
+
+   tu_variant_compile_job_execute(&jobs[job_count - 1], NULL, 0);
+
+   for (unsigned i = 0; i < job_count - 1; i++) {
+      util_queue_fence_wait(&jobs[i].fence);
+      util_queue_fence_destroy(&jobs[i].fence);
+   }
+}
+
 static VkResult
 tu_pipeline_builder_compile_shaders(struct tu_pipeline_builder *builder,
                                     struct tu_pipeline *pipeline)
@@ -2712,6 +2768,10 @@ tu_pipeline_builder_compile_shaders(struct tu_pipeline_builder *builder,
    uint32_t desc_sets = 0;
    uint32_t safe_constlens = 0;
 
+   struct tu_variant_compile_job jobs[ARRAY_SIZE(nir)];
+   gl_shader_stage job_stages[ARRAY_SIZE(nir)];
+   unsigned job_count = 0;
+
    struct tu_shader_key keys[ARRAY_SIZE(stage_infos)] = { };
    for (gl_shader_stage stage = MESA_SHADER_VERTEX;
         stage < ARRAY_SIZE(keys); stage = (gl_shader_stage) (stage+1)) {
@@ -2934,54 +2994,83 @@ tu_pipeline_builder_compile_shaders(struct tu_pipeline_builder *builder,
 
    compiled_shaders->active_desc_sets = desc_sets;
 
+   /* The stages are independent once ir3_key is final, so compile their
+    * variants in parallel.
+    */
+   job_count = 0;
    for (gl_shader_stage stage = MESA_SHADER_VERTEX;
         stage < ARRAY_SIZE(shaders); stage = (gl_shader_stage) (stage + 1)) {
       if (!shaders[stage])
          continue;
 
-      int64_t stage_start = os_time_get_nano();
+      jobs[job_count] = (struct tu_variant_compile_job) {
+         .shader = shaders[stage]->ir3_shader,
+         .key = &ir3_key,
+         .keep_ir = executable_info,
+      };
+      job_stages[job_count++] = stage;
+   }
 
-      compiled_shaders->variants[stage] =
-         ir3_shader_create_variant(shaders[stage]->ir3_shader, &ir3_key,
-                                   executable_info);
-      if (!compiled_shaders->variants[stage])
-         return VK_ERROR_OUT_OF_HOST_MEMORY;
+   tu_compile_variants(builder->device, jobs, job_count);
 
+   for (unsigned i = 0; i < job_count; i++) {
+      gl_shader_stage stage = job_stages[i];
+
+      compiled_shaders->variants[stage] = jobs[i].variant;
       compiled_shaders->const_state[stage] = shaders[stage]->const_state;
+      stage_feedbacks[stage].duration += jobs[i].duration;
+   }
 
-      stage_feedbacks[stage].duration += os_time_get_nano() - stage_start;
+   for (unsigned i = 0; i < job_count; i++) {
+      if (!jobs[i].variant) {
+         result = VK_ERROR_OUT_OF_HOST_MEMORY;
+         goto fail;
+      }
    }
 
    safe_constlens = ir3_trim_constlen(compiled_shaders->variants, compiler);
 
    ir3_key.safe_constlen = true;
 
+   /* Stages over the constlen limit get recompiled with safe_constlen, the
+    * others get an extra safe-const variant when the pipeline is complete.
+    */
+   job_count = 0;
    for (gl_shader_stage stage = MESA_SHADER_VERTEX;
         stage < ARRAY_SIZE(shaders); stage = (gl_shader_stage) (stage + 1)) {
       if (!shaders[stage])
          continue;
 
-      if (safe_constlens & (1 << stage)) {
-         int64_t stage_start = os_time_get_nano();
+      if (!(safe_constlens & (1 << stage)) &&
+          !contains_all_shader_state(builder->state))
+         continue;
 
+      jobs[job_count] = (struct tu_variant_compile_job) {
+         .shader = shaders[stage]->ir3_shader,
+         .key = &ir3_key,
+         .keep_ir = executable_info,
+      };
+      job_stages[job_count++] = stage;
+   }
+
+   tu_compile_variants(builder->device, jobs, job_count);
+
+   for (unsigned i = 0; i < job_count; i++) {
+      gl_shader_stage stage = job_stages[i];
+
+      if (safe_constlens & (1 << stage)) {
          ralloc_free(compiled_shaders->variants[stage]);
-         compiled_shaders->variants[stage] =
-            ir3_shader_create_variant(shaders[stage]->ir3_shader, &ir3_key,
-                                      executable_info);
-         if (!compiled_shaders->variants[stage]) {
-            result = VK_ERROR_OUT_OF_HOST_MEMORY;
-            goto fail;
-         }
+         compiled_shaders->variants[stage] = jobs[i].variant;
+         stage_feedbacks[stage].duration += jobs[i].duration;
+      } else {
+         compiled_shaders->safe_const_variants[stage] = jobs[i].variant;
+      }
+   }
 
-         stage_feedbacks[stage].duration += os_time_get_nano() - stage_start;
-      } else if (contains_all_shader_state(builder->state)) {
-         compiled_shaders->safe_const_variants[stage] =
-            ir3_shader_create_variant(shaders[stage]->ir3_shader, &ir3_key,
-                                      executable_info);
-         if (!compiled_shaders->variants[stage]) {
-            result = VK_ERROR_OUT_OF_HOST_MEMORY;
-            goto fail;
-         }
+   for (unsigned i = 0; i < job_count; i++) {
+      if (!jobs[i].variant) {
+         result = VK_ERROR_OUT_OF_HOST_MEMORY;
+         goto fail;
       }
    }
 
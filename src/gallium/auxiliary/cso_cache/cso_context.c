@@ -90,6 +90,13 @@ struct cso_context {
     */
    int max_sampler_seen;
 
+   /* The sampler states last passed to bind_sampler_states per shader stage,
+    * used to skip redundant binds. Only the slots in bound_samplers_valid
+    * are known to match the driver state.
+    */
+   void *bound_samplers[PIPE_SHADER_MESH_TYPES][PIPE_MAX_SAMPLERS];
+   uint32_t bound_samplers_valid[PIPE_SHADER_MESH_TYPES];
+
    unsigned nr_so_targets;
    struct pipe_stream_output_target *so_targets[PIPE_MAX_SO_BUFFERS];
 
@@ -114,6 +121,14 @@ struct cso_context {
    bool render_condition_cond, render_condition_cond_saved;
    bool flatshade_first, flatshade_first_saved;
 
+   /* The cache entries of the last states bound through cso_set_*, used to
+    * skip the hash lookup when the same template is set again. They are
+    * only valid while their data is still the bound handle.
+    */
+   struct cso_blend *blend_cso;
+   struct cso_depth_stencil_alpha *depth_stencil_cso;
+   struct cso_rasterizer *rasterizer_cso;
+
    struct pipe_framebuffer_state fb, fb_saved;
    struct pipe_viewport_state vp, vp_saved;
    unsigned sample_mask, sample_mask_saved;
@@ -134,16 +149,22 @@ delete_cso(struct cso_context *ctx,
       if (ctx->blend == ((struct cso_blend*)state)->data ||
           ctx->blend_saved == ((struct cso_blend*)state)->data)
          return false;
+      if (ctx->blend_cso == state)
+         ctx->blend_cso = NULL;
       break;
    case CSO_DEPTH_STENCIL_ALPHA:
       if (ctx->depth_stencil == ((struct cso_depth_stencil_alpha*)state)->data ||
           ctx->depth_stencil_saved == ((struct cso_depth_stencil_alpha*)state)->data)
          return false;
+      if (ctx->depth_stencil_cso == state)
+         ctx->depth_stencil_cso = NULL;
       break;
    case CSO_RASTERIZER:
       if (ctx->rasterizer == ((struct cso_rasterizer*)state)->data ||
           ctx->rasterizer_saved == ((struct cso_rasterizer*)state)->data)
          return false;
+      if (ctx->rasterizer_cso == state)
+         ctx->rasterizer_cso = NULL;
       break;
    case CSO_VELEMENTS:
       if (ctx->velements == ((struct cso_velements*)state)->data ||
@@ -228,6 +249,11 @@ sanitize_hash(struct cso_hash *hash, enum cso_cache_type type,
    }
 
    if (type == CSO_SAMPLER) {
+      /* Deleted sampler states can be bound in the driver and their
+       * pointers can be reused, so don't trust the bound state anymore.
+       */
+      memset(ctx->bound_samplers_valid, 0, sizeof(ctx->bound_samplers_valid));
+
       /* Put currently bound sampler states back into the hash table */
       while (to_restore--) {
          struct cso_sampler *sampler = samplers_to_restore[to_restore];
@@ -410,6 +436,7 @@ cso_unbind_context(struct cso_context *ctx)
             assert(maximg <= PIPE_MAX_SHADER_IMAGES);
             if (maxsam > 0) {
                ctx->base.pipe->bind_sampler_states(ctx->base.pipe, sh, 0, maxsam, zeros);
+               ctx->bound_samplers_valid[sh] = 0;
             }
             if (maxview > 0) {
                ctx->base.pipe->set_sampler_views(ctx->base.pipe, sh, 0, maxview, 0, false, views);
@@ -517,7 +544,15 @@ cso_set_blend(struct cso_context *ctx,
 {
    unsigned key_size, hash_key;
    struct cso_hash_iter iter;
-   void *handle;
+   struct cso_blend *cso;
+
+   key_size = templ->independent_blend_enable ? CSO_BLEND_KEY_SIZE_ALL_RT :
+                                                CSO_BLEND_KEY_SIZE_RT0;
+
+   /* Fast path: the same state is set again. */
+   if (ctx->blend_cso && ctx->blend_cso->data == ctx->blend &&
+       !memcmp(&ctx->blend_cso->state, templ, key_size))
+      return PIPE_OK;
 
    if (templ->independent_blend_enable) {
       /* This is duplicated with the else block below because we want key_size
@@ -527,16 +562,14 @@ cso_set_blend(struct cso_context *ctx,
       hash_key = cso_construct_key(templ, CSO_BLEND_KEY_SIZE_ALL_RT);
       iter = cso_find_state_template(&ctx->cache, hash_key, CSO_BLEND,
                                      templ, CSO_BLEND_KEY_SIZE_ALL_RT);
-      key_size = CSO_BLEND_KEY_SIZE_ALL_RT;
    } else {
       hash_key = cso_construct_key(templ, CSO_BLEND_KEY_SIZE_RT0);
       iter = cso_find_state_template(&ctx->cache, hash_key, CSO_BLEND,
                                      templ, CSO_BLEND_KEY_SIZE_RT0);
-      key_size = CSO_BLEND_KEY_SIZE_RT0;
    }
 
    if (cso_hash_iter_is_null(iter)) {
-      struct cso_blend *cso = MALLOC(sizeof(struct cso_blend));
+      cso = MALLOC(sizeof(struct cso_blend));
       if (!cso)
          return PIPE_ERROR_OUT_OF_MEMORY;
 
@@ -549,15 +582,14 @@ cso_set_blend(struct cso_context *ctx,
          FREE(cso);
          return PIPE_ERROR_OUT_OF_MEMORY;
       }
-
-      handle = cso->data;
    } else {
-      handle = ((struct cso_blend *)cso_hash_iter_data(iter))->data;
+      cso = (struct cso_blend *)cso_hash_iter_data(iter);
    }
 
-   if (ctx->blend != handle) {
-      ctx->blend = handle;
-      ctx->base.pipe->bind_blend_state(ctx->base.pipe, handle);
+   ctx->blend_cso = cso;
+   if (ctx->blend != cso->data) {
+      ctx->blend = cso->data;
+      ctx->base.pipe->bind_blend_state(ctx->base.pipe, cso->data);
    }
    return PIPE_OK;
 }
@@ -587,16 +619,22 @@ cso_set_depth_stencil_alpha(struct cso_context *ctx,
                             const struct pipe_depth_stencil_alpha_state *templ)
 {
    const unsigned key_size = sizeof(struct pipe_depth_stencil_alpha_state);
+   struct cso_depth_stencil_alpha *cso;
+
+   /* Fast path: the same state is set again. */
+   if (ctx->depth_stencil_cso &&
+       ctx->depth_stencil_cso->data == ctx->depth_stencil &&
+       !memcmp(&ctx->depth_stencil_cso->state, templ, key_size))
+      return PIPE_OK;
+
    const unsigned hash_key = cso_construct_key(templ, key_size);
    struct cso_hash_iter iter = cso_find_state_template(&ctx->cache,
                                                        hash_key,
                                                        CSO_DEPTH_STENCIL_ALPHA,
                                                        templ, key_size);
-   void *handle;
 
    if (cso_hash_iter_is_null(iter)) {
-      struct cso_depth_stencil_alpha *cso =
-         MALLOC(sizeof(struct cso_depth_stencil_alpha));
+      cso = MALLOC(sizeof(struct cso_depth_stencil_alpha));
       if (!cso)
          return PIPE_ERROR_OUT_OF_MEMORY;
 
@@ -610,16 +648,14 @@ cso_set_depth_stencil_alpha(struct cso_context *ctx,
          FREE(cso);
          return PIPE_ERROR_OUT_OF_MEMORY;
       }
-
-      handle = cso->data;
    } else {
-      handle = ((struct cso_depth_stencil_alpha *)
-                cso_hash_iter_data(iter))->data;
+      cso = (struct cso_depth_stencil_alpha *)cso_hash_iter_data(iter);
    }
 
-   if (ctx->depth_stencil != handle) {
-      ctx->depth_stencil = handle;
-      ctx->base.pipe->bind_depth_stencil_alpha_state(ctx->base.pipe, handle);
+   ctx->depth_stencil_cso = cso;
+   if (ctx->depth_stencil != cso->data) {
+      ctx->depth_stencil = cso->data;
+      ctx->base.pipe->bind_depth_stencil_alpha_state(ctx->base.pipe, cso->data);
    }
    return PIPE_OK;
 }
@@ -650,20 +686,26 @@ cso_set_rasterizer(struct cso_context *ctx,
                    const struct pipe_rasterizer_state *templ)
 {
    const unsigned key_size = sizeof(struct pipe_rasterizer_state);
-   const unsigned hash_key = cso_construct_key(templ, key_size);
-   struct cso_hash_iter iter = cso_find_state_template(&ctx->cache,
-                                                       hash_key,
-                                                       CSO_RASTERIZER,
-                                                       templ, key_size);
-   void *handle = NULL;
+   struct cso_rasterizer *cso;
 
    /* We can't have both point_quad_rasterization (sprites) and point_smooth
     * (round AA points) enabled at the same time.
     */
    assert(!(templ->point_quad_rasterization && templ->point_smooth));
 
+   /* Fast path: the same state is set again. */
+   if (ctx->rasterizer_cso && ctx->rasterizer_cso->data == ctx->rasterizer &&
+       !memcmp(&ctx->rasterizer_cso->state, templ, key_size))
+      return PIPE_OK;
+
+   const unsigned hash_key = cso_construct_key(templ, key_size);
+   struct cso_hash_iter iter = cso_find_state_template(&ctx->cache,
+                                                       hash_key,
+                                                       CSO_RASTERIZER,
+                                                       templ, key_size);
+
    if (cso_hash_iter_is_null(iter)) {
-      struct cso_rasterizer *cso = MALLOC(sizeof(struct cso_rasterizer));
+      cso = MALLOC(sizeof(struct cso_rasterizer));
       if (!cso)
          return PIPE_ERROR_OUT_OF_MEMORY;
 
@@ -675,12 +717,13 @@ cso_set_rasterizer(struct cso_context *ctx,
          FREE(cso);
          return PIPE_ERROR_OUT_OF_MEMORY;
       }
-
-      handle = cso->data;
    } else {
-      handle = ((struct cso_rasterizer *)cso_hash_iter_data(iter))->data;
+      cso = (struct cso_rasterizer *)cso_hash_iter_data(iter);
    }
 
+   void *handle = cso->data;
+
+   ctx->rasterizer_cso = cso;
    if (ctx->rasterizer != handle) {
       ctx->rasterizer = handle;
       ctx->flatshade_first = templ->flatshade_first;
@@ -1428,9 +1471,21 @@ cso_single_sampler_done(struct cso_context *ctx,
    if (ctx->max_sampler_seen == -1)
       return;
 
-   ctx->base.pipe->bind_sampler_states(ctx->base.pipe, shader_stage, 0,
-                                  ctx->max_sampler_seen + 1,
-                                  info->samplers);
+   /* Skip the bind if the driver already has the same sampler states bound,
+    * which is common because the state tracker re-sets all samplers of
+    * a stage when any of them changes.
+    */
+   unsigned count = ctx->max_sampler_seen + 1;
+   uint32_t mask = BITFIELD_MASK(count);
+   void **bound = ctx->bound_samplers[shader_stage];
+
+   if ((ctx->bound_samplers_valid[shader_stage] & mask) != mask ||
+       memcmp(bound, info->samplers, count * sizeof(void*))) {
+      ctx->base.pipe->bind_sampler_states(ctx->base.pipe, shader_stage, 0,
+                                     count, info->samplers);
+      memcpy(bound, info->samplers, count * sizeof(void*));
+      ctx->bound_samplers_valid[shader_stage] |= mask;
+   }
    ctx->max_sampler_seen = -1;
 }
 
@@ -227,6 +227,9 @@ draw_destroy(struct draw_context *draw)
       draw_llvm_destroy(draw->llvm);
 #endif
 
+   if (util_queue_is_initialized(&draw->vs_queue))
+      util_queue_destroy(&draw->vs_queue);
+
    FREE(draw);
 }
 
@@ -1306,6 +1309,25 @@ draw_set_disk_cache_callbacks(struct draw_context *draw,
 }
 
 
+/**
+ * Let the LLVM middle end split the vertex shader of large vertex runs
+ * over up to num_threads threads, the calling thread included.
+ * Passing 0 or 1 keeps all vertex processing on the calling thread.
+ */
+void
+draw_set_vs_thread_count(struct draw_context *draw, unsigned num_threads)
+{
+   if (util_queue_is_initialized(&draw->vs_queue))
+      util_queue_destroy(&draw->vs_queue);
+
+   num_threads = MIN2(num_threads, DRAW_MAX_VS_THREADS);
+   if (num_threads > 1) {
+      util_queue_init(&draw->vs_queue, "draw_vs", DRAW_MAX_VS_THREADS,
+                      num_threads - 1, UTIL_QUEUE_INIT_RESIZE_IF_FULL, NULL);
+   }
+}
+
+
 void
 draw_set_constant_buffer_stride(struct draw_context *draw, unsigned num_bytes)
 {
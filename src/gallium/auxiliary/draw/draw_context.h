@@ -429,5 +429,8 @@ draw_set_disk_cache_callbacks(struct draw_context *draw,
                                                     struct lp_cached_code *cache,
                                                     unsigned char ir_sha1_cache_key[20]));
 
+void
+draw_set_vs_thread_count(struct draw_context *draw, unsigned num_threads);
+
 
 #endif /* DRAW_CONTEXT_H */
@@ -44,6 +44,7 @@
 #include "pipe/p_state.h"
 #include "pipe/p_defines.h"
 #include "pipe/p_shader_tokens.h"
+#include "util/u_queue.h"
 
 #include "draw_vertex_header.h"
 
@@ -123,6 +124,13 @@ struct draw_vertex_buffer {
 /* maximum number of shader variants we can cache */
 #define DRAW_MAX_SHADER_VARIANTS 512
 
+/* maximum number of threads (including the calling one) the vertex shader
+ * of a single fetch/shade run is split over, and the minimum number of
+ * vertices each of them has to get for the split to be worth it
+ */
+#define DRAW_MAX_VS_THREADS 4
+#define DRAW_VS_THREAD_MIN_VERTICES 256
+
 struct draw_buffer_info {
    const void *ptr;
    unsigned size;
@@ -369,6 +377,11 @@ struct draw_context
    unsigned constant_buffer_stride;
    struct draw_llvm *llvm;
 
+   /* Worker threads for draw_set_vs_thread_count(), only initialized if
+    * the vertex shader may be split over several threads.
+    */
+   struct util_queue vs_queue;
+
    /** Texture sampler and sampler view state.
     * Note that we have arrays indexed by shader type.  At this time
     * we only handle vertex and geometry shaders in the draw module, but
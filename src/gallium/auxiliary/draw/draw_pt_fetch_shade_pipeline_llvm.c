@@ -491,6 +491,108 @@ emit(struct pt_emit *emit,
 }
 
 
+struct llvm_vs_job {
+   struct llvm_middle_end *fpme;
+   struct vertex_header *verts;
+   unsigned count;
+   unsigned start;
+   unsigned vertex_id_offset;
+   const unsigned *elts;
+   int clipped;
+   struct util_queue_fence fence;
+};
+
+
+static void
+llvm_vs_job_execute(void *data, void *gdata, int thread_index)
+{
+   struct llvm_vs_job *job = data;
+   struct llvm_middle_end *fpme = job->fpme;
+   struct draw_context *draw = fpme->draw;
+
+   job->clipped =
+      fpme->current_variant->jit_func(&fpme->llvm->vs_jit_context,
+                                      &fpme->llvm->jit_resources[PIPE_SHADER_VERTEX],
+                                      job->verts,
+                                      draw->pt.user.vbuffer,
+                                      job->count,
+                                      job->start,
+                                      fpme->vertex_size,
+                                      draw->pt.vertex_buffer,
+                                      draw->instance_id,
+                                      job->vertex_id_offset,
+                                      draw->start_instance,
+                                      job->elts,
+                                      draw->pt.user.drawid,
+                                      draw->pt.user.viewid);
+}
+
+
+/**
+ * Run the vertex fetch shader over 'count' vertices, splitting the work
+ * over the draw vs_queue threads if there are enough vertices for it.
+ * Every job but the last gets a multiple of the vector width, since the
+ * jitted code writes whole vectors of vertices.
+ */
+static int
+llvm_pipeline_run_vs(struct llvm_middle_end *fpme,
+                     struct vertex_header *verts,
+                     unsigned count,
+                     unsigned start,
+                     unsigned vertex_id_offset,
+                     const unsigned *elts)
+{
+   struct draw_context *draw = fpme->draw;
+   struct llvm_vs_job jobs[DRAW_MAX_VS_THREADS];
+   unsigned num_jobs = 1, per_job, first = 0;
+   int clipped = 0;
+
+   if (count == 0)
+      return 0;
+
+   if (util_queue_is_initialized(&draw->vs_queue)) {
+      num_jobs = MIN2(draw->vs_queue.num_threads + 1,
+                      count / DRAW_VS_THREAD_MIN_VERTICES);
+      num_jobs = MAX2(num_jobs, 1);
+   }
+
+   per_job = align(DIV_ROUND_UP(count, num_jobs), lp_native_vector_width / 32);
+
+   for (unsigned i = 0; i < num_jobs && first < count; i++) {
+      struct llvm_vs_job *job = &jobs[i];
+
+      job->fpme = fpme;
+      job->verts = (struct vertex_header *)
+         ((char *)verts + first * fpme->vertex_size);
+      job->count = MIN2(per_job, count - first);
+      job->start = elts ? start : start + first;
+      job->vertex_id_offset = vertex_id_offset;
+      job->elts = elts ? elts + first : NULL;
+      job->clipped = 0;
+      first += job->count;
+
+      if (first < count) {
+         util_queue_fence_init(&job->fence);
+         util_queue_add_job(&draw->vs_queue, job, &job->fence,
+                            llvm_vs_job_execute, NULL, 0);
+      } else {
+         /* The last job runs on the calling thread. */
+         llvm_vs_job_execute(job, NULL, 0);
+         clipped |= job->clipped;
+         num_jobs = i;
+      }
+   }
+
+   for (unsigned i = 0; i < num_jobs; i++) {
+      util_queue_fence_wait(&jobs[i].fence);
+      util_queue_fence_destroy(&jobs[i].fence);
+      clipped |= jobs[i].clipped;
+   }
+
+   return clipped;
+}
+
+
 static void
 llvm_pipeline_generic(struct draw_pt_middle_end *middle,
                       const struct draw_fetch_info *fetch_info,
@@ -555,20 +657,9 @@ llvm_pipeline_generic(struct draw_pt_middle_end *middle,
          elts = fetch_info->elts;
       }
       /* Run vertex fetch shader */
-      clipped = fpme->current_variant->jit_func(&fpme->llvm->vs_jit_context,
-                                                &fpme->llvm->jit_resources[PIPE_SHADER_VERTEX],
-                                                llvm_vert_info.verts,
-                                                draw->pt.user.vbuffer,
-                                                fetch_info->count,
-                                                start,
-                                                fpme->vertex_size,
-                                                draw->pt.vertex_buffer,
-                                                draw->instance_id,
-                                                vertex_id_offset,
-                                                draw->start_instance,
-                                                elts,
-                                                draw->pt.user.drawid,
-                                                draw->pt.user.viewid);
+      clipped = llvm_pipeline_run_vs(fpme, llvm_vert_info.verts,
+                                     fetch_info->count, start,
+                                     vertex_id_offset, elts);
 
       /* Finished with fetch and vs */
       fetch_info = NULL;
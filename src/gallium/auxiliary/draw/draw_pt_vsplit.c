@@ -34,7 +34,11 @@
 #include "draw/draw_pt.h"
 
 #define SEGMENT_SIZE 1024
-#define MAP_SIZE     256
+/* One map entry per segment element, so that a segment referencing
+ * indices spread over more than the old 256-entry window (e.g. rows of a
+ * grid mesh) still only shades each of them once.
+ */
+#define MAP_SIZE     SEGMENT_SIZE
 
 struct vsplit_frontend {
    struct draw_pt_front_end base;
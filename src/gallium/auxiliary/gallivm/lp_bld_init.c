@@ -150,7 +150,7 @@ create_pass_manager(struct gallivm_state *gallivm)
    LLVMAddCoroElidePass(gallivm->cgpassmgr);
 #endif
 
-   if ((gallivm_perf & GALLIVM_PERF_NO_OPT) == 0) {
+   if (!gallivm->no_opt) {
       /*
        * TODO: Evaluate passes some more - keeping in mind
        * both quality of generated code and compile times.
@@ -274,7 +274,7 @@ init_gallivm_engine(struct gallivm_state *gallivm)
       char *error = NULL;
       int ret;
 
-      if (gallivm_perf & GALLIVM_PERF_NO_OPT) {
+      if (gallivm->no_opt) {
          optlevel = None;
       }
       else {
@@ -339,6 +339,7 @@ init_gallivm_state(struct gallivm_state *gallivm, const char *name,
 
    gallivm->context = context;
    gallivm->cache = cache;
+   gallivm->no_opt |= !!(gallivm_perf & GALLIVM_PERF_NO_OPT);
    if (!gallivm->context)
       goto fail;
 
@@ -482,17 +483,15 @@ lp_build_init(void)
 
 
 
-/**
- * Create a new gallivm_state object.
- */
-struct gallivm_state *
-gallivm_create(const char *name, LLVMContextRef context,
-               struct lp_cached_code *cache)
+static struct gallivm_state *
+create_gallivm_state(const char *name, LLVMContextRef context,
+                     struct lp_cached_code *cache, bool no_opt)
 {
    struct gallivm_state *gallivm;
 
    gallivm = CALLOC_STRUCT(gallivm_state);
    if (gallivm) {
+      gallivm->no_opt = no_opt;
       if (!init_gallivm_state(gallivm, name, context, cache)) {
          FREE(gallivm);
          gallivm = NULL;
@@ -504,6 +503,31 @@ gallivm_create(const char *name, LLVMContextRef context,
 }
 
 
+/**
+ * Create a new gallivm_state object.
+ */
+struct gallivm_state *
+gallivm_create(const char *name, LLVMContextRef context,
+               struct lp_cached_code *cache)
+{
+   return create_gallivm_state(name, context, cache, false);
+}
+
+
+/**
+ * Create a new gallivm_state object whose module is compiled without the
+ * IR optimization passes and with the fast code generator, as if
+ * GALLIVM_PERF=nopt was set.  Meant for a quick first-tier compile that
+ * gets replaced by fully optimized code later.
+ */
+struct gallivm_state *
+gallivm_create_no_opt(const char *name, LLVMContextRef context,
+                      struct lp_cached_code *cache)
+{
+   return create_gallivm_state(name, context, cache, true);
+}
+
+
 /**
  * Destroy a gallivm_state object.
  */
@@ -584,10 +608,10 @@ gallivm_compile_module(struct gallivm_state *gallivm)
       LLVMWriteBitcodeToFile(gallivm->module, filename);
       debug_printf("%s written\n", filename);
       debug_printf("Invoke as \"opt %s %s | llc -O%d %s%s\"\n",
-                   gallivm_perf & GALLIVM_PERF_NO_OPT ? "-mem2reg" :
+                   gallivm->no_opt ? "-mem2reg" :
                    "-sroa -early-cse -simplifycfg -reassociate "
                    "-mem2reg -constprop -instcombine -gvn",
-                   filename, gallivm_perf & GALLIVM_PERF_NO_OPT ? 0 : 2,
+                   filename, gallivm->no_opt ? 0 : 2,
                    "[-mcpu=<-mcpu option>] ",
                    "[-mattr=<-mattr option(s)>]");
    }
@@ -608,7 +632,7 @@ gallivm_compile_module(struct gallivm_state *gallivm)
    LLVMPassBuilderOptionsRef opts = LLVMCreatePassBuilderOptions();
    LLVMRunPasses(gallivm->module, passes, LLVMGetExecutionEngineTargetMachine(gallivm->engine), opts);
 
-   if (!(gallivm_perf & GALLIVM_PERF_NO_OPT))
+   if (!gallivm->no_opt)
       strcpy(passes, "sroa,early-cse,simplifycfg,reassociate,mem2reg,instsimplify,instcombine");
    else
       strcpy(passes, "mem2reg");
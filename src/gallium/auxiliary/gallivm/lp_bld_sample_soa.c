@@ -2541,14 +2541,24 @@ lp_build_sample_common(struct lp_build_sample_context *bld,
           mip_filter, min_filter, mag_filter);
    */
 
-   first_level = bld->dynamic_state->first_level(bld->gallivm,
-                                                 bld->resources_type,
-                                                 bld->resources_ptr,
-                                                 texture_index, NULL);
-   last_level = bld->dynamic_state->last_level(bld->gallivm,
-                                               bld->resources_type,
-                                               bld->resources_ptr,
-                                               texture_index, NULL);
+   if (bld->static_texture_state->level_zero_only) {
+      /*
+       * A view whose last level is 0 can only have first_level == 0 too.
+       * Using constants here lets the minification and mip level selection
+       * below fold away instead of loading and clamping levels per sample.
+       */
+      first_level = lp_build_const_int32(bld->gallivm, 0);
+      last_level = first_level;
+   } else {
+      first_level = bld->dynamic_state->first_level(bld->gallivm,
+                                                    bld->resources_type,
+                                                    bld->resources_ptr,
+                                                    texture_index, NULL);
+      last_level = bld->dynamic_state->last_level(bld->gallivm,
+                                                  bld->resources_type,
+                                                  bld->resources_ptr,
+                                                  texture_index, NULL);
+   }
 
    /*
     * Choose cube face, recompute texcoords for the chosen face and
@@ -65,6 +65,7 @@
 #include "util/u_simple_shaders.h"
 #include "util/u_string.h"
 #include "util/u_upload_mgr.h"
+#include "util/perf/u_perfetto.h"
 #include "tgsi/tgsi_text.h"
 #include "tgsi/tgsi_dump.h"
 
@@ -995,6 +996,14 @@ void
 hud_graph_add_value(struct hud_graph *gr, double value)
 {
    gr->current_value = value;
+
+   /* Mirror every sample as a perfetto counter track, so the HUD can be used
+    * headless with GALLIUM_HUD_VISIBLE=false. gr->name lives as long as the
+    * graph, which is the only time it is passed to perfetto.
+    */
+   if (util_perfetto_is_category_enabled(UTIL_PERFETTO_CATEGORY_DEFAULT))
+      util_perfetto_counter_set(UTIL_PERFETTO_CATEGORY_DEFAULT, gr->name, value);
+
    value = value > gr->pane->ceiling ? gr->pane->ceiling : value;
 
    if (gr->fd) {
@@ -1315,6 +1324,18 @@ hud_parse_env_var(struct hud_context *hud, struct pipe_screen *screen,
       else if (strcmp(name, "main-thread-busy") == 0) {
          hud_thread_busy_install(pane, name, true);
       }
+      else if (strcmp(name, "shader-cache-hits") == 0) {
+         hud_disk_cache_graph_install(pane, screen, name, HUD_DISK_CACHE_HITS);
+      }
+      else if (strcmp(name, "shader-cache-misses") == 0) {
+         hud_disk_cache_graph_install(pane, screen, name, HUD_DISK_CACHE_MISSES);
+      }
+      else if (strcmp(name, "shader-cache-read-KB") == 0) {
+         hud_disk_cache_graph_install(pane, screen, name, HUD_DISK_CACHE_READ_KB);
+      }
+      else if (strcmp(name, "shader-cache-get-us") == 0) {
+         hud_disk_cache_graph_install(pane, screen, name, HUD_DISK_CACHE_GET_US);
+      }
 #ifdef HAVE_GALLIUM_EXTRA_HUD
       else if (sscanf(name, "nic-rx-%s", arg_name) == 1) {
          hud_nic_graph_install(pane, arg_name, NIC_DIRECTION_RX);
@@ -1617,6 +1638,14 @@ print_help(struct pipe_screen *screen)
    for (i = 0; i < num_cpus; i++)
       printf("    cpu%i\n", i);
 
+   if (screen->get_disk_shader_cache &&
+       screen->get_disk_shader_cache(screen)) {
+      puts("    shader-cache-hits");
+      puts("    shader-cache-misses");
+      puts("    shader-cache-read-KB");
+      puts("    shader-cache-get-us");
+   }
+
    if (has_occlusion_query(screen))
       puts("    samples-passed");
    if (has_streamout(screen))
@@ -1961,6 +1990,8 @@ hud_create(struct cso_context *cso, struct hud_context *share,
    if (!hud)
       return NULL;
 
+   util_perfetto_init();
+
    /* font (the context is only used for the texture upload) */
    if (!util_font_create(cso_get_pipe_context(cso),
                          UTIL_FONT_FIXED_8X13, &hud->font)) {
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2023 The Mesa Authors
+ * SPDX-License-Identifier: MIT
+ */
+
+/* This file contains code for displaying shader disk cache activity on the
+ * HUD.
+ */
+
+#include "hud/hud_private.h"
+#include "pipe/p_screen.h"
+#include "util/disk_cache.h"
+#include "util/os_time.h"
+#include "util/u_memory.h"
+
+struct disk_cache_info {
+   struct disk_cache *cache;
+   enum hud_disk_cache_counter counter;
+   uint64_t last_value;
+   int64_t last_time;
+};
+
+static uint64_t
+get_disk_cache_counter(struct disk_cache_info *info)
+{
+   struct disk_cache_stats stats;
+
+   disk_cache_get_stats(info->cache, &stats);
+
+   switch (info->counter) {
+   case HUD_DISK_CACHE_HITS:
+      return stats.hits;
+   case HUD_DISK_CACHE_MISSES:
+      return stats.misses;
+   case HUD_DISK_CACHE_READ_KB:
+      return stats.bytes_read / 1024;
+   case HUD_DISK_CACHE_GET_US:
+      return stats.get_time_ns / 1000;
+   default:
+      assert(0);
+      return 0;
+   }
+}
+
+static void
+query_disk_cache(struct hud_graph *gr, struct pipe_context *pipe)
+{
+   struct disk_cache_info *info = gr->query_data;
+   int64_t now = os_time_get_nano();
+   uint64_t value = get_disk_cache_counter(info);
+
+   if (info->last_time) {
+      if (info->last_time + gr->pane->period * 1000 <= now) {
+         hud_graph_add_value(gr, value - info->last_value);
+         info->last_value = value;
+         info->last_time = now;
+      }
+   } else {
+      /* initialize */
+      info->last_value = value;
+      info->last_time = now;
+   }
+}
+
+static void
+free_query_data(void *p, struct pipe_context *pipe)
+{
+   FREE(p);
+}
+
+void
+hud_disk_cache_graph_install(struct hud_pane *pane, struct pipe_screen *screen,
+                             const char *name,
+                             enum hud_disk_cache_counter counter)
+{
+   struct disk_cache *cache = screen->get_disk_shader_cache ?
+      screen->get_disk_shader_cache(screen) : NULL;
+   if (!cache)
+      return;
+
+   struct hud_graph *gr = CALLOC_STRUCT(hud_graph);
+   if (!gr)
+      return;
+
+   strcpy(gr->name, name);
+
+   gr->query_data = CALLOC_STRUCT(disk_cache_info);
+   if (!gr->query_data) {
+      FREE(gr);
+      return;
+   }
+
+   struct disk_cache_info *info = gr->query_data;
+   info->cache = cache;
+   info->counter = counter;
+
+   gr->query_new_value = query_disk_cache;
+
+   /* Don't use free() as our callback as that messes up Gallium's
+    * memory debugger.  Use simple free_query_data() wrapper.
+    */
+   gr->free_query_data = free_query_data;
+
+   hud_pane_add_graph(pane, gr);
+   hud_pane_set_max_value(pane, 100);
+}
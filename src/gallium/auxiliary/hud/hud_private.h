@@ -42,6 +42,13 @@ enum hud_counter {
    HUD_COUNTER_BATCHES,
 };
 
+enum hud_disk_cache_counter {
+   HUD_DISK_CACHE_HITS,
+   HUD_DISK_CACHE_MISSES,
+   HUD_DISK_CACHE_READ_KB,
+   HUD_DISK_CACHE_GET_US,
+};
+
 struct hud_context {
    int refcount;
    bool simple;
@@ -170,6 +177,10 @@ void hud_cpu_graph_install(struct hud_pane *pane, unsigned cpu_index);
 void hud_thread_busy_install(struct hud_pane *pane, const char *name, bool main);
 void hud_thread_counter_install(struct hud_pane *pane, const char *name,
                                 enum hud_counter counter);
+void hud_disk_cache_graph_install(struct hud_pane *pane,
+                                  struct pipe_screen *screen,
+                                  const char *name,
+                                  enum hud_disk_cache_counter counter);
 void hud_pipe_query_install(struct hud_batch_query_context **pbq,
                             struct hud_pane *pane,
                             const char *name,
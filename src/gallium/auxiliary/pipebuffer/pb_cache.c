@@ -27,10 +27,25 @@
  **************************************************************************/
 
 #include "pb_cache.h"
+#include "util/u_math.h"
 #include "util/u_memory.h"
 #include "util/os_time.h"
 
 
+static inline unsigned
+pb_cache_size_class(pb_size size)
+{
+   return MIN2(util_logbase2_64(MAX2(size, 1)), PB_CACHE_SIZE_CLASSES - 1);
+}
+
+static inline struct list_head *
+pb_cache_size_bucket(struct pb_cache *mgr, unsigned bucket_index,
+                     unsigned size_class)
+{
+   return &mgr->size_buckets[bucket_index * PB_CACHE_SIZE_CLASSES + size_class];
+}
+
+
 /**
  * Actually destroy the buffer.
  */
@@ -43,6 +58,7 @@ destroy_buffer_locked(struct pb_cache_entry *entry)
    assert(!pipe_is_referenced(&buf->reference));
    if (list_is_linked(&entry->head)) {
       list_del(&entry->head);
+      list_del(&entry->size_head);
       assert(mgr->num_buffers);
       --mgr->num_buffers;
       mgr->cache_size -= buf->size;
@@ -105,6 +121,9 @@ pb_cache_add_buffer(struct pb_cache_entry *entry)
    entry->start = os_time_get();
    entry->end = entry->start + mgr->usecs;
    list_addtail(&entry->head, cache);
+   list_addtail(&entry->size_head,
+                pb_cache_size_bucket(mgr, entry->bucket_index,
+                                     pb_cache_size_class(buf->size)));
    ++mgr->num_buffers;
    mgr->cache_size += buf->size;
    simple_mtx_unlock(&mgr->mutex);
@@ -148,75 +167,57 @@ pb_cache_reclaim_buffer(struct pb_cache *mgr, pb_size size,
                         unsigned alignment, unsigned usage,
                         unsigned bucket_index)
 {
-   struct pb_cache_entry *entry;
-   struct pb_cache_entry *cur_entry;
-   struct list_head *cur, *next;
-   int64_t now;
-   int ret = 0;
+   struct pb_cache_entry *entry = NULL;
 
    assert(bucket_index < mgr->num_heaps);
    struct list_head *cache = &mgr->buckets[bucket_index];
 
-   simple_mtx_lock(&mgr->mutex);
-
-   entry = NULL;
-   cur = cache->next;
-   next = cur->next;
-
-   /* search in the expired buffers, freeing them in the process */
-   now = os_time_get();
-   while (cur != cache) {
-      cur_entry = list_entry(cur, struct pb_cache_entry, head);
-
-      if (!entry && (ret = pb_cache_is_buffer_compat(cur_entry, size,
-                                                     alignment, usage)) > 0)
-         entry = cur_entry;
-      else if (os_time_timeout(cur_entry->start, cur_entry->end, now))
-         destroy_buffer_locked(cur_entry);
-      else
-         /* This buffer (and all hereafter) are still hot in cache */
-         break;
+   /* Only size classes that can hold a buffer between size and
+    * size_factor * size need to be searched.
+    */
+   const unsigned min_class = pb_cache_size_class(size);
+   const unsigned max_class =
+      pb_cache_size_class((pb_size)(mgr->size_factor * size));
 
-      /* the buffer is busy (and probably all remaining ones too) */
-      if (ret == -1)
-         break;
+   simple_mtx_lock(&mgr->mutex);
 
-      cur = next;
-      next = cur->next;
-   }
+   for (unsigned c = min_class; c <= max_class && !entry; c++) {
+      struct list_head *list = pb_cache_size_bucket(mgr, bucket_index, c);
 
-   /* keep searching in the hot buffers */
-   if (!entry && ret != -1) {
-      while (cur != cache) {
-         cur_entry = list_entry(cur, struct pb_cache_entry, head);
-         ret = pb_cache_is_buffer_compat(cur_entry, size, alignment, usage);
+      list_for_each_entry(struct pb_cache_entry, cur_entry, list, size_head) {
+         int ret = pb_cache_is_buffer_compat(cur_entry, size, alignment, usage);
 
          if (ret > 0) {
             entry = cur_entry;
             break;
          }
+         /* the buffer is busy (and probably all newer ones too) */
          if (ret == -1)
             break;
-         /* no need to check the timeout here */
-         cur = next;
-         next = cur->next;
       }
    }
 
-   /* found a compatible buffer, return it */
+   /* found a compatible buffer, take it out of the cache */
    if (entry) {
-      struct pb_buffer *buf = entry->buffer;
-
-      mgr->cache_size -= buf->size;
+      mgr->cache_size -= entry->buffer->size;
       list_del(&entry->head);
+      list_del(&entry->size_head);
       --mgr->num_buffers;
-      simple_mtx_unlock(&mgr->mutex);
+   }
+
+   /* free the expired buffers of this bucket */
+   release_expired_buffers_locked(cache, os_time_get());
+
+   simple_mtx_unlock(&mgr->mutex);
+
+   if (entry) {
+      struct pb_buffer *buf = entry->buffer;
+
       /* Increase refcount */
       pipe_reference_init(&buf->reference, 1);
       return buf;
    }
 
-   simple_mtx_unlock(&mgr->mutex);
    return NULL;
 }
 
@@ -293,8 +294,18 @@ pb_cache_init(struct pb_cache *mgr, unsigned num_heaps,
    if (!mgr->buckets)
       return;
 
+   mgr->size_buckets = CALLOC(num_heaps * PB_CACHE_SIZE_CLASSES,
+                              sizeof(struct list_head));
+   if (!mgr->size_buckets) {
+      FREE(mgr->buckets);
+      mgr->buckets = NULL;
+      return;
+   }
+
    for (i = 0; i < num_heaps; i++)
       list_inithead(&mgr->buckets[i]);
+   for (i = 0; i < num_heaps * PB_CACHE_SIZE_CLASSES; i++)
+      list_inithead(&mgr->size_buckets[i]);
 
    (void) simple_mtx_init(&mgr->mutex, mtx_plain);
    mgr->winsys = winsys;
@@ -319,4 +330,6 @@ pb_cache_deinit(struct pb_cache *mgr)
    simple_mtx_destroy(&mgr->mutex);
    FREE(mgr->buckets);
    mgr->buckets = NULL;
+   FREE(mgr->size_buckets);
+   mgr->size_buckets = NULL;
 }
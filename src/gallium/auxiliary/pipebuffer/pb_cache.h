@@ -34,12 +34,15 @@
 #include "util/list.h"
 #include "util/u_thread.h"
 
+#define PB_CACHE_SIZE_CLASSES 48
+
 /**
  * Statically inserted into the driver-specific buffer structure.
  */
 struct pb_cache_entry
 {
    struct list_head head;
+   struct list_head size_head; /**< Link in the size class list */
    struct pb_buffer *buffer; /**< Pointer to the structure this is part of. */
    struct pb_cache *mgr;
    int64_t start, end; /**< Caching time interval */
@@ -53,6 +56,12 @@ struct pb_cache
     */
    struct list_head *buckets;
 
+   /* The same buffers, additionally split by log2 of their size so that
+    * reclaiming only looks at buffers of a compatible size. Indexed by
+    * bucket_index * PB_CACHE_SIZE_CLASSES + size class.
+    */
+   struct list_head *size_buckets;
+
    simple_mtx_t mutex;
    void *winsys;
    uint64_t cache_size;
@@ -27,6 +27,7 @@
 
 #include "pb_slab.h"
 
+#include "util/u_atomic.h"
 #include "util/u_math.h"
 #include "util/u_memory.h"
 
@@ -71,6 +72,31 @@ pb_slab_reclaim(struct pb_slabs *slabs, struct pb_slab_entry *entry)
    }
 }
 
+/* Move the entries queued by pb_slab_free to the tail of the reclaim list,
+ * keeping the reclaim list ordered from least to most recently freed.
+ */
+static void
+pb_slabs_drain_pending_locked(struct pb_slabs *slabs)
+{
+   struct list_head *tail = slabs->reclaim.prev;
+   struct pb_slab_entry *entry;
+
+   do {
+      entry = p_atomic_read(&slabs->pending_free);
+   } while (entry &&
+            p_atomic_cmpxchg_ptr(&slabs->pending_free, entry, NULL) != entry);
+
+   while (entry) {
+      struct pb_slab_entry *next = (struct pb_slab_entry *)entry->head.next;
+
+      /* The stack is newest first, so each entry goes in front of the ones
+       * drained before it.
+       */
+      list_add(&entry->head, tail);
+      entry = next;
+   }
+}
+
 #define MAX_FAILED_RECLAIMS 2
 
 static unsigned
@@ -79,6 +105,8 @@ pb_slabs_reclaim_locked(struct pb_slabs *slabs)
    struct pb_slab_entry *entry, *next;
    unsigned num_failed_reclaims = 0;
    unsigned num_reclaims = 0;
+
+   pb_slabs_drain_pending_locked(slabs);
    LIST_FOR_EACH_ENTRY_SAFE(entry, next, &slabs->reclaim, head) {
       if (slabs->can_reclaim(slabs->priv, entry)) {
          pb_slab_reclaim(slabs, entry);
@@ -103,6 +131,8 @@ pb_slabs_reclaim_all_locked(struct pb_slabs *slabs)
 {
    struct pb_slab_entry *entry, *next;
    unsigned num_reclaims = 0;
+
+   pb_slabs_drain_pending_locked(slabs);
    LIST_FOR_EACH_ENTRY_SAFE(entry, next, &slabs->reclaim, head) {
       if (slabs->can_reclaim(slabs->priv, entry)) {
          pb_slab_reclaim(slabs, entry);
@@ -210,9 +240,15 @@ pb_slab_alloc(struct pb_slabs *slabs, unsigned size, unsigned heap)
 void
 pb_slab_free(struct pb_slabs* slabs, struct pb_slab_entry *entry)
 {
-   simple_mtx_lock(&slabs->mutex);
-   list_addtail(&entry->head, &slabs->reclaim);
-   simple_mtx_unlock(&slabs->mutex);
+   /* Push onto the pending stack instead of taking the mutex; the entries
+    * are moved to the reclaim list the next time it is walked.
+    */
+   struct pb_slab_entry *old;
+
+   do {
+      old = p_atomic_read(&slabs->pending_free);
+      entry->head.next = (struct list_head *)old;
+   } while (p_atomic_cmpxchg_ptr(&slabs->pending_free, old, entry) != old);
 }
 
 /* Check if any of the entries handed to pb_slab_free are ready to be re-used.
@@ -264,6 +300,7 @@ pb_slabs_init(struct pb_slabs *slabs,
    slabs->slab_free = slab_free;
 
    list_inithead(&slabs->reclaim);
+   slabs->pending_free = NULL;
 
    num_groups = slabs->num_orders * slabs->num_heaps *
                 (1 + allow_three_fourth_allocations);
@@ -293,6 +330,7 @@ pb_slabs_deinit(struct pb_slabs *slabs)
    /* Reclaim all slab entries (even those that are still in flight). This
     * implicitly calls slab_free for everything.
     */
+   pb_slabs_drain_pending_locked(slabs);
    while (!list_is_empty(&slabs->reclaim)) {
       struct pb_slab_entry *entry =
          list_entry(slabs->reclaim.next, struct pb_slab_entry, head);
@@ -128,6 +128,12 @@ struct pb_slabs
     */
    struct list_head reclaim;
 
+   /* Lock-free stack of entries passed to pb_slab_free that haven't been
+    * moved to the reclaim list yet, most-recently freed first. Entries are
+    * linked through head.next while they are on it.
+    */
+   struct pb_slab_entry *pending_free;
+
    void *priv;
    slab_can_reclaim_fn *can_reclaim;
    slab_alloc_fn *slab_alloc;
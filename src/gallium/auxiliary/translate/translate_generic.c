@@ -63,6 +63,11 @@ struct translate_generic {
       unsigned input_stride;
       unsigned max_index;
 
+      /* size of one element in the input buffer, so that tightly packed
+       * arrays can be fetched with a single call
+       */
+      unsigned input_size;
+
       /* this value is set to -1 if this is a normal element with
        * output_format != input_format: in this case, u_format is used
        * to do a full conversion
@@ -642,7 +647,7 @@ generic_run_one(struct translate_generic *tg,
          }
       } else {
          if (likely(tg->attrib[attr].copy_size >= 0)) {
-            memcpy(data, &instance_id, 4);
+            memcpy(dst, &instance_id, 4);
          } else {
             data[0] = (float)instance_id;
             tg->attrib[attr].emit(data, dst);
@@ -708,6 +713,86 @@ generic_run_elts8(struct translate *translate,
    }
 }
 
+/**
+ * Number of vertices generic_run() converts for one attribute before
+ * moving on to the next one.
+ */
+#define GENERIC_RUN_CHUNK 64
+
+/**
+ * Fetch a single attribute for 'count' (at most GENERIC_RUN_CHUNK)
+ * consecutive vertices.
+ *
+ * Attributes that are the same for every vertex are fetched once, and
+ * tightly packed arrays are unpacked with a single fetch call instead of
+ * one call per vertex.
+ */
+static void
+generic_run_attrib_linear(struct translate_generic *tg,
+                          unsigned attr,
+                          unsigned start,
+                          unsigned count,
+                          unsigned start_instance,
+                          unsigned instance_id,
+                          uint8_t *vert)
+{
+   const unsigned output_stride = tg->translate.key.output_stride;
+   uint8_t *dst = vert + tg->attrib[attr].output_offset;
+   float data[GENERIC_RUN_CHUNK][4];
+   const uint8_t *src;
+   unsigned src_stride;
+   int copy_size;
+   unsigned i;
+
+   assert(count <= GENERIC_RUN_CHUNK);
+
+   if (tg->attrib[attr].type == TRANSLATE_ELEMENT_INSTANCE_ID) {
+      if (likely(tg->attrib[attr].copy_size >= 0)) {
+         for (i = 0; i < count; i++, dst += output_stride)
+            memcpy(dst, &instance_id, 4);
+      } else {
+         data[0][0] = (float)instance_id;
+         for (i = 0; i < count; i++, dst += output_stride)
+            tg->attrib[attr].emit(data[0], dst);
+      }
+      return;
+   }
+
+   src_stride = tg->attrib[attr].input_stride;
+   if (tg->attrib[attr].instance_divisor) {
+      unsigned index = start_instance +
+                       instance_id / tg->attrib[attr].instance_divisor;
+      src = tg->attrib[attr].input_ptr + (ptrdiff_t)src_stride * index;
+      src_stride = 0;
+   } else {
+      src = tg->attrib[attr].input_ptr + (ptrdiff_t)src_stride * start;
+   }
+
+   copy_size = tg->attrib[attr].copy_size;
+   if (likely(copy_size >= 0)) {
+      for (i = 0; i < count; i++, dst += output_stride, src += src_stride)
+         memcpy(dst, src, copy_size);
+      return;
+   }
+
+   if (src_stride == 0) {
+      tg->attrib[attr].fetch(data[0], src, 1);
+      for (i = 0; i < count; i++, dst += output_stride)
+         tg->attrib[attr].emit(data[0], dst);
+      return;
+   }
+
+   if (src_stride == tg->attrib[attr].input_size) {
+      tg->attrib[attr].fetch(data, src, count);
+   } else {
+      for (i = 0; i < count; i++, src += src_stride)
+         tg->attrib[attr].fetch(data[i], src, 1);
+   }
+
+   for (i = 0; i < count; i++, dst += output_stride)
+      tg->attrib[attr].emit(data[i], dst);
+}
+
 static void UTIL_CDECL
 generic_run(struct translate *translate,
             unsigned start,
@@ -717,12 +802,20 @@ generic_run(struct translate *translate,
             void *output_buffer)
 {
    struct translate_generic *tg = translate_generic(translate);
-   char *vert = output_buffer;
-   unsigned i;
+   uint8_t *vert = output_buffer;
+   unsigned i, attr;
 
-   for (i = 0; i < count; i++) {
-      generic_run_one(tg, start + i, start_instance, instance_id, vert, 0);
-      vert += tg->translate.key.output_stride;
+   /* Walk the vertices in chunks, one attribute at a time, so that the
+    * per-attribute state and fetch/emit functions stay hot.
+    */
+   for (i = 0; i < count; i += GENERIC_RUN_CHUNK) {
+      unsigned n = MIN2(count - i, GENERIC_RUN_CHUNK);
+
+      for (attr = 0; attr < tg->nr_attrib; attr++)
+         generic_run_attrib_linear(tg, attr, start + i, n,
+                                   start_instance, instance_id, vert);
+
+      vert += n * tg->translate.key.output_stride;
    }
 }
 
@@ -818,6 +911,7 @@ translate_generic_create(const struct translate_key *key)
       tg->attrib[i].fetch = unpack->unpack_rgba;
       tg->attrib[i].buffer = key->element[i].input_buffer;
       tg->attrib[i].input_offset = key->element[i].input_offset;
+      tg->attrib[i].input_size = format_desc->block.bits >> 3;
       tg->attrib[i].instance_divisor = key->element[i].instance_divisor;
 
       tg->attrib[i].output_offset = key->element[i].output_offset;
@@ -91,13 +91,15 @@ void util_compute_blit(struct pipe_context *ctx, struct pipe_blit_info *blit_inf
    float y_scale = blit_info->src.box.height / (float)blit_info->dst.box.height;
    float z_scale = blit_info->src.box.depth / (float)blit_info->dst.box.depth;
    float offset = half_texel_offset ? 0.5 : 0.0;
+   float src_width = u_minify(src->width0, blit_info->src.level);
+   float src_height = u_minify(src->height0, blit_info->src.level);
 
-   unsigned data[] = {u_bitcast_f2u((blit_info->src.box.x + offset) / (float)src->width0),
-                      u_bitcast_f2u((blit_info->src.box.y + offset) / (float)src->height0),
+   unsigned data[] = {u_bitcast_f2u((blit_info->src.box.x + offset) / src_width),
+                      u_bitcast_f2u((blit_info->src.box.y + offset) / src_height),
                       u_bitcast_f2u(blit_info->src.box.z),
                       u_bitcast_f2u(0),
-                      u_bitcast_f2u(x_scale / src->width0),
-                      u_bitcast_f2u(y_scale / src->height0),
+                      u_bitcast_f2u(x_scale / src_width),
+                      u_bitcast_f2u(y_scale / src_height),
                       u_bitcast_f2u(z_scale),
                       u_bitcast_f2u(0),
                       blit_info->dst.box.x,
@@ -136,6 +138,8 @@ void util_compute_blit(struct pipe_context *ctx, struct pipe_blit_info *blit_inf
    /* Initialize the sampler view. */
    u_sampler_view_default_template(&src_templ, src, src->format);
    src_templ.format = util_format_linear(blit_info->src.format);
+   src_templ.u.tex.first_level = blit_info->src.level;
+   src_templ.u.tex.last_level = blit_info->src.level;
    src_view = ctx->create_sampler_view(ctx, src, &src_templ);
    ctx->set_sampler_views(ctx, PIPE_SHADER_COMPUTE, 0, 1, 0, false, &src_view);
 
@@ -150,7 +154,7 @@ void util_compute_blit(struct pipe_context *ctx, struct pipe_blit_info *blit_inf
    grid_info.block[2] = 1;
    grid_info.grid[0] = DIV_ROUND_UP(width, 64);
    grid_info.grid[1] = height;
-   grid_info.grid[2] = 1;
+   grid_info.grid[2] = blit_info->dst.box.depth;
 
    ctx->launch_grid(ctx, &grid_info);
 
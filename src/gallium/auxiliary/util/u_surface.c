@@ -74,6 +74,26 @@ util_copy_box(uint8_t * dst,
    unsigned z;
    dst += dst_z * dst_slice_stride;
    src += src_z * src_slice_stride;
+
+   /* Tightly packed rows and slices on both sides: the whole box is one
+    * contiguous range.
+    */
+   if (depth > 1 && dst_x == 0 && src_x == 0 && src_stride > 0) {
+      const unsigned row_size = util_format_get_stride(format, width);
+      const uint64_t slice_size =
+         (uint64_t)util_format_get_nblocksy(format, height) * dst_stride;
+
+      if (row_size == dst_stride && row_size == (unsigned)src_stride &&
+          dst_slice_stride == slice_size && src_slice_stride == slice_size) {
+         const unsigned blockheight = util_format_get_blockheight(format);
+
+         memcpy(dst + (dst_y / blockheight) * dst_stride,
+                src + (src_y / blockheight) * src_stride,
+                slice_size * depth);
+         return;
+      }
+   }
+
    for (z = 0; z < depth; ++z) {
       util_copy_rect(dst,
                      format,
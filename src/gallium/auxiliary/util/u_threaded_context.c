@@ -32,6 +32,7 @@
 #include "util/u_upload_mgr.h"
 #include "driver_trace/tr_context.h"
 #include "util/log.h"
+#include "util/os_time.h"
 #include "util/perf/cpu_trace.h"
 #include "compiler/shader_info.h"
 
@@ -505,6 +506,18 @@ tc_batch_flush(struct threaded_context *tc, bool full_copy)
    tc->bytes_mapped_estimate = 0;
    p_atomic_add(&tc->num_offloaded_slots, next->num_total_slots);
 
+   if (tc->early_flush) {
+      /* Make batches larger while the driver thread is busy so that queuing
+       * overhead stays low, and smaller when it's idle to reduce latency.
+       */
+      if (util_queue_fence_is_signalled(&tc->batch_slots[tc->last].fence))
+         tc->early_flush_slots = MAX2(tc->early_flush_slots / 2,
+                                      TC_MIN_EARLY_FLUSH_SLOTS);
+      else
+         tc->early_flush_slots = MIN2(tc->early_flush_slots * 2,
+                                      TC_SLOTS_PER_BATCH);
+   }
+
    if (next->token) {
       next->token->tc = NULL;
       tc_unflushed_batch_token_reference(&next->token, NULL);
@@ -547,6 +560,14 @@ tc_add_sized_call(struct threaded_context *tc, enum tc_call_id id,
       next = &tc->batch_slots[tc->next];
       tc_assert(next->num_total_slots == 0);
       tc_assert(next->last_mergeable_call == NULL);
+   } else if (unlikely(next->num_total_slots >= tc->early_flush_slots) &&
+              !(tc->options.parse_renderpass_info && tc->in_renderpass) &&
+              util_queue_fence_is_signalled(&tc->batch_slots[tc->last].fence)) {
+      /* The driver thread is idle, kick the batch early. */
+      p_atomic_inc(&tc->num_early_flushes);
+      tc_batch_flush(tc, true);
+      next = &tc->batch_slots[tc->next];
+      tc_assert(next->num_total_slots == 0);
    }
 
    tc_assert(util_queue_fence_is_signalled(&next->fence));
@@ -636,11 +657,35 @@ tc_is_sync(struct threaded_context *tc)
 }
 
 static void
-_tc_sync(struct threaded_context *tc, UNUSED const char *info, UNUSED const char *func)
+tc_add_sync_stat(struct threaded_context *tc, const char *func,
+                 uint64_t time_ns)
+{
+   tc->sync_time_ns += time_ns;
+
+   /* __func__ is unique per function, so comparing pointers is enough. */
+   for (unsigned i = 0; i < tc->num_sync_stats; i++) {
+      if (tc->sync_stats[i].func == func) {
+         tc->sync_stats[i].count++;
+         tc->sync_stats[i].time_ns += time_ns;
+         return;
+      }
+   }
+
+   if (tc->num_sync_stats < TC_MAX_SYNC_STATS) {
+      struct tc_sync_stat *stat = &tc->sync_stats[tc->num_sync_stats++];
+      stat->func = func;
+      stat->count = 1;
+      stat->time_ns = time_ns;
+   }
+}
+
+static void
+_tc_sync(struct threaded_context *tc, UNUSED const char *info, const char *func)
 {
    struct tc_batch *last = &tc->batch_slots[tc->last];
    struct tc_batch *next = &tc->batch_slots[tc->next];
    bool synced = false;
+   int64_t start_time = 0;
 
    MESA_TRACE_BEGIN(func);
 
@@ -662,6 +707,7 @@ _tc_sync(struct threaded_context *tc, UNUSED const char *info, UNUSED const char
 
    /* Only wait for queued calls... */
    if (!util_queue_fence_is_signalled(&last->fence)) {
+      start_time = os_time_get_nano();
       util_queue_fence_wait(&last->fence);
       synced = true;
    }
@@ -675,6 +721,8 @@ _tc_sync(struct threaded_context *tc, UNUSED const char *info, UNUSED const char
 
    /* .. and execute unflushed calls directly. */
    if (next->num_total_slots) {
+      if (!start_time)
+         start_time = os_time_get_nano();
       p_atomic_add(&tc->num_direct_slots, next->num_total_slots);
       tc->bytes_mapped_estimate = 0;
       tc_batch_execute(next, NULL, 0);
@@ -684,6 +732,7 @@ _tc_sync(struct threaded_context *tc, UNUSED const char *info, UNUSED const char
 
    if (synced) {
       p_atomic_inc(&tc->num_syncs);
+      tc_add_sync_stat(tc, func, os_time_get_nano() - start_time);
 
       if (tc_strcmp(func, "tc_destroy") != 0) {
          tc_printf("sync %s %s", func, info);
@@ -4880,6 +4929,17 @@ tc_destroy(struct pipe_context *_pipe)
 
    tc_sync(tc);
 
+   if (tc->print_sync_stats) {
+      mesa_logi("tc: %u syncs (%.3f ms), %u early flushes",
+                tc->num_syncs, tc->sync_time_ns / 1000000.0,
+                tc->num_early_flushes);
+      for (unsigned i = 0; i < tc->num_sync_stats; i++) {
+         mesa_logi("tc:   %-40s %8u syncs %10.3f ms", tc->sync_stats[i].func,
+                   tc->sync_stats[i].count,
+                   tc->sync_stats[i].time_ns / 1000000.0);
+      }
+   }
+
    if (util_queue_is_initialized(&tc->queue)) {
       util_queue_destroy(&tc->queue);
 
@@ -4990,6 +5050,15 @@ threaded_context_create(struct pipe_context *pipe,
       goto fail;
 
    tc->use_forced_staging_uploads = true;
+   tc->print_sync_stats = debug_get_bool_option("GALLIUM_THREAD_STATS", false);
+
+   /* Drivers that call tc_driver_internal_flush_notify get flushed every
+    * TC_MAX_BUFFER_LISTS / 2 batches, so smaller batches would mean more
+    * driver flushes.
+    */
+   tc->early_flush = debug_get_bool_option("GALLIUM_THREAD_EARLY_FLUSH",
+                                           !tc->options.driver_calls_flush_notify);
+   tc->early_flush_slots = tc->early_flush ? TC_MIN_EARLY_FLUSH_SLOTS : UINT_MAX;
 
    /* The queue size is the number of batches "waiting". Batches are removed
     * from the queue before being executed, so keep one tc_batch slot for that
@@ -250,6 +250,17 @@ struct tc_unflushed_batch_token;
  */
 #define TC_SLOTS_PER_BATCH    1536
 
+/* When the driver thread is idle, a batch is flushed as soon as it contains
+ * this many slots instead of waiting for it to fill up, so that the driver
+ * thread doesn't sit idle while the application thread keeps recording.
+ * The threshold grows (up to TC_SLOTS_PER_BATCH) while the driver thread is
+ * busy and shrinks back when it becomes idle.
+ */
+#define TC_MIN_EARLY_FLUSH_SLOTS (TC_SLOTS_PER_BATCH / 8)
+
+/* The maximum number of distinct callers of tc_sync that are tracked. */
+#define TC_MAX_SYNC_STATS     32
+
 /* The buffer list queue is much deeper than the batch queue because buffer
  * lists need to stay around until the driver internally flushes its command
  * buffer.
@@ -544,6 +555,12 @@ struct threaded_context_options {
    void (*fs_parse)(void *state, struct tc_renderpass_info *info);
 };
 
+struct tc_sync_stat {
+   const char *func;
+   unsigned count;
+   uint64_t time_ns;
+};
+
 struct threaded_context {
    struct pipe_context base;
    struct pipe_context *pipe;
@@ -559,6 +576,19 @@ struct threaded_context {
    unsigned num_offloaded_slots;
    unsigned num_direct_slots;
    unsigned num_syncs;
+   unsigned num_early_flushes;
+   uint64_t sync_time_ns;
+
+   /* Time spent waiting in tc_sync, per calling function. Only printed
+    * if GALLIUM_THREAD_STATS is set.
+    */
+   struct tc_sync_stat sync_stats[TC_MAX_SYNC_STATS];
+   unsigned num_sync_stats;
+   bool print_sync_stats;
+
+   /* Adaptive batch sizing, see TC_MIN_EARLY_FLUSH_SLOTS. */
+   bool early_flush;
+   unsigned early_flush_slots;
 
    bool use_forced_staging_uploads;
    bool add_all_gfx_bindings_to_buffer_list;
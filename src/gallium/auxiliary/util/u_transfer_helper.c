@@ -317,57 +317,31 @@ u_transfer_helper_transfer_map(struct pipe_context *pctx,
       if (needs_pack(usage)) {
          switch (prsc->format) {
          case PIPE_FORMAT_Z32_FLOAT_S8X24_UINT:
-            util_format_z32_float_s8x24_uint_pack_z_float(trans->staging,
+            util_format_z32_float_s8x24_uint_pack_separate(trans->staging,
+                                                           ptrans->stride,
+                                                           trans->ptr,
+                                                           trans->trans->stride,
+                                                           trans->ptr2,
+                                                           trans->trans2->stride,
+                                                           width, height);
+            break;
+         case PIPE_FORMAT_Z24_UNORM_S8_UINT:
+            if (helper->z24_in_z32f) {
+               util_format_z24_unorm_s8_uint_pack_separate_z32(trans->staging,
+                                                               ptrans->stride,
+                                                               trans->ptr,
+                                                               trans->trans->stride,
+                                                               trans->ptr2,
+                                                               trans->trans2->stride,
+                                                               width, height);
+            } else {
+               util_format_z24_unorm_s8_uint_pack_separate(trans->staging,
                                                           ptrans->stride,
                                                           trans->ptr,
                                                           trans->trans->stride,
-                                                          width, height);
-            util_format_z32_float_s8x24_uint_pack_s_8uint(trans->staging,
-                                                          ptrans->stride,
                                                           trans->ptr2,
                                                           trans->trans2->stride,
                                                           width, height);
-            break;
-         case PIPE_FORMAT_Z24_UNORM_S8_UINT:
-            if (in_place_zs_interleave) {
-               if (helper->z24_in_z32f) {
-                  util_format_z24_unorm_s8_uint_pack_separate_z32(trans->staging,
-                                                                  ptrans->stride,
-                                                                  trans->ptr,
-                                                                  trans->trans->stride,
-                                                                  trans->ptr2,
-                                                                  trans->trans2->stride,
-                                                                  width, height);
-               } else {
-                  util_format_z24_unorm_s8_uint_pack_separate(trans->staging,
-                                                             ptrans->stride,
-                                                             trans->ptr,
-                                                             trans->trans->stride,
-                                                             trans->ptr2,
-                                                             trans->trans2->stride,
-                                                             width, height);
-               }
-            } else {
-               if (helper->z24_in_z32f) {
-                  util_format_z24_unorm_s8_uint_pack_z_float(trans->staging,
-                                                             ptrans->stride,
-                                                             trans->ptr,
-                                                             trans->trans->stride,
-                                                             width, height);
-                  util_format_z24_unorm_s8_uint_pack_s_8uint(trans->staging,
-                                                             ptrans->stride,
-                                                             trans->ptr2,
-                                                             trans->trans2->stride,
-                                                             width, height);
-               } else {
-                  util_format_z24_unorm_s8_uint_pack_separate(trans->staging,
-                                                              ptrans->stride,
-                                                              trans->ptr,
-                                                              trans->trans->stride,
-                                                              trans->ptr2,
-                                                              trans->trans2->stride,
-                                                              width, height);
-               }
             }
             break;
          case PIPE_FORMAT_Z24X8_UNORM:
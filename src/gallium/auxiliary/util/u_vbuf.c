@@ -186,6 +186,11 @@ struct u_vbuf {
    unsigned fallback_vbs[VB_NUM];
    unsigned fallback_vbs_mask;
 
+   /* The translate object used by the last draw for each type, so that
+    * drawing the same geometry repeatedly doesn't hash the key again. */
+   struct translate *last_translate[VB_NUM];
+   struct translate_key last_translate_key[VB_NUM];
+
    /* Which buffer is a user buffer. */
    uint32_t user_vb_mask; /* each bit describes a corresp. buffer */
    /* Which buffer is incompatible (unaligned). */
@@ -455,8 +460,22 @@ void u_vbuf_destroy(struct u_vbuf *mgr)
    FREE(mgr);
 }
 
+static struct translate *
+u_vbuf_get_translate(struct u_vbuf *mgr, unsigned type,
+                     struct translate_key *key)
+{
+   if (mgr->last_translate[type] &&
+       translate_key_compare(key, &mgr->last_translate_key[type]) == 0)
+      return mgr->last_translate[type];
+
+   mgr->last_translate[type] = translate_cache_find(mgr->translate_cache, key);
+   memcpy(&mgr->last_translate_key[type], key, translate_keysize(key));
+   return mgr->last_translate[type];
+}
+
 static enum pipe_error
-u_vbuf_translate_buffers(struct u_vbuf *mgr, struct translate_key *key,
+u_vbuf_translate_buffers(struct u_vbuf *mgr, unsigned type,
+                         struct translate_key *key,
                          const struct pipe_draw_info *info,
                          const struct pipe_draw_start_count_bias *draw,
                          unsigned vb_mask, unsigned out_vb,
@@ -470,7 +489,7 @@ u_vbuf_translate_buffers(struct u_vbuf *mgr, struct translate_key *key,
    unsigned out_offset, mask;
 
    /* Get a translate object. */
-   tr = translate_cache_find(mgr->translate_cache, key);
+   tr = u_vbuf_get_translate(mgr, type, key);
 
    /* Map buffers we want to translate. */
    mask = vb_mask;
@@ -796,7 +815,7 @@ u_vbuf_translate_begin(struct u_vbuf *mgr,
          enum pipe_error err;
          if (!mgr->caps.attrib_component_unaligned)
             key[type].output_stride = align(key[type].output_stride, min_alignment[type]);
-         err = u_vbuf_translate_buffers(mgr, &key[type], info, draw,
+         err = u_vbuf_translate_buffers(mgr, type, &key[type], info, draw,
                                         mask[type], mgr->fallback_vbs[type],
                                         start[type], num[type], min_index,
                                         unroll_indices && type == VB_VERTEX);
@@ -766,15 +766,21 @@ set_viewport(struct vl_compositor_state *s,
 
    assert(s && drawn);
 
-   void *ptr = pipe_buffer_map(s->pipe, s->shader_params,
-                               PIPE_MAP_READ | PIPE_MAP_WRITE,
-                               &buf_transfer);
+   /* Only map the viewport part after the CSC matrix and luma range, and
+    * discard it, so that the driver doesn't have to wait for the previous
+    * layer's dispatch to finish reading it.
+    */
+   const unsigned offset = sizeof(vl_csc_matrix) + 2 * sizeof(float);
+
+   void *ptr = pipe_buffer_map_range(s->pipe, s->shader_params, offset,
+                                     s->shader_params->width0 - offset,
+                                     PIPE_MAP_WRITE | PIPE_MAP_DISCARD_RANGE,
+                                     &buf_transfer);
 
    if (!ptr)
      return false;
 
    float *ptr_float = (float *)ptr;
-   ptr_float += sizeof(vl_csc_matrix)/sizeof(float) + 2;
    *ptr_float++ = drawn->scale_x;
    *ptr_float++ = drawn->scale_y;
 
@@ -802,8 +808,8 @@ set_viewport(struct vl_compositor_state *s,
       *ptr_float++ = v_ratio;
    }
    else {
-      ptr_float++;
-      ptr_float++;
+      *ptr_float++ = 1.0f;
+      *ptr_float++ = 1.0f;
    }
    ptr_int = (int *)ptr_float;
    *ptr_int++ = drawn->crop_x;
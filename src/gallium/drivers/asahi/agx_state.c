@@ -1529,20 +1529,11 @@ agx_compile_variant(struct agx_device *dev, struct agx_uncompiled_shader *so,
    return compiled;
 }
 
-static struct agx_compiled_shader *
-agx_get_shader_variant(struct agx_screen *screen,
-                       struct agx_uncompiled_shader *so,
-                       struct util_debug_callback *debug,
-                       union asahi_shader_key *key)
+static void
+agx_add_shader_variant(struct agx_uncompiled_shader *so,
+                       const union asahi_shader_key *key,
+                       struct agx_compiled_shader *compiled)
 {
-   struct agx_compiled_shader *compiled =
-      agx_disk_cache_retrieve(screen, so, key);
-
-   if (!compiled) {
-      compiled = agx_compile_variant(&screen->dev, so, debug, key);
-      agx_disk_cache_store(screen->disk_cache, so, key, compiled);
-   }
-
    /* key may be destroyed after we return, so clone it before using it as a
     * hash table key. The clone is logically owned by the hash table.
     */
@@ -1559,7 +1550,23 @@ agx_get_shader_variant(struct agx_screen *screen,
    }
 
    _mesa_hash_table_insert(so->variants, cloned_key, compiled);
+}
+
+static struct agx_compiled_shader *
+agx_get_shader_variant(struct agx_screen *screen,
+                       struct agx_uncompiled_shader *so,
+                       struct util_debug_callback *debug,
+                       union asahi_shader_key *key)
+{
+   struct agx_compiled_shader *compiled =
+      agx_disk_cache_retrieve(screen, so, key);
+
+   if (!compiled) {
+      compiled = agx_compile_variant(&screen->dev, so, debug, key);
+      agx_disk_cache_store(screen->disk_cache, so, key, compiled);
+   }
 
+   agx_add_shader_variant(so, key, compiled);
    return compiled;
 }
 
@@ -1605,7 +1612,9 @@ agx_create_shader_state(struct pipe_context *pctx,
    agx_preprocess_nir(nir, true, &so->info);
 
    /* For shader-db, precompile a shader with a default key. This could be
-    * improved but hopefully this is acceptable for now.
+    * improved but hopefully this is acceptable for now. Keep the variant in
+    * the variant table so a draw with the same key reuses it instead of
+    * compiling it again.
     */
    if (dev->debug & AGX_DBG_PRECOMPILE) {
       union asahi_shader_key key = {0};
@@ -1646,7 +1655,9 @@ agx_create_shader_state(struct pipe_context *pctx,
          unreachable("Unknown shader stage in shader-db precompile");
       }
 
-      agx_compile_variant(dev, so, &pctx->debug, &key);
+      struct agx_compiled_shader *compiled =
+         agx_compile_variant(dev, so, &pctx->debug, &key);
+      agx_add_shader_variant(so, &key, compiled);
    }
 
    return so;
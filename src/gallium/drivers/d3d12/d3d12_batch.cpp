@@ -60,6 +60,8 @@ d3d12_init_batch(struct d3d12_context *ctx, struct d3d12_batch *batch)
                                         _mesa_key_pointer_equal);
    batch->sampler_tables = _mesa_hash_table_create(NULL, d3d12_sampler_desc_table_key_hash,
                                                    d3d12_sampler_desc_table_key_equals);
+   batch->srv_tables = _mesa_hash_table_create(NULL, d3d12_sampler_desc_table_key_hash,
+                                               d3d12_sampler_desc_table_key_equals);
    batch->sampler_views = _mesa_set_create(NULL, _mesa_hash_pointer,
                                            _mesa_key_pointer_equal);
    batch->surfaces = _mesa_set_create(NULL, _mesa_hash_pointer,
@@ -68,7 +70,7 @@ d3d12_init_batch(struct d3d12_context *ctx, struct d3d12_batch *batch)
                                      _mesa_hash_pointer,
                                      _mesa_key_pointer_equal);
 
-   if (!batch->bos || !batch->sampler_tables || !batch->sampler_views || !batch->surfaces || !batch->objects)
+   if (!batch->bos || !batch->sampler_tables || !batch->srv_tables || !batch->sampler_views || !batch->surfaces || !batch->objects)
       return false;
 
    util_dynarray_init(&batch->zombie_samplers, NULL);
@@ -108,8 +110,8 @@ delete_bo_entry(hash_entry *entry)
    d3d12_bo_unreference(bo);
 }
 
-static void
-delete_sampler_view_table(hash_entry *entry)
+void
+d3d12_batch_delete_desc_table(struct hash_entry *entry)
 {
    FREE((void*)entry->key);
    FREE(entry->data);
@@ -150,7 +152,8 @@ d3d12_reset_batch(struct d3d12_context *ctx, struct d3d12_batch *batch, uint64_t
    }
 
    _mesa_hash_table_clear(batch->bos, delete_bo_entry);
-   _mesa_hash_table_clear(batch->sampler_tables, delete_sampler_view_table);
+   _mesa_hash_table_clear(batch->sampler_tables, d3d12_batch_delete_desc_table);
+   _mesa_hash_table_clear(batch->srv_tables, d3d12_batch_delete_desc_table);
    _mesa_set_clear(batch->sampler_views, delete_sampler_view);
    _mesa_set_clear(batch->surfaces, delete_surface);
    _mesa_set_clear(batch->objects, delete_object);
@@ -187,6 +190,7 @@ d3d12_destroy_batch(struct d3d12_context *ctx, struct d3d12_batch *batch)
    d3d12_descriptor_heap_free(batch->view_heap);
    _mesa_hash_table_destroy(batch->bos, NULL);
    _mesa_hash_table_destroy(batch->sampler_tables, NULL);
+   _mesa_hash_table_destroy(batch->srv_tables, NULL);
    _mesa_set_destroy(batch->sampler_views, NULL);
    _mesa_set_destroy(batch->surfaces, NULL);
    _mesa_set_destroy(batch->objects, NULL);
@@ -48,6 +48,7 @@ struct d3d12_batch {
    struct hash_table *bos;
    struct util_dynarray local_bos;
    struct hash_table *sampler_tables;
+   struct hash_table *srv_tables;
    struct set *sampler_views;
    struct set *surfaces;
    struct set *objects;
@@ -101,4 +102,8 @@ void
 d3d12_batch_reference_object(struct d3d12_batch *batch,
                              ID3D12Object *object);
 
+/* Frees an entry of the sampler_tables or srv_tables caches */
+void
+d3d12_batch_delete_desc_table(struct hash_entry *entry);
+
 #endif
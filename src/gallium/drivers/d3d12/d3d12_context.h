@@ -174,6 +174,8 @@ struct d3d12_context {
    struct u_suballocator so_allocator;
    struct hash_table *pso_cache;
    struct hash_table *compute_pso_cache;
+   unsigned pso_cache_hits;
+   unsigned pso_cache_misses;
    struct hash_table *root_signature_cache;
    struct hash_table *cmd_signature_cache;
    struct hash_table *gs_variant_cache;
@@ -89,10 +89,10 @@ fill_srv_descriptors(struct d3d12_context *ctx,
 {
    struct d3d12_batch *batch = d3d12_current_batch(ctx);
    struct d3d12_screen *screen = d3d12_screen(ctx->base.screen);
-   D3D12_CPU_DESCRIPTOR_HANDLE descs[PIPE_MAX_SHADER_SAMPLER_VIEWS];
-   struct d3d12_descriptor_handle table_start;
+   struct d3d12_sampler_desc_table_key view_table;
+   D3D12_CPU_DESCRIPTOR_HANDLE *descs = view_table.descs;
 
-   d2d12_descriptor_heap_get_next_handle(batch->view_heap, &table_start);
+   view_table.count = shader->end_srv_binding - shader->begin_srv_binding;
 
    for (unsigned i = shader->begin_srv_binding; i < shader->end_srv_binding; i++)
    {
@@ -114,6 +114,11 @@ fill_srv_descriptors(struct d3d12_context *ctx,
          if (view->texture_generation_id != res->generation_id) {
             d3d12_init_sampler_view_descriptor(view);
             view->texture_generation_id = res->generation_id;
+
+            /* Tables written earlier in this batch hold the old contents of
+             * this descriptor, so they can't be reused from now on.
+             */
+            _mesa_hash_table_clear(batch->srv_tables, d3d12_batch_delete_desc_table);
          }
 
          D3D12_RESOURCE_STATES state = (stage == PIPE_SHADER_FRAGMENT) ?
@@ -137,9 +142,23 @@ fill_srv_descriptors(struct d3d12_context *ctx,
       }
    }
 
-   d3d12_descriptor_heap_append_handles(batch->view_heap, descs, shader->end_srv_binding - shader->begin_srv_binding);
+   hash_entry *table_entry =
+      (hash_entry *)_mesa_hash_table_search(batch->srv_tables, &view_table);
+   if (table_entry)
+      return ((d3d12_descriptor_handle *)table_entry->data)->gpu_handle;
 
-   return table_start.gpu_handle;
+   d3d12_sampler_desc_table_key *table_key = MALLOC_STRUCT(d3d12_sampler_desc_table_key);
+   table_key->count = view_table.count;
+   memcpy(table_key->descs, view_table.descs, view_table.count * sizeof(view_table.descs[0]));
+
+   d3d12_descriptor_handle *table_data = MALLOC_STRUCT(d3d12_descriptor_handle);
+   d2d12_descriptor_heap_get_next_handle(batch->view_heap, table_data);
+
+   d3d12_descriptor_heap_append_handles(batch->view_heap, descs, view_table.count);
+
+   _mesa_hash_table_insert(batch->srv_tables, table_key, table_data);
+
+   return table_data->gpu_handle;
 }
 
 static D3D12_GPU_DESCRIPTOR_HANDLE
@@ -32,6 +32,7 @@
 #include "d3d12_pipeline_state.h"
 #include "d3d12_compiler.h"
 #include "d3d12_context.h"
+#include "d3d12_debug.h"
 #include "d3d12_screen.h"
 #ifndef _GAMING_XBOX
 #include <directx/d3dx12_pipeline_state_stream.h>
@@ -392,6 +393,8 @@ d3d12_get_gfx_pipeline_state(struct d3d12_context *ctx)
       if (!data)
          return NULL;
 
+      ctx->pso_cache_misses++;
+
       data->key = ctx->gfx_pipeline_state;
       data->pso = create_gfx_pipeline_state(ctx);
       if (!data->pso) {
@@ -401,6 +404,8 @@ d3d12_get_gfx_pipeline_state(struct d3d12_context *ctx)
 
       entry = _mesa_hash_table_insert_pre_hashed(ctx->pso_cache, hash, &data->key, data);
       assert(entry);
+   } else {
+      ctx->pso_cache_hits++;
    }
 
    return ((struct d3d12_gfx_pso_entry *)(entry->data))->pso;
@@ -410,6 +415,8 @@ void
 d3d12_gfx_pipeline_state_cache_init(struct d3d12_context *ctx)
 {
    ctx->pso_cache = _mesa_hash_table_create(NULL, NULL, equals_gfx_pipeline_state);
+   ctx->pso_cache_hits = 0;
+   ctx->pso_cache_misses = 0;
 }
 
 static void
@@ -434,6 +441,9 @@ remove_gfx_entry(struct d3d12_context *ctx, struct hash_entry *entry)
 void
 d3d12_gfx_pipeline_state_cache_destroy(struct d3d12_context *ctx)
 {
+   if (d3d12_debug & D3D12_DEBUG_VERBOSE)
+      debug_printf("D3D12: graphics PSO cache: %u hits, %u misses\n",
+                   ctx->pso_cache_hits, ctx->pso_cache_misses);
    _mesa_hash_table_destroy(ctx->pso_cache, delete_gfx_entry);
 }
 
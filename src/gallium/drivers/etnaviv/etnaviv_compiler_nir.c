@@ -996,6 +996,32 @@ emit_shader(struct etna_compile *c, unsigned *num_temps, unsigned *num_consts)
    return true;
 }
 
+static unsigned
+count_loops(struct exec_list *cf_list)
+{
+   unsigned num_loops = 0;
+
+   foreach_list_typed(nir_cf_node, node, node, cf_list) {
+      switch (node->type) {
+      case nir_cf_node_block:
+         break;
+      case nir_cf_node_if: {
+         nir_if *nif = nir_cf_node_as_if(node);
+         num_loops += count_loops(&nif->then_list);
+         num_loops += count_loops(&nif->else_list);
+         break;
+      }
+      case nir_cf_node_loop:
+         num_loops += 1 + count_loops(&nir_cf_node_as_loop(node)->body);
+         break;
+      default:
+         unreachable("unknown cf node type");
+      }
+   }
+
+   return num_loops;
+}
+
 static bool
 etna_compile_check_limits(struct etna_shader_variant *v)
 {
@@ -1084,7 +1110,6 @@ etna_compile_shader(struct etna_shader_variant *v)
 
    v->stage = s->info.stage;
    v->uses_discard = s->info.fs.uses_discard;
-   v->num_loops = 0; /* TODO */
    v->vs_id_in_reg = -1;
    v->vs_pos_out_reg = -1;
    v->vs_pointsize_out_reg = -1;
@@ -1196,6 +1221,8 @@ etna_compile_shader(struct etna_shader_variant *v)
    if (DBG_ENABLED(ETNA_DBG_DUMP_SHADERS))
       nir_print_shader(s, stdout);
 
+   v->num_loops = count_loops(&nir_shader_get_entrypoint(s)->body);
+
    unsigned block_ptr[nir_shader_get_entrypoint(s)->num_blocks];
    c->block_ptr = block_ptr;
 
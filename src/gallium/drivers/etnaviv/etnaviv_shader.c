@@ -67,6 +67,7 @@ etna_dump_shader(const struct etna_shader_variant *shader)
 
    etna_disasm(shader->code, shader->code_size, PRINT_RAW);
 
+   printf("num instructions: %i\n", shader->code_size / 4);
    printf("num loops: %i\n", shader->num_loops);
    printf("num temps: %i\n", shader->num_temps);
    printf("immediates:\n");
@@ -28,11 +28,16 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #define TEX_TILE_WIDTH (4)
 #define TEX_TILE_HEIGHT (4)
 #define TEX_TILE_WORDS (TEX_TILE_WIDTH * TEX_TILE_HEIGHT)
 
+/* Each row of a 4x4 tile holds TEX_TILE_WIDTH consecutive texels, so
+ * tile-aligned spans are moved one tile row at a time with a fixed size
+ * memcpy, which the compiler turns into a single vector load/store. Only
+ * the unaligned head and tail of a row go through the per-texel loop. */
 #define DO_TILE(type)                                                   \
    src_stride /= sizeof(type);                                          \
    dst_stride = (dst_stride * TEX_TILE_HEIGHT) / sizeof(type);          \
@@ -40,11 +45,23 @@
       unsigned dsty = basey + srcy;                                     \
       unsigned ty = (dsty / TEX_TILE_HEIGHT) * dst_stride +             \
                     (dsty % TEX_TILE_HEIGHT) * TEX_TILE_WIDTH;          \
-      for (unsigned srcx = 0; srcx < width; ++srcx) {                   \
+      const type *src_row = (type *)src + srcy * src_stride;            \
+      unsigned srcx = 0;                                                \
+      for (; srcx < width && (basex + srcx) % TEX_TILE_WIDTH; ++srcx) { \
          unsigned dstx = basex + srcx;                                  \
          ((type *)dest)[ty + (dstx / TEX_TILE_WIDTH) * TEX_TILE_WORDS + \
-                        (dstx % TEX_TILE_WIDTH)] =                      \
-            ((type *)src)[srcy * src_stride + srcx];                    \
+                        (dstx % TEX_TILE_WIDTH)] = src_row[srcx];       \
+      }                                                                 \
+      for (; srcx + TEX_TILE_WIDTH <= width; srcx += TEX_TILE_WIDTH) {  \
+         unsigned dstx = basex + srcx;                                  \
+         memcpy((type *)dest + ty +                                     \
+                   (dstx / TEX_TILE_WIDTH) * TEX_TILE_WORDS,            \
+                src_row + srcx, TEX_TILE_WIDTH * sizeof(type));         \
+      }                                                                 \
+      for (; srcx < width; ++srcx) {                                    \
+         unsigned dstx = basex + srcx;                                  \
+         ((type *)dest)[ty + (dstx / TEX_TILE_WIDTH) * TEX_TILE_WORDS + \
+                        (dstx % TEX_TILE_WIDTH)] = src_row[srcx];       \
       }                                                                 \
    }
 
@@ -55,9 +72,23 @@
       unsigned srcy = basey + dsty;                                       \
       unsigned sy = (srcy / TEX_TILE_HEIGHT) * src_stride +               \
                     (srcy % TEX_TILE_HEIGHT) * TEX_TILE_WIDTH;            \
-      for (unsigned dstx = 0; dstx < width; ++dstx) {                     \
+      type *dst_row = (type *)dest + dsty * dst_stride;                   \
+      unsigned dstx = 0;                                                  \
+      for (; dstx < width && (basex + dstx) % TEX_TILE_WIDTH; ++dstx) {   \
+         unsigned srcx = basex + dstx;                                    \
+         dst_row[dstx] =                                                  \
+            ((type *)src)[sy + (srcx / TEX_TILE_WIDTH) * TEX_TILE_WORDS + \
+                          (srcx % TEX_TILE_WIDTH)];                       \
+      }                                                                   \
+      for (; dstx + TEX_TILE_WIDTH <= width; dstx += TEX_TILE_WIDTH) {    \
+         unsigned srcx = basex + dstx;                                    \
+         memcpy(dst_row + dstx,                                           \
+                (type *)src + sy + (srcx / TEX_TILE_WIDTH) * TEX_TILE_WORDS, \
+                TEX_TILE_WIDTH * sizeof(type));                           \
+      }                                                                   \
+      for (; dstx < width; ++dstx) {                                      \
          unsigned srcx = basex + dstx;                                    \
-         ((type *)dest)[dsty * dst_stride + dstx] =                       \
+         dst_row[dstx] =                                                  \
             ((type *)src)[sy + (srcx / TEX_TILE_WIDTH) * TEX_TILE_WORDS + \
                           (srcx % TEX_TILE_WIDTH)];                       \
       }                                                                   \
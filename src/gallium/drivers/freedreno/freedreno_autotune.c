@@ -23,6 +23,7 @@
 
 #include "freedreno_autotune.h"
 #include "freedreno_batch.h"
+#include "freedreno_tracepoints.h"
 #include "freedreno_util.h"
 
 /**
@@ -203,11 +204,9 @@ fd_autotune_use_bypass(struct fd_autotune *at, struct fd_batch *batch)
    batch->autotune_result->cost = batch->cost;
 
    bool use_bypass = fallback_use_bypass(batch);
+   float avg_samples = 0.0f;
 
-   if (use_bypass)
-      return true;
-
-   if (history->num_results > 0) {
+   if (!use_bypass && history->num_results > 0) {
       uint32_t total_samples = 0;
 
       // TODO we should account for clears somehow
@@ -218,30 +217,35 @@ fd_autotune_use_bypass(struct fd_autotune *at, struct fd_batch *batch)
          total_samples += result->samples_passed;
       }
 
-      float avg_samples = (float)total_samples / (float)history->num_results;
+      avg_samples = (float)total_samples / (float)history->num_results;
 
       /* Low sample count could mean there was only a clear.. or there was
        * a clear plus draws that touch no or few samples
        */
-      if (avg_samples < 500.0f)
-         return true;
-
-      /* Cost-per-sample is an estimate for the average number of reads+
-       * writes for a given passed sample.
-       */
-      float sample_cost = batch->cost;
-      sample_cost /= batch->num_draws;
-
-      float total_draw_cost = (avg_samples * sample_cost) / batch->num_draws;
-      DBG("%08x:%u\ttotal_samples=%u, avg_samples=%f, sample_cost=%f, "
-          "total_draw_cost=%f\n",
-          batch->hash, batch->num_draws, total_samples, avg_samples,
-          sample_cost, total_draw_cost);
-
-      if (total_draw_cost < 3000.0f)
-         return true;
+      if (avg_samples < 500.0f) {
+         use_bypass = true;
+      } else {
+         /* Cost-per-sample is an estimate for the average number of reads+
+          * writes for a given passed sample.
+          */
+         float sample_cost = batch->cost;
+         sample_cost /= batch->num_draws;
+
+         float total_draw_cost =
+            (avg_samples * sample_cost) / batch->num_draws;
+         DBG("%08x:%u\ttotal_samples=%u, avg_samples=%f, sample_cost=%f, "
+             "total_draw_cost=%f\n",
+             batch->hash, batch->num_draws, total_samples, avg_samples,
+             sample_cost, total_draw_cost);
+
+         if (total_draw_cost < 3000.0f)
+            use_bypass = true;
+      }
    }
 
+   trace_autotune(&batch->trace, batch->gmem, history->num_results,
+                  (uint32_t)avg_samples, use_bypass);
+
    return use_bypass;
 }
 
@@ -93,6 +93,14 @@ singular_tp('flush_batch',
         '__entry->cleared', '__entry->gmem_reason', '__entry->num_draws'],
 )
 
+singular_tp('autotune',
+    args=[TracepointArg(type='uint8_t',  var='num_results', c_format='%u'),
+          TracepointArg(type='uint32_t', var='avg_samples', c_format='%u'),
+          TracepointArg(type='uint8_t',  var='use_bypass',  c_format='%u')],
+    tp_print=['num_results=%u, avg_samples=%u, use_bypass=%u',
+        '__entry->num_results', '__entry->avg_samples', '__entry->use_bypass'],
+)
+
 singular_tp('render_gmem',
     args=[TracepointArg(type='uint16_t', var='nbins_x', c_format='%u'),
           TracepointArg(type='uint16_t', var='nbins_y', c_format='%u'),
@@ -1059,17 +1059,6 @@ alloc_bo_from_cache(struct iris_bufmgr *bufmgr,
       break;
    }
 
-   if (!bo)
-      return NULL;
-
-   /* Zero the contents if necessary.  If this fails, fall back to
-    * allocating a fresh BO, which will always be zeroed by the kernel.
-    */
-   if ((flags & BO_ALLOC_ZEROED) && !zero_bo(bufmgr, flags, bo)) {
-      bo_free(bo);
-      return NULL;
-   }
-
    return bo;
 }
 
@@ -1199,21 +1188,38 @@ iris_bo_alloc(struct iris_bufmgr *bufmgr,
       bucket ? bucket->size : MAX2(ALIGN(size, page_size), page_size);
    enum iris_mmap_mode mmap_mode = iris_bo_alloc_get_mmap_mode(bufmgr, heap, flags);
 
-   simple_mtx_lock(&bufmgr->lock);
-
-   /* Get a buffer out of the cache if available.  First, we try to find
-    * one with a matching memory zone so we can avoid reallocating VMA.
+   /* There's nothing to reuse at sizes we don't cache, so don't bother
+    * taking the lock.
     */
-   bo = alloc_bo_from_cache(bufmgr, bucket, alignment, memzone, mmap_mode,
-                            flags, true);
+   if (bucket) {
+      simple_mtx_lock(&bufmgr->lock);
 
-   /* If that fails, we try for any cached BO, without matching memzone. */
-   if (!bo) {
+      /* Get a buffer out of the cache if available.  First, we try to find
+       * one with a matching memory zone so we can avoid reallocating VMA.
+       */
       bo = alloc_bo_from_cache(bufmgr, bucket, alignment, memzone, mmap_mode,
-                               flags, false);
+                               flags, true);
+
+      /* If that fails, we try for any cached BO, without matching memzone. */
+      if (!bo) {
+         bo = alloc_bo_from_cache(bufmgr, bucket, alignment, memzone,
+                                  mmap_mode, flags, false);
+      }
+
+      simple_mtx_unlock(&bufmgr->lock);
    }
 
-   simple_mtx_unlock(&bufmgr->lock);
+   /* Zero the contents of a reused BO if necessary.  This maps and clears
+    * the whole buffer, so do it after dropping the lock - the BO is off the
+    * cache list and nobody else can see it.  If this fails, fall back to
+    * allocating a fresh BO, which will always be zeroed by the kernel.
+    */
+   if (bo && (flags & BO_ALLOC_ZEROED) && !zero_bo(bufmgr, flags, bo)) {
+      simple_mtx_lock(&bufmgr->lock);
+      bo_free(bo);
+      simple_mtx_unlock(&bufmgr->lock);
+      bo = NULL;
+   }
 
    if (!bo) {
       bo = alloc_fresh_bo(bufmgr, bo_size, flags);
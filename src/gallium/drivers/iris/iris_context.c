@@ -278,6 +278,23 @@ iris_destroy_context(struct pipe_context *ctx)
       unreachable("Unknown hardware generation"); \
    }
 
+/**
+ * u_threaded_context callback to check whether a buffer is busy.
+ *
+ * The threaded context only calls this for buffers that aren't referenced
+ * by any command it hasn't seen flushed, so we don't need to look at the
+ * (driver thread owned) batches - asking the kernel about the BO is enough.
+ * This lets the frontend thread map idle buffers unsynchronized instead of
+ * waiting for the driver thread to drain its queue.
+ */
+static bool
+iris_is_resource_busy(struct pipe_screen *pscreen,
+                      struct pipe_resource *p_res,
+                      UNUSED unsigned usage)
+{
+   return iris_bo_busy(iris_resource_bo(p_res));
+}
+
 /**
  * Create a context.
  *
@@ -386,6 +403,10 @@ iris_create_context(struct pipe_screen *pscreen, void *priv, unsigned flags)
 
    return threaded_context_create(ctx, &screen->transfer_pool,
                                   iris_replace_buffer_storage,
-                                  NULL, /* TODO: asynchronous flushes? */
+                                  &(struct threaded_context_options){
+                                     /* TODO: asynchronous flushes? */
+                                     .is_resource_busy = iris_is_resource_busy,
+                                     .driver_calls_flush_notify = true,
+                                  },
                                   &ice->thrctx);
 }
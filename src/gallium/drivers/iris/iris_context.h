@@ -1023,6 +1023,16 @@ iris_disk_cache_retrieve(struct iris_screen *screen,
                          struct iris_compiled_shader *shader,
                          const void *prog_key,
                          uint32_t prog_key_size);
+void iris_disk_cache_store_blorp(struct disk_cache *cache,
+                                 const void *key, uint32_t key_size,
+                                 const void *kernel, uint32_t kernel_size,
+                                 const struct brw_stage_prog_data *prog_data,
+                                 uint32_t prog_data_size);
+struct iris_compiled_shader *
+iris_disk_cache_retrieve_blorp(struct iris_screen *screen,
+                               struct hash_table *driver_shaders,
+                               struct u_upload_mgr *uploader,
+                               const void *key, uint32_t key_size);
 
 /* iris_program_cache.c */
 
@@ -255,6 +255,136 @@ iris_disk_cache_retrieve(struct iris_screen *screen,
 #endif
 }
 
+/**
+ * Store a newly compiled BLORP kernel in the disk cache.
+ *
+ * BLORP keys fully describe the kernel, so they are hashed directly.
+ */
+void
+iris_disk_cache_store_blorp(struct disk_cache *cache,
+                            const void *key, uint32_t key_size,
+                            const void *kernel, uint32_t kernel_size,
+                            const struct brw_stage_prog_data *prog_data,
+                            uint32_t prog_data_size)
+{
+#ifdef ENABLE_SHADER_CACHE
+   if (!cache)
+      return;
+
+   cache_key cache_key;
+   disk_cache_compute_key(cache, key, key_size, cache_key);
+
+   if (debug) {
+      char sha1[41];
+      _mesa_sha1_format(sha1, cache_key);
+      fprintf(stderr, "[mesa disk cache] storing blorp %s\n", sha1);
+   }
+
+   struct blob blob;
+   blob_init(&blob);
+
+   /* We write the following data to the cache blob:
+    *
+    * 1. Prog data size and prog data
+    * 2. Assembly code (its size is in the prog data)
+    * 3. Shader relocations
+    *
+    * BLORP frees the param array before uploading, so it isn't stored.
+    */
+   assert(kernel_size == prog_data->program_size);
+   blob_write_uint32(&blob, prog_data_size);
+   blob_write_bytes(&blob, prog_data, prog_data_size);
+   blob_write_bytes(&blob, kernel, kernel_size);
+   blob_write_bytes(&blob, prog_data->relocs,
+                    prog_data->num_relocs * sizeof(struct brw_shader_reloc));
+
+   disk_cache_put(cache, cache_key, blob.data, blob.size, NULL);
+   blob_finish(&blob);
+#endif
+}
+
+/**
+ * Search for a BLORP kernel in the disk cache.  If found, upload it to the
+ * in-memory program cache and return it.
+ */
+struct iris_compiled_shader *
+iris_disk_cache_retrieve_blorp(struct iris_screen *screen,
+                               struct hash_table *driver_shaders,
+                               struct u_upload_mgr *uploader,
+                               const void *key, uint32_t key_size)
+{
+#ifdef ENABLE_SHADER_CACHE
+   struct disk_cache *cache = screen->disk_cache;
+
+   if (!cache)
+      return NULL;
+
+   cache_key cache_key;
+   disk_cache_compute_key(cache, key, key_size, cache_key);
+
+   size_t size;
+   void *buffer = disk_cache_get(cache, cache_key, &size);
+
+   if (debug) {
+      char sha1[41];
+      _mesa_sha1_format(sha1, cache_key);
+      fprintf(stderr, "[mesa disk cache] retrieving blorp %s: %s\n", sha1,
+              buffer ? "found" : "missing");
+   }
+
+   if (!buffer)
+      return NULL;
+
+   struct blob_reader blob;
+   blob_reader_init(&blob, buffer, size);
+
+   const uint32_t prog_data_size = blob_read_uint32(&blob);
+   if (blob.overrun || prog_data_size < sizeof(struct brw_stage_prog_data)) {
+      free(buffer);
+      return NULL;
+   }
+
+   struct brw_stage_prog_data *prog_data = ralloc_size(NULL, prog_data_size);
+   blob_copy_bytes(&blob, prog_data, prog_data_size);
+   const void *assembly = blob_read_bytes(&blob, prog_data->program_size);
+
+   prog_data->param = NULL;
+   prog_data->relocs = NULL;
+   if (!blob.overrun && prog_data->num_relocs) {
+      struct brw_shader_reloc *relocs =
+         ralloc_array(NULL, struct brw_shader_reloc, prog_data->num_relocs);
+      blob_copy_bytes(&blob, relocs,
+                      prog_data->num_relocs * sizeof(struct brw_shader_reloc));
+      prog_data->relocs = relocs;
+   }
+
+   if (blob.overrun) {
+      ralloc_free((void *)prog_data->relocs);
+      ralloc_free(prog_data);
+      free(buffer);
+      return NULL;
+   }
+
+   struct iris_binding_table bt;
+   memset(&bt, 0, sizeof(bt));
+
+   struct iris_compiled_shader *shader =
+      iris_create_shader_variant(screen, driver_shaders, IRIS_CACHE_BLORP,
+                                 key_size, key);
+
+   iris_finalize_program(shader, prog_data, NULL, NULL, 0, 0, 0, &bt);
+
+   iris_upload_shader(screen, NULL, shader, driver_shaders, uploader,
+                      IRIS_CACHE_BLORP, key_size, key, assembly);
+
+   free(buffer);
+
+   return shader;
+#else
+   return NULL;
+#endif
+}
+
 /**
  * Initialize the on-disk shader cache.
  */
@@ -264,6 +264,14 @@ iris_fence_flush(struct pipe_context *ctx,
    if (!deferred) {
       iris_foreach_batch(ice, batch)
          iris_batch_flush(batch);
+
+      /* Every batch has been submitted, so let u_threaded_context know that
+       * buffers used by the calls it handed us so far are only referenced
+       * by submitted work now.  Batches flushed on their own (e.g. when they
+       * fill up) don't notify; the threaded context simply keeps treating
+       * their buffers as busy until the next full flush.
+       */
+      tc_driver_internal_flush_notify(ice->thrctx);
    }
 
    if (flags & PIPE_FLUSH_END_OF_FRAME) {
@@ -205,6 +205,13 @@ iris_blorp_lookup_shader(struct blorp_batch *blorp_batch,
    struct iris_compiled_shader *shader =
       iris_find_cached_shader(ice, IRIS_CACHE_BLORP, key_size, key);
 
+   if (!shader) {
+      shader = iris_disk_cache_retrieve_blorp(batch->screen,
+                                              ice->shaders.cache,
+                                              ice->shaders.uploader_driver,
+                                              key, key_size);
+   }
+
    if (!shader)
       return false;
 
@@ -221,9 +228,9 @@ iris_blorp_lookup_shader(struct blorp_batch *blorp_batch,
 bool
 iris_blorp_upload_shader(struct blorp_batch *blorp_batch, uint32_t stage,
                          const void *key, uint32_t key_size,
-                         const void *kernel, UNUSED uint32_t kernel_size,
+                         const void *kernel, uint32_t kernel_size,
                          const struct brw_stage_prog_data *prog_data_templ,
-                         UNUSED uint32_t prog_data_size,
+                         uint32_t prog_data_size,
                          uint32_t *kernel_out, void *prog_data_out)
 {
    struct blorp_context *blorp = blorp_batch->blorp;
@@ -247,6 +254,10 @@ iris_blorp_upload_shader(struct blorp_batch *blorp_batch, uint32_t stage,
                       ice->shaders.uploader_driver,
                       IRIS_CACHE_BLORP, key_size, key, kernel);
 
+   iris_disk_cache_store_blorp(screen->disk_cache, key, key_size,
+                               kernel, kernel_size,
+                               prog_data_templ, prog_data_size);
+
    struct iris_bo *bo = iris_resource_bo(shader->assembly.res);
    *kernel_out =
       iris_bo_offset_from_base_address(bo) + shader->assembly.offset;
@@ -532,8 +532,13 @@ iris_resource_destroy(struct pipe_screen *screen,
 {
    struct iris_resource *res = (struct iris_resource *) p_res;
 
-   if (p_res->target == PIPE_BUFFER)
+   if (p_res->target == PIPE_BUFFER) {
+      struct iris_screen *orig_screen = (void *) res->orig_screen;
+
       util_range_destroy(&res->valid_buffer_range);
+      util_idalloc_mt_free(&orig_screen->buffer_ids,
+                           res->base.buffer_id_unique);
+   }
 
    iris_resource_disable_aux(res);
 
@@ -558,8 +563,12 @@ iris_alloc_resource(struct pipe_screen *pscreen,
    pipe_reference_init(&res->base.b.reference, 1);
    threaded_resource_init(&res->base.b, false);
 
-   if (templ->target == PIPE_BUFFER)
+   if (templ->target == PIPE_BUFFER) {
+      struct iris_screen *screen = (void *) pscreen;
+
       util_range_init(&res->valid_buffer_range);
+      res->base.buffer_id_unique = util_idalloc_mt_alloc(&screen->buffer_ids);
+   }
 
    return res;
 }
@@ -1983,6 +1992,8 @@ iris_replace_buffer_storage(struct pipe_context *ctx,
    screen->vtbl.rebind_buffer(ice, dst);
 
    iris_bo_unreference(old_bo);
+
+   util_idalloc_mt_free(&screen->buffer_ids, delete_buffer_id);
 }
 
 /**
@@ -2634,8 +2645,8 @@ iris_transfer_map(struct pipe_context *ctx,
    if (prefer_cpu_access(res, box, usage, level, map_would_stall))
       usage |= PIPE_MAP_DIRECTLY;
 
-   /* TODO: Teach iris_map_tiled_memcpy about Tile4 and Tile64... */
-   if (res->surf.tiling == ISL_TILING_4 || res->surf.tiling == ISL_TILING_64)
+   /* TODO: Teach iris_map_tiled_memcpy about Tile64... */
+   if (res->surf.tiling == ISL_TILING_64)
       usage &= ~PIPE_MAP_DIRECTLY;
 
    if (!(usage & PIPE_MAP_DIRECTLY)) {
@@ -2760,10 +2771,9 @@ iris_texture_subdata(struct pipe_context *ctx,
     * take that path if we need the GPU to perform color compression, or
     * stall-avoidance blits.
     *
-    * TODO: Teach isl_memcpy_linear_to_tiled about Tile4 and Tile64...
+    * TODO: Teach isl_memcpy_linear_to_tiled about Tile64...
     */
    if (surf->tiling == ISL_TILING_LINEAR ||
-       surf->tiling == ISL_TILING_4 ||
        surf->tiling == ISL_TILING_64 ||
        isl_aux_usage_has_compression(res->aux.usage) ||
        resource_is_busy(ice, res) ||
@@ -666,6 +666,7 @@ iris_screen_destroy(struct iris_screen *screen)
 {
    iris_destroy_screen_measure(screen);
    util_queue_destroy(&screen->shader_compiler_queue);
+   util_idalloc_mt_fini(&screen->buffer_ids);
    glsl_type_singleton_decref();
    iris_bo_unreference(screen->workaround_bo);
    u_transfer_helper_destroy(screen->base.transfer_helper);
@@ -884,6 +885,8 @@ iris_screen_create(int fd, const struct pipe_screen_config *config)
    slab_create_parent(&screen->transfer_pool,
                       sizeof(struct iris_transfer), 64);
 
+   util_idalloc_mt_init_tc(&screen->buffer_ids);
+
    iris_detect_kernel_features(screen);
 
    struct pipe_screen *pscreen = &screen->base;
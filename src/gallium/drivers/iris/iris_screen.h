@@ -27,6 +27,7 @@
 #include "frontend/drm_driver.h"
 #include "util/disk_cache.h"
 #include "util/slab.h"
+#include "util/u_idalloc.h"
 #include "util/u_screen.h"
 #include "intel/dev/intel_device_info.h"
 #include "intel/isl/isl.h"
@@ -162,6 +163,9 @@ struct iris_screen {
    /** Global slab allocator for iris_transfer_map objects */
    struct slab_parent_pool transfer_pool;
 
+   /** Unique IDs for buffers, used by u_threaded_context's busy tracking */
+   struct util_idalloc_mt buffer_ids;
+
    /** drm device file descriptor, shared with bufmgr, do not close. */
    int fd;
 
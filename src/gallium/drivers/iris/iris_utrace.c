@@ -60,6 +60,16 @@ union iris_utrace_timestamp {
    uint32_t compute_walker[4];
 };
 
+static void
+iris_utrace_clear_ts_buffer(struct u_trace_context *utctx, void *timestamps)
+{
+   struct iris_bo *bo = timestamps;
+
+   /* iris_utrace_read_ts() relies on unwritten timestamps being 0 */
+   void *ptr = iris_bo_map(NULL, bo, MAP_READ | MAP_WRITE);
+   memset(ptr, 0, bo->size);
+}
+
 static void *
 iris_utrace_create_ts_buffer(struct u_trace_context *utctx, uint32_t size)
 {
@@ -76,8 +86,7 @@ iris_utrace_create_ts_buffer(struct u_trace_context *utctx, uint32_t size)
                     IRIS_MEMZONE_OTHER,
                     BO_ALLOC_COHERENT | BO_ALLOC_SMEM);
 
-   void *ptr = iris_bo_map(NULL, bo, MAP_READ | MAP_WRITE);
-   memset(ptr, 0, iris_size);
+   iris_utrace_clear_ts_buffer(utctx, bo);
 
    return bo;
 }
@@ -192,6 +201,7 @@ void iris_utrace_init(struct iris_context *ice)
                         iris_utrace_record_ts,
                         iris_utrace_read_ts,
                         iris_utrace_delete_flush_data);
+   ice->ds.trace_context.clear_timestamp_buffer = iris_utrace_clear_ts_buffer;
 
    for (int i = 0; i < IRIS_BATCH_COUNT; i++) {
       intel_ds_device_init_queue(&ice->ds, &ice->batches[i].ds, "%s",
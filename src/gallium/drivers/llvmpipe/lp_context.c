@@ -61,6 +61,8 @@ llvmpipe_destroy(struct pipe_context *pipe)
    mtx_unlock(&lp_screen->ctx_mutex);
    lp_print_counters();
 
+   llvmpipe_cs_finish_pending(llvmpipe);
+
    if (llvmpipe->csctx) {
       lp_csctx_destroy(llvmpipe->csctx);
    }
@@ -220,6 +222,7 @@ llvmpipe_create_context(struct pipe_screen *screen, void *priv,
    list_inithead(&llvmpipe->setup_variants_list.list);
 
    list_inithead(&llvmpipe->cs_variants_list.list);
+   list_inithead(&llvmpipe->cs_pending);
 
    llvmpipe->pipe.screen = screen;
    llvmpipe->pipe.priv = priv;
@@ -277,6 +280,10 @@ llvmpipe_create_context(struct pipe_screen *screen, void *priv,
    if (!llvmpipe->draw)
       goto fail;
 
+   /* Vertex shading may use the cores the rasterizer threads run on. */
+   if (lp_screen->threaded_vs)
+      draw_set_vs_thread_count(llvmpipe->draw, lp_screen->num_threads);
+
    draw_set_disk_cache_callbacks(llvmpipe->draw,
                                  lp_screen,
                                  lp_draw_disk_cache_find_shader,
@@ -177,6 +177,10 @@ struct llvmpipe_context {
    unsigned nr_cs_instrs;
    struct lp_cs_context *csctx;
 
+   /** Compute grids launched but not waited for, see lp_cs_pending */
+   struct list_head cs_pending;
+   unsigned num_cs_pending;
+
    struct lp_cs_context *task_ctx;
    struct lp_cs_context *mesh_ctx;
 
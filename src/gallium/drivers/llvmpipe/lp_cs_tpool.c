@@ -30,12 +30,67 @@
 
 #include "util/u_thread.h"
 #include "util/u_memory.h"
+#include "util/u_atomic.h"
 #include "lp_cs_tpool.h"
 
+static inline uint64_t
+range_pack(uint32_t head, uint32_t tail)
+{
+   return ((uint64_t)tail << 32) | head;
+}
+
+
+/**
+ * Take one iteration off a range, from the head if we own it or from the
+ * tail when stealing.
+ * \return false if the range is empty
+ */
+static bool
+range_pop(struct lp_cs_tpool_range *range, bool steal, unsigned *iter)
+{
+   uint64_t old = p_atomic_read(&range->range);
+
+   for (;;) {
+      const uint32_t head = (uint32_t)old;
+      const uint32_t tail = (uint32_t)(old >> 32);
+
+      if (head >= tail)
+         return false;
+
+      const uint64_t new = steal ? range_pack(head, tail - 1)
+                                 : range_pack(head + 1, tail);
+      const uint64_t prev = p_atomic_cmpxchg(&range->range, old, new);
+      if (prev == old) {
+         *iter = steal ? tail - 1 : head;
+         return true;
+      }
+      old = prev;
+   }
+}
+
+
+static bool
+task_next_iter(struct lp_cs_tpool_task *task, unsigned worker, unsigned *iter)
+{
+   const unsigned own = worker % task->num_ranges;
+
+   if (range_pop(&task->ranges[own], false, iter))
+      return true;
+
+   for (unsigned i = 1; i < task->num_ranges; i++) {
+      if (range_pop(&task->ranges[(own + i) % task->num_ranges], true, iter))
+         return true;
+   }
+
+   return false;
+}
+
+
 static int
 lp_cs_tpool_worker(void *data)
 {
-   struct lp_cs_tpool *pool = data;
+   struct lp_cs_tpool_worker *worker = data;
+   struct lp_cs_tpool *pool = worker->pool;
    struct lp_cs_local_mem lmem;
 
    memset(&lmem, 0, sizeof(lmem));
@@ -43,7 +98,6 @@ lp_cs_tpool_worker(void *data)
 
    while (!pool->shutdown) {
       struct lp_cs_tpool_task *task;
-      unsigned iter_per_thread;
 
       while (list_is_empty(&pool->workqueue) && !pool->shutdown)
          cnd_wait(&pool->new_work, &pool->m);
@@ -53,29 +107,27 @@ lp_cs_tpool_worker(void *data)
 
       task = list_first_entry(&pool->workqueue, struct lp_cs_tpool_task,
                               list);
+      task->active_workers++;
+      mtx_unlock(&pool->m);
 
-      unsigned this_iter = task->iter_start;
-
-      iter_per_thread = task->iter_per_thread;
-
-      if (task->iter_remainder &&
-          task->iter_start + task->iter_remainder == task->iter_total) {
-         task->iter_remainder--;
-         iter_per_thread = 1;
+      /* The iterations are handed out without taking the pool mutex. */
+      unsigned iter, done = 0;
+      while (task_next_iter(task, worker->index, &iter)) {
+         task->work(task->data, iter, &lmem);
+         done++;
       }
 
-      task->iter_start += iter_per_thread;
+      mtx_lock(&pool->m);
 
-      if (task->iter_start == task->iter_total)
+      /* All iterations are handed out, newer tasks can start. */
+      if (task->queued) {
          list_del(&task->list);
+         task->queued = false;
+      }
 
-      mtx_unlock(&pool->m);
-      for (unsigned i = 0; i < iter_per_thread; i++)
-         task->work(task->data, this_iter + i, &lmem);
-
-      mtx_lock(&pool->m);
-      task->iter_finished += iter_per_thread;
-      if (task->iter_finished == task->iter_total)
+      task->iter_finished += done;
+      task->active_workers--;
+      if (task->iter_finished == task->iter_total && !task->active_workers)
          cnd_broadcast(&task->finish);
    }
    mtx_unlock(&pool->m);
@@ -97,7 +149,10 @@ lp_cs_tpool_create(unsigned num_threads)
    list_inithead(&pool->workqueue);
    assert (num_threads <= LP_MAX_THREADS);
    for (unsigned i = 0; i < num_threads; i++) {
-      if (thrd_success != u_thread_create(pool->threads + i, lp_cs_tpool_worker, pool)) {
+      pool->workers[i].pool = pool;
+      pool->workers[i].index = i;
+      if (thrd_success != u_thread_create(pool->threads + i, lp_cs_tpool_worker,
+                                          &pool->workers[i])) {
          num_threads = i;  /* previous thread is max */
          break;
       }
@@ -142,23 +197,40 @@ lp_cs_tpool_queue_task(struct lp_cs_tpool *pool,
       FREE(lmem.local_mem_ptr);
       return NULL;
    }
+   assert(num_iters > 0);
    task = CALLOC_STRUCT(lp_cs_tpool_task);
    if (!task) {
       return NULL;
    }
 
+   task->num_ranges = MIN2(pool->num_threads, num_iters);
+   task->ranges = align_calloc(task->num_ranges * sizeof(*task->ranges),
+                               CACHE_LINE_SIZE);
+   if (!task->ranges) {
+      FREE(task);
+      return NULL;
+   }
+
    task->work = work;
    task->data = data;
    task->iter_total = num_iters;
 
-   task->iter_per_thread = num_iters / pool->num_threads;
-   task->iter_remainder = num_iters % pool->num_threads;
+   /* Give each worker a contiguous share of the iterations. */
+   const unsigned per_range = num_iters / task->num_ranges;
+   const unsigned remainder = num_iters % task->num_ranges;
+   unsigned start = 0;
+   for (unsigned i = 0; i < task->num_ranges; i++) {
+      const unsigned size = per_range + (i < remainder ? 1 : 0);
+      task->ranges[i].range = range_pack(start, start + size);
+      start += size;
+   }
 
    cnd_init(&task->finish);
 
    mtx_lock(&pool->m);
 
    list_addtail(&task->list, &pool->workqueue);
+   task->queued = true;
 
    cnd_broadcast(&pool->new_work);
    mtx_unlock(&pool->m);
@@ -175,11 +247,12 @@ lp_cs_tpool_wait_for_task(struct lp_cs_tpool *pool,
       return;
 
    mtx_lock(&pool->m);
-   while (task->iter_finished < task->iter_total)
+   while (task->iter_finished < task->iter_total || task->active_workers)
       cnd_wait(&task->finish, &pool->m);
    mtx_unlock(&pool->m);
 
    cnd_destroy(&task->finish);
+   align_free(task->ranges);
    FREE(task);
    *task_handle = NULL;
 }
@@ -37,15 +37,24 @@
 #include "util/compiler.h"
 
 #include "util/u_thread.h"
+#include "util/u_memory.h"
 #include "util/list.h"
 
 #include "lp_limits.h"
 
+struct lp_cs_tpool;
+
+struct lp_cs_tpool_worker {
+   struct lp_cs_tpool *pool;
+   unsigned index;
+};
+
 struct lp_cs_tpool {
    mtx_t m;
    cnd_t new_work;
 
    thrd_t threads[LP_MAX_THREADS];
+   struct lp_cs_tpool_worker workers[LP_MAX_THREADS];
    unsigned num_threads;
    struct list_head workqueue;
    bool shutdown;
@@ -58,16 +67,30 @@ struct lp_cs_local_mem {
 
 typedef void (*lp_cs_tpool_task_func)(void *data, int iter_idx, struct lp_cs_local_mem *lmem);
 
+/* The [head, tail) iterations of a task left to one worker, packed as
+ * head | tail << 32 so both ends are updated with a single cmpxchg.
+ */
+struct lp_cs_tpool_range {
+   EXCLUSIVE_CACHELINE(uint64_t range);
+};
+
 struct lp_cs_tpool_task {
    lp_cs_tpool_task_func work;
    void *data;
    struct list_head list;
    cnd_t finish;
    unsigned iter_total;
-   unsigned iter_start;
+
+   /* One range per worker, each worker owning the head of its range and
+    * stealing from the tail of the others once it runs dry.
+    */
+   struct lp_cs_tpool_range *ranges;
+   unsigned num_ranges;
+
+   /* Protected by the pool mutex. */
    unsigned iter_finished;
-   unsigned iter_per_thread;
-   unsigned iter_remainder;
+   unsigned active_workers;
+   bool queued;
 };
 
 struct lp_cs_tpool *lp_cs_tpool_create(unsigned num_threads);
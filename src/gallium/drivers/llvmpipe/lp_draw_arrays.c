@@ -65,6 +65,8 @@ llvmpipe_draw_vbo(struct pipe_context *pipe, const struct pipe_draw_info *info,
    const void *mapped_indices = NULL;
    unsigned i;
 
+   llvmpipe_cs_finish_pending(lp);
+
    if (!llvmpipe_check_render_cond(lp))
       return;
 
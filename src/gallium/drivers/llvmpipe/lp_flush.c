@@ -41,6 +41,7 @@
 #include "lp_fence.h"
 #include "lp_screen.h"
 #include "lp_rast.h"
+#include "lp_state.h"
 
 
 /**
@@ -54,6 +55,8 @@ llvmpipe_flush(struct pipe_context *pipe,
    struct llvmpipe_context *llvmpipe = llvmpipe_context(pipe);
    struct llvmpipe_screen *screen = llvmpipe_screen(pipe->screen);
 
+   llvmpipe_cs_finish_pending(llvmpipe);
+
    draw_flush(llvmpipe->draw);
 
    /* ask the setup module to flush */
@@ -121,6 +124,8 @@ llvmpipe_flush_resource(struct pipe_context *pipe,
    unsigned referenced = 0;
    struct llvmpipe_screen *lp_screen = llvmpipe_screen(pipe->screen);
 
+   llvmpipe_cs_finish_pending_resource(llvmpipe_context(pipe), resource);
+
    mtx_lock(&lp_screen->ctx_mutex);
    list_for_each_entry(struct llvmpipe_context, ctx, &lp_screen->ctx_list, list) {
       referenced |=
@@ -33,7 +33,10 @@
 #include "util/u_pack_color.h"
 #include "util/u_string.h"
 #include "util/u_thread.h"
+#include "util/u_cpu_detect.h"
+#include "util/u_debug.h"
 #include "util/u_memset.h"
+#include "util/u_atomic.h"
 #include "util/os_time.h"
 
 #include "lp_scene_queue.h"
@@ -65,6 +68,68 @@ const float lp_sample_pos_4x[4][2] = { { 0.375, 0.125 },
                                        { 0.125, 0.625 },
                                        { 0.625, 0.875 } };
 
+/**
+ * Take one bin off a thread's queue, from the head if we own the queue or
+ * from the tail when stealing.
+ * \return false if the queue is empty
+ */
+static bool
+bin_queue_pop(struct lp_scene_bin_queue *queue, bool steal, unsigned *index)
+{
+   uint64_t old = p_atomic_read(&queue->range);
+
+   for (;;) {
+      const uint32_t head = (uint32_t)old;
+      const uint32_t tail = (uint32_t)(old >> 32);
+
+      if (head >= tail)
+         return false;
+
+      const uint64_t new = steal ? lp_scene_bin_queue_pack(head, tail - 1)
+                                 : lp_scene_bin_queue_pack(head + 1, tail);
+      const uint64_t prev = p_atomic_cmpxchg(&queue->range, old, new);
+      if (prev == old) {
+         *index = steal ? tail - 1 : head;
+         return true;
+      }
+      old = prev;
+   }
+}
+
+
+/**
+ * Get the next bin for a thread to rasterize: the next one from its own
+ * queue, or failing that one stolen from another thread.
+ * \return false once all bins of the scene have been handed out
+ */
+static bool
+lp_rast_next_bin(struct lp_rasterizer_task *task, unsigned *index)
+{
+   struct lp_scene *scene = task->scene;
+   const unsigned num_queues = scene->num_bin_queues;
+
+   /* The scene was scheduled for the setup's idea of the thread count,
+    * which is normally ours too.  Any queue without an owner thread is
+    * simply drained by stealing.
+    */
+   if (task->thread_index < num_queues &&
+       bin_queue_pop(&scene->bin_queues[task->thread_index], false, index))
+      return true;
+
+   /* Neighbouring queues belong to threads of the same cache domain, so
+    * try those first.
+    */
+   for (unsigned i = 1; i <= num_queues; i++) {
+      const unsigned victim = (task->thread_index + i) % num_queues;
+
+      if (bin_queue_pop(&scene->bin_queues[victim], true, index))
+         return true;
+   }
+
+   return false;
+}
+
+
 /**
  * Begin rasterizing a scene.
  * Called once per scene by one thread.
@@ -77,14 +142,41 @@ lp_rast_begin(struct lp_rasterizer *rast,
 
    LP_DBG(DEBUG_RAST, "%s\n", __func__);
 
+   /* Grab the binning timestamps now: once the scene's fence gets
+    * signalled, setup may reuse the scene while we still report on it.
+    */
+   if (LP_DEBUG & DEBUG_PIPELINE) {
+      rast->pipeline.bin_start = scene->bin_start_time;
+      rast->pipeline.bin_end = scene->bin_end_time;
+      rast->pipeline.rast_start = os_time_get_nano();
+   }
+
    lp_scene_begin_rasterization(scene);
-   lp_scene_bin_iter_begin(scene);
 }
 
 
 static void
 lp_rast_end(struct lp_rasterizer *rast)
 {
+   if (LP_DEBUG & DEBUG_PIPELINE) {
+      const int64_t now = os_time_get_nano();
+
+      if (!rast->pipeline.num_scenes)
+         rast->pipeline.first_time = rast->pipeline.bin_start;
+
+      rast->pipeline.num_scenes++;
+      rast->pipeline.bin_time += rast->pipeline.bin_end -
+                                 rast->pipeline.bin_start;
+      rast->pipeline.rast_time += now - rast->pipeline.rast_start;
+
+      debug_printf("llvmpipe: scene %u binned in %.3f ms, queued for %.3f ms, "
+                   "rasterized in %.3f ms\n",
+                   rast->pipeline.num_scenes,
+                   (rast->pipeline.bin_end - rast->pipeline.bin_start) / 1e6,
+                   (rast->pipeline.rast_start - rast->pipeline.bin_end) / 1e6,
+                   (now - rast->pipeline.rast_start) / 1e6);
+   }
+
    rast->curr_scene = NULL;
 }
 
@@ -1020,20 +1112,6 @@ rasterize_bin(struct lp_rasterizer_task *task,
 }
 
 
-/* An empty bin is one that just loads the contents of the tile and
- * stores them again unchanged.  This typically happens when bins have
- * been flushed for some reason in the middle of a frame, or when
- * incremental updates are being made to a render target.
- *
- * Try to avoid doing pointless work in this case.
- */
-static bool
-is_empty_bin(const struct cmd_bin *bin)
-{
-   return bin->head == NULL;
-}
-
-
 /**
  * Rasterize/execute all bins within a scene.
  * Called per thread.
@@ -1057,14 +1135,17 @@ rasterize_scene(struct lp_rasterizer_task *task,
 #endif
 
    if (!task->rast->no_rast) {
-      /* loop over scene bins, rasterize each */
-      struct cmd_bin *bin;
-      int i, j;
+      /* loop over scene bins, rasterize each.  Empty bins, which would
+       * just load the contents of the tile and store them again unchanged,
+       * were already dropped by lp_scene_schedule_bins().
+       */
+      unsigned index;
 
       assert(scene);
-      while ((bin = lp_scene_bin_iter_next(scene, &i, &j))) {
-         if (!is_empty_bin(bin))
-            rasterize_bin(task, bin, i, j);
+      while (lp_rast_next_bin(task, &index)) {
+         const struct lp_scene_bin_ref *ref = &scene->bins[index];
+         rasterize_bin(task, lp_scene_get_bin(scene, ref->x, ref->y),
+                       ref->x, ref->y);
       }
    }
 
@@ -1225,12 +1306,39 @@ thread_function(void *init_data)
 }
 
 
+DEBUG_GET_ONCE_BOOL_OPTION(pin_threads, "LP_PIN_THREADS", false)
+
+
+/**
+ * Number of cache domains the rasterizer threads are spread over.
+ *
+ * A domain is a set of cores sharing an L3 cache, which on multi-socket
+ * and chiplet CPUs is also the unit of memory locality.  Each thread is
+ * pinned to one domain, and lp_scene schedules a tile to the threads of
+ * the same domain in every scene.
+ */
+unsigned
+lp_rast_num_domains(unsigned num_threads)
+{
+   const struct util_cpu_caps_t *caps = util_get_cpu_caps();
+
+   if (num_threads < 2 || caps->num_L3_caches < 2 || !caps->L3_affinity_mask ||
+       !debug_get_option_pin_threads())
+      return 1;
+
+   return MIN2(caps->num_L3_caches, num_threads);
+}
+
+
 /**
  * Initialize semaphores and spawn the threads.
  */
 static void
 create_rast_threads(struct lp_rasterizer *rast)
 {
+   const struct util_cpu_caps_t *caps = util_get_cpu_caps();
+   const unsigned num_domains = lp_rast_num_domains(rast->num_threads);
+
    /* NOTE: if num_threads is zero, we won't use any threads */
    for (unsigned i = 0; i < rast->num_threads; i++) {
       util_semaphore_init(&rast->tasks[i].work_ready, 0);
@@ -1240,6 +1348,14 @@ create_rast_threads(struct lp_rasterizer *rast)
          rast->num_threads = i; /* previous thread is max */
          break;
       }
+
+      if (num_domains > 1) {
+         const unsigned domain =
+            lp_rast_thread_domain(i, rast->num_threads, num_domains);
+         util_set_thread_affinity(rast->threads[i],
+                                  caps->L3_affinity_mask[domain],
+                                  NULL, caps->num_cpu_mask_bits);
+      }
    }
 }
 
@@ -1308,6 +1424,16 @@ no_rast:
 void
 lp_rast_destroy(struct lp_rasterizer *rast)
 {
+   if ((LP_DEBUG & DEBUG_PIPELINE) && rast->pipeline.num_scenes) {
+      const int64_t wall = os_time_get_nano() - rast->pipeline.first_time;
+
+      debug_printf("llvmpipe: %u scenes in %.3f s, binning busy %.1f%%, "
+                   "rasterization busy %.1f%%\n",
+                   rast->pipeline.num_scenes, wall / 1e9,
+                   100.0 * rast->pipeline.bin_time / wall,
+                   100.0 * rast->pipeline.rast_time / wall);
+   }
+
    /* Set exit_flag and signal each thread's work_ready semaphore.
     * Each thread will be woken up, notice that the exit_flag is set and
     * break out of its main loop.  The thread will then exit.
@@ -233,6 +233,20 @@ GET_PLANES(const struct lp_rast_triangle *tri)
 struct lp_rasterizer *
 lp_rast_create(unsigned num_threads);
 
+unsigned
+lp_rast_num_domains(unsigned num_threads);
+
+/**
+ * The cache domain rasterizer thread \p thread is pinned to.  Threads are
+ * split into contiguous runs per domain.
+ */
+static inline unsigned
+lp_rast_thread_domain(unsigned thread, unsigned num_threads,
+                      unsigned num_domains)
+{
+   return thread * num_domains / num_threads;
+}
+
 void
 lp_rast_destroy(struct lp_rasterizer *);
 
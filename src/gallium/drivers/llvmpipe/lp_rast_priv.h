@@ -131,6 +131,15 @@ struct lp_rasterizer
    util_barrier barrier;
 
    struct lp_fence *last_fence;
+
+   /** Stage occupancy, only gathered for DEBUG_PIPELINE (nanoseconds) */
+   struct {
+      int64_t bin_start, bin_end, rast_start; /**< of the current scene */
+      int64_t first_time;
+      int64_t bin_time;
+      int64_t rast_time;
+      unsigned num_scenes;
+   } pipeline;
 };
 
 
@@ -30,6 +30,7 @@
 #include "util/u_memory.h"
 #include "util/reallocarray.h"
 #include "util/u_inlines.h"
+#include "util/os_time.h"
 #include "util/format/u_format.h"
 #include "lp_scene.h"
 #include "lp_fence.h"
@@ -103,6 +104,8 @@ lp_scene_destroy(struct lp_scene *scene)
    lp_scene_end_rasterization(scene);
    mtx_destroy(&scene->mutex);
    free(scene->tiles);
+   free(scene->bins);
+   free(scene->bin_cost);
    assert(scene->data.head == &scene->data.first);
    slab_free_st(&scene->setup->scene_slab, scene);
 }
@@ -547,63 +550,6 @@ lp_scene_is_resource_referenced(const struct lp_scene *scene,
 }
 
 
-/** advance curr_x,y to the next bin */
-static bool
-next_bin(struct lp_scene *scene)
-{
-   scene->curr_x++;
-   if (scene->curr_x >= scene->tiles_x) {
-      scene->curr_x = 0;
-      scene->curr_y++;
-   }
-   if (scene->curr_y >= scene->tiles_y) {
-      /* no more bins */
-      return false;
-   }
-   return true;
-}
-
-
-void
-lp_scene_bin_iter_begin(struct lp_scene *scene)
-{
-   scene->curr_x = scene->curr_y = -1;
-}
-
-
-/**
- * Return pointer to next bin to be rendered.
- * The lp_scene::curr_x and ::curr_y fields will be advanced.
- * Multiple rendering threads will call this function to get a chunk
- * of work (a bin) to work on.
- */
-struct cmd_bin *
-lp_scene_bin_iter_next(struct lp_scene *scene , int *x, int *y)
-{
-   struct cmd_bin *bin = NULL;
-
-   mtx_lock(&scene->mutex);
-
-   if (scene->curr_x < 0) {
-      /* first bin */
-      scene->curr_x = 0;
-      scene->curr_y = 0;
-   } else if (!next_bin(scene)) {
-      /* no more bins left */
-      goto end;
-   }
-
-   bin = lp_scene_get_bin(scene, scene->curr_x, scene->curr_y);
-   *x = scene->curr_x;
-   *y = scene->curr_y;
-
-end:
-   /*printf("return bin %p at %d, %d\n", (void *) bin, *bin_x, *bin_y);*/
-   mtx_unlock(&scene->mutex);
-   return bin;
-}
-
-
 void
 lp_scene_begin_binning(struct lp_scene *scene,
                        struct pipe_framebuffer_state *fb)
@@ -621,12 +567,19 @@ lp_scene_begin_binning(struct lp_scene *scene,
    if (scene->num_alloced_tiles < num_required_tiles) {
       scene->tiles = reallocarray(scene->tiles, num_required_tiles,
                                   sizeof(struct cmd_bin));
-      if (!scene->tiles)
+      scene->bins = reallocarray(scene->bins, num_required_tiles,
+                                 sizeof(struct lp_scene_bin_ref));
+      scene->bin_cost = reallocarray(scene->bin_cost, num_required_tiles,
+                                     sizeof(uint8_t));
+      if (!scene->tiles || !scene->bins || !scene->bin_cost)
          return;
       memset(scene->tiles, 0, sizeof(struct cmd_bin) * num_required_tiles);
       scene->num_alloced_tiles = num_required_tiles;
    }
 
+   if (LP_DEBUG & DEBUG_PIPELINE)
+      scene->bin_start_time = os_time_get_nano();
+
    /*
     * Determine how many layers the fb has (used for clamping layer value).
     * OpenGL (but not d3d10) permits different amount of layers per rt,
@@ -662,9 +615,153 @@ lp_scene_begin_binning(struct lp_scene *scene,
 }
 
 
+/* Number of bin cost classes, one per power of two of command count. */
+#define LP_SCENE_BIN_COST_CLASSES 32
+#define LP_SCENE_BIN_EMPTY 0xff
+
+
+/**
+ * Distribute the non-empty bins of tile rows [y0, y1) over the bin queues
+ * [first_queue, first_queue + num_queues), filling scene->bins from
+ * position base.  Returns the number of bins scheduled.
+ *
+ * Bins are bucketed by cost (the log2 of their command count) and dealt
+ * out round-robin from the most expensive class down, so every thread
+ * starts on a heavy bin and works through progressively cheaper ones.
+ * Within a cost class the raster order is preserved.  Empty bins, which
+ * would just load the contents of the tile and store them again
+ * unchanged, are dropped here.
+ */
+static unsigned
+lp_scene_schedule_band(struct lp_scene *scene,
+                       unsigned y0, unsigned y1,
+                       unsigned first_queue, unsigned num_queues,
+                       unsigned base, bool sort)
+{
+   unsigned class_start[LP_SCENE_BIN_COST_CLASSES] = {0};
+   unsigned num_bins = 0;
+
+   for (unsigned y = y0; y < y1; y++) {
+      for (unsigned x = 0; x < scene->tiles_x; x++) {
+         const struct cmd_bin *bin = lp_scene_get_bin(scene, x, y);
+         const unsigned idx = y * scene->tiles_x + x;
+         unsigned count = 0;
+
+         for (const struct cmd_block *block = bin->head; block;
+              block = block->next) {
+            count += block->count;
+         }
+
+         if (count == 0) {
+            scene->bin_cost[idx] = LP_SCENE_BIN_EMPTY;
+            continue;
+         }
+
+         const unsigned cost = sort ? util_logbase2(count) : 0;
+         scene->bin_cost[idx] = cost;
+         class_start[cost]++;
+         num_bins++;
+      }
+   }
+
+   /* Turn the class sizes into start positions, most expensive first. */
+   unsigned pos = 0;
+   for (int c = LP_SCENE_BIN_COST_CLASSES - 1; c >= 0; c--) {
+      const unsigned size = class_start[c];
+      class_start[c] = pos;
+      pos += size;
+   }
+
+   /* Bin number k in cost order goes to queue k % num_queues.  Each queue
+    * is a contiguous range of scene->bins, so place it at position
+    * k / num_queues within that range.
+    */
+   const unsigned per_queue = num_bins / num_queues;
+   const unsigned remainder = num_bins % num_queues;
+
+   for (unsigned y = y0; y < y1; y++) {
+      for (unsigned x = 0; x < scene->tiles_x; x++) {
+         const unsigned cost = scene->bin_cost[y * scene->tiles_x + x];
+         if (cost == LP_SCENE_BIN_EMPTY)
+            continue;
+
+         const unsigned k = class_start[cost]++;
+         const unsigned q = k % num_queues;
+         const unsigned start = base + q * per_queue + MIN2(q, remainder);
+
+         scene->bins[start + k / num_queues].x = x;
+         scene->bins[start + k / num_queues].y = y;
+      }
+   }
+
+   for (unsigned q = 0; q < num_queues; q++) {
+      const unsigned start = base + q * per_queue + MIN2(q, remainder);
+      const unsigned size = per_queue + (q < remainder ? 1 : 0);
+      scene->bin_queues[first_queue + q].range =
+         lp_scene_bin_queue_pack(start, start + size);
+   }
+
+   return num_bins;
+}
+
+
+/**
+ * Distribute the non-empty bins of a scene over one bin queue per
+ * rasterizer thread.
+ *
+ * When the rasterizer threads are spread over several cache domains (see
+ * lp_rast_num_domains()), the framebuffer is cut into horizontal bands of
+ * tiles, one per domain, and a band's bins only go to the queues of the
+ * threads of its domain.  A tile thus keeps being rasterized within the
+ * same domain from one scene to the next, and its color and depth data
+ * stay in that domain's cache.  Whatever imbalance remains is evened out
+ * by stealing at the end of the scene.
+ *
+ * This runs at the end of binning on the thread that built the scene, so
+ * it overlaps with the rasterization of the previous scenes instead of
+ * delaying the start of this one.
+ */
+static void
+lp_scene_schedule_bins(struct lp_scene *scene, unsigned num_queues,
+                       unsigned num_domains)
+{
+   assert(num_queues > 0 && num_queues <= LP_MAX_THREADS);
+   assert(num_domains > 0 && num_domains <= num_queues);
+   scene->num_bin_queues = num_queues;
+
+   /* With a single thread there is nothing to balance, keep the raster
+    * order.
+    */
+   const bool sort = num_queues > 1;
+   unsigned first_queue = 0;
+   unsigned base = 0;
+
+   for (unsigned d = 0; d < num_domains; d++) {
+      const unsigned y0 = d * scene->tiles_y / num_domains;
+      const unsigned y1 = (d + 1) * scene->tiles_y / num_domains;
+      unsigned end_queue = first_queue;
+
+      while (end_queue < num_queues &&
+             lp_rast_thread_domain(end_queue, num_queues, num_domains) == d)
+         end_queue++;
+
+      base += lp_scene_schedule_band(scene, y0, y1,
+                                     first_queue, end_queue - first_queue,
+                                     base, sort);
+      first_queue = end_queue;
+   }
+}
+
+
 void
 lp_scene_end_binning(struct lp_scene *scene)
 {
+   lp_scene_schedule_bins(scene, MAX2(1, scene->setup->num_threads),
+                          scene->setup->num_domains);
+
+   if (LP_DEBUG & DEBUG_PIPELINE)
+      scene->bin_end_time = os_time_get_nano();
+
    if (LP_DEBUG & DEBUG_SCENE) {
       debug_printf("rasterize scene:\n");
       debug_printf("  scene_size: %u\n",
@@ -35,6 +35,7 @@
 #ifndef LP_SCENE_H
 #define LP_SCENE_H
 
+#include "util/u_memory.h"
 #include "util/u_thread.h"
 #include "lp_rast.h"
 #include "lp_debug.h"
@@ -116,6 +117,25 @@ struct data_block_list {
    struct data_block *head;
 };
 
+/**
+ * Position of a bin, as stored in the scene's bin queues.
+ */
+struct lp_scene_bin_ref {
+   uint16_t x, y;
+};
+
+
+/**
+ * A rasterizer thread's queue of bins, as [head, tail) indices into
+ * lp_scene::bins.  The head lives in the low 32 bits and the tail in the
+ * high 32 bits so that both ends can be updated with a single
+ * compare-and-swap: the owner pops from the head, idle threads steal from
+ * the tail.
+ */
+struct lp_scene_bin_queue {
+   EXCLUSIVE_CACHELINE(uint64_t range);
+};
+
 struct resource_ref;
 
 struct shader_ref;
@@ -195,12 +215,23 @@ struct lp_scene {
     */
    unsigned tiles_x, tiles_y;
 
-   int curr_x, curr_y;  /**< for iterating over bins */
    mtx_t mutex;
 
    unsigned num_alloced_tiles;
    struct cmd_bin *tiles;
    struct data_block_list data;
+
+   /** The non-empty bins, scheduled into one queue per rasterizer thread
+    * by lp_scene_schedule_bins() when binning ends.
+    */
+   struct lp_scene_bin_ref *bins;
+   uint8_t *bin_cost;
+   unsigned num_bin_queues;
+   struct lp_scene_bin_queue bin_queues[LP_MAX_THREADS];
+
+   /** Stage timestamps in nanoseconds, only recorded for DEBUG_PIPELINE */
+   int64_t bin_start_time;
+   int64_t bin_end_time;
 };
 
 
@@ -395,11 +426,11 @@ lp_scene_get_num_bins(const struct lp_scene *scene)
 }
 
 
-void
-lp_scene_bin_iter_begin(struct lp_scene *scene);
-
-struct cmd_bin *
-lp_scene_bin_iter_next(struct lp_scene *scene, int *x, int *y);
+static inline uint64_t
+lp_scene_bin_queue_pack(uint32_t head, uint32_t tail)
+{
+   return ((uint64_t)tail << 32) | head;
+}
 
 
 
@@ -38,6 +38,7 @@
 #include "draw/draw_context.h"
 #include "gallivm/lp_bld_type.h"
 #include "gallivm/lp_bld_nir.h"
+#include <llvm-c/TargetMachine.h>
 #include "util/disk_cache.h"
 #include "util/hex.h"
 #include "util/os_misc.h"
@@ -72,6 +73,7 @@ static const struct debug_named_value lp_debug_flags[] = {
    { "screen", DEBUG_SCREEN, NULL },
    { "counters", DEBUG_COUNTERS, NULL },
    { "scene", DEBUG_SCENE, NULL },
+   { "pipeline", DEBUG_PIPELINE, NULL },
    { "fence", DEBUG_FENCE, NULL },
    { "no_fastpath", DEBUG_NO_FASTPATH, NULL },
    { "linear", DEBUG_LINEAR, NULL },
@@ -870,6 +872,9 @@ llvmpipe_destroy_screen(struct pipe_screen *_screen)
    if (screen->cs_tpool)
       lp_cs_tpool_destroy(screen->cs_tpool);
 
+   if (util_queue_is_initialized(&screen->fs_optimize_queue))
+      util_queue_destroy(&screen->fs_optimize_queue);
+
    if (screen->rast)
       lp_rast_destroy(screen->rast);
 
@@ -929,12 +934,30 @@ update_cache_sha1_cpu(struct mesa_sha1 *ctx)
 {
    const struct util_cpu_caps_t *cpu_caps = util_get_cpu_caps();
    /*
-    * Don't need the cpu cache affinity stuff. The rest
-    * is contained in first 5 dwords.
+    * Only hash what affects the generated code: the cpu family, type and
+    * feature flags, which are contained in dwords 1-4.  The cpu counts in
+    * the first dword and the cache affinity stuff don't, and hashing them
+    * would needlessly split the cache between hosts (or containers) that
+    * only differ in the number of cpus they have.
     */
+   STATIC_ASSERT(offsetof(struct util_cpu_caps_t, family)
+                 == sizeof(uint32_t));
    STATIC_ASSERT(offsetof(struct util_cpu_caps_t, num_L3_caches)
                  == 5 * sizeof(uint32_t));
-   _mesa_sha1_update(ctx, cpu_caps, 5 * sizeof(uint32_t));
+   _mesa_sha1_update(ctx, (const uint8_t *)cpu_caps + sizeof(uint32_t),
+                     4 * sizeof(uint32_t));
+
+   /* The vector width can be overridden with LP_NATIVE_VECTOR_WIDTH. */
+   _mesa_sha1_update(ctx, &lp_native_vector_width,
+                     sizeof(lp_native_vector_width));
+
+   /*
+    * The JIT targets the host cpu (-mcpu), which can enable more
+    * instructions than the feature flags above describe.
+    */
+   char *cpu_name = LLVMGetHostCPUName();
+   _mesa_sha1_update(ctx, cpu_name, strlen(cpu_name));
+   LLVMDisposeMessage(cpu_name);
 }
 
 
@@ -1048,6 +1071,13 @@ llvmpipe_screen_late_init(struct llvmpipe_screen *screen)
       goto out;
    }
 
+   if (screen->tiered_compile &&
+       !util_queue_init(&screen->fs_optimize_queue, "lpfsopt", 64, 1,
+                        UTIL_QUEUE_INIT_RESIZE_IF_FULL |
+                        UTIL_QUEUE_INIT_USE_MINIMUM_PRIORITY, screen)) {
+      screen->tiered_compile = false;
+   }
+
    lp_build_init(); /* get lp_native_vector_width initialised */
 
    lp_disk_cache_create(screen);
@@ -1110,6 +1140,10 @@ llvmpipe_create_screen(struct sw_winsys *winsys)
    llvmpipe_init_screen_resource_funcs(&screen->base);
 
    screen->allow_cl = !!getenv("LP_CL");
+#ifndef USE_GLOBAL_LLVM_CONTEXT
+   screen->tiered_compile = debug_get_bool_option("LP_TIERED_COMPILE", false);
+#endif
+   screen->threaded_vs = debug_get_bool_option("LP_THREADED_VS", false);
    screen->num_threads = util_get_cpu_caps()->nr_cpus > 1
       ? util_get_cpu_caps()->nr_cpus : 0;
    screen->num_threads = debug_get_num_option("LP_NUM_THREADS",
@@ -38,6 +38,7 @@
 #include "pipe/p_defines.h"
 #include "util/u_thread.h"
 #include "util/list.h"
+#include "util/u_queue.h"
 #include "gallivm/lp_bld.h"
 #include "gallivm/lp_bld_misc.h"
 
@@ -64,6 +65,13 @@ struct llvmpipe_screen
 
    bool allow_cl;
 
+   /** Background queue building the optimized tier of shader variants */
+   bool tiered_compile;
+   struct util_queue fs_optimize_queue;
+
+   /** Split the draw module's vertex shading over the rasterizer threads */
+   bool threaded_vs;
+
    mtx_t late_mutex;
    bool late_init_done;
 
@@ -70,7 +70,13 @@ lp_setup_wait_empty_scene(struct lp_setup_context *setup)
 {
    /* just use the first scene if we run out */
    if (setup->scenes[0]->fence) {
+      const int64_t start = (LP_DEBUG & DEBUG_PIPELINE) ? os_time_get_nano() : 0;
+
       lp_fence_wait(setup->scenes[0]->fence);
+
+      if (LP_DEBUG & DEBUG_PIPELINE)
+         setup->scene_wait_time += os_time_get_nano() - start;
+
       lp_scene_end_rasterization(setup->scenes[0]);
    }
    return 0;
@@ -1313,6 +1319,8 @@ lp_setup_destroy(struct lp_setup_context *setup)
    }
 
    LP_DBG(DEBUG_SETUP, "number of scenes used: %d\n", setup->num_active_scenes);
+   LP_DBG(DEBUG_PIPELINE, "llvmpipe: setup waited %.3f ms for free scenes\n",
+          setup->scene_wait_time / 1e6);
    slab_destroy(&setup->scene_slab);
 
    FREE(setup);
@@ -1341,6 +1349,7 @@ lp_setup_create(struct pipe_context *pipe,
    setup->pipe = pipe;
 
    setup->num_threads = screen->num_threads;
+   setup->num_domains = lp_rast_num_domains(screen->num_threads);
    setup->vbuf = draw_vbuf_stage(draw, &setup->base);
    if (!setup->vbuf) {
       goto no_vbuf;
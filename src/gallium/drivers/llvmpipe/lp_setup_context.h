@@ -89,11 +89,13 @@ struct lp_setup_context
     */
    struct draw_stage *vbuf;
    unsigned num_threads;
+   unsigned num_domains;   /**< see lp_rast_num_domains() */
    unsigned scene_idx;
 
    struct slab_mempool scene_slab;
    int num_active_scenes;
    struct lp_scene *scenes[MAX_SCENES];  /**< all the scenes */
+   int64_t scene_wait_time;  /**< time blocked on busy scenes, for DEBUG_PIPELINE */
    struct lp_scene *scene;               /**< current scene being built */
 
    struct llvmpipe_query *active_queries[LP_MAX_ACTIVE_BINNED_QUERIES];
@@ -161,6 +161,13 @@ llvmpipe_init_draw_funcs(struct llvmpipe_context *llvmpipe);
 void
 llvmpipe_init_compute_funcs(struct llvmpipe_context *llvmpipe);
 
+void
+llvmpipe_cs_finish_pending(struct llvmpipe_context *llvmpipe);
+
+void
+llvmpipe_cs_finish_pending_resource(struct llvmpipe_context *llvmpipe,
+                                    const struct pipe_resource *resource);
+
 void
 llvmpipe_init_clip_funcs(struct llvmpipe_context *llvmpipe);
 
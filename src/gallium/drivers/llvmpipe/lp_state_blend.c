@@ -124,6 +124,16 @@ llvmpipe_create_depth_stencil_state(struct pipe_context *pipe,
       state->alpha_enabled = 0;
    }
 
+   /* A depth test that always passes and never writes has no effect.
+    * Dropping it keeps depth work out of the fragment shader and lets
+    * 2D workloads that leave it enabled use the linear path.
+    */
+   if (state->depth_enabled &&
+       state->depth_func == PIPE_FUNC_ALWAYS &&
+       !state->depth_writemask) {
+      state->depth_enabled = 0;
+   }
+
    return state;
 }
 
@@ -851,6 +851,66 @@ generate_compute(struct llvmpipe_context *lp,
 }
 
 
+/**
+ * Whether the shader can access memory other than through the resources
+ * bound to the context's compute slots: bindless textures and images,
+ * global addresses, or UBOs and SSBOs looked up in a descriptor set, as
+ * lavapipe does.  Grids of such shaders can't be checked against a given
+ * resource.
+ */
+static bool
+lp_cs_nir_has_untracked_access(struct nir_shader *nir)
+{
+   nir_foreach_function_impl(impl, nir) {
+      nir_foreach_block(block, impl) {
+         nir_foreach_instr(instr, block) {
+            if (instr->type == nir_instr_type_tex) {
+               nir_tex_instr *tex = nir_instr_as_tex(instr);
+               if (nir_tex_instr_src_index(tex, nir_tex_src_texture_handle) >= 0 ||
+                   nir_tex_instr_src_index(tex, nir_tex_src_sampler_handle) >= 0)
+                  return true;
+               continue;
+            }
+
+            if (instr->type != nir_instr_type_intrinsic)
+               continue;
+
+            nir_intrinsic_instr *intr = nir_instr_as_intrinsic(instr);
+            switch (intr->intrinsic) {
+            case nir_intrinsic_bindless_image_load:
+            case nir_intrinsic_bindless_image_store:
+            case nir_intrinsic_bindless_image_atomic:
+            case nir_intrinsic_bindless_image_atomic_swap:
+            case nir_intrinsic_bindless_image_size:
+            case nir_intrinsic_bindless_image_samples:
+            case nir_intrinsic_load_global:
+            case nir_intrinsic_load_global_constant:
+            case nir_intrinsic_store_global:
+            case nir_intrinsic_global_atomic:
+            case nir_intrinsic_global_atomic_swap:
+               return true;
+            case nir_intrinsic_load_ubo:
+            case nir_intrinsic_load_ssbo:
+            case nir_intrinsic_get_ssbo_size:
+            case nir_intrinsic_ssbo_atomic:
+            case nir_intrinsic_ssbo_atomic_swap:
+               if (nir_src_num_components(intr->src[0]) > 1)
+                  return true;
+               break;
+            case nir_intrinsic_store_ssbo:
+               if (nir_src_num_components(intr->src[1]) > 1)
+                  return true;
+               break;
+            default:
+               break;
+            }
+         }
+      }
+   }
+   return false;
+}
+
+
 static void *
 llvmpipe_create_compute_state(struct pipe_context *pipe,
                               const struct pipe_compute_state *templ)
@@ -884,8 +944,10 @@ llvmpipe_create_compute_state(struct pipe_context *pipe,
 
       /* we need to keep a local copy of the tokens */
       shader->base.tokens = tgsi_dup_tokens(templ->prog);
+      shader->untracked_access = true;
    } else {
       nir_tgsi_scan_shader(shader->base.ir.nir, &shader->info.base, false);
+      shader->untracked_access = lp_cs_nir_has_untracked_access(shader->base.ir.nir);
    }
 
    llvmpipe_register_shader(pipe, &shader->base, false);
@@ -937,6 +999,8 @@ static void
 llvmpipe_remove_cs_shader_variant(struct llvmpipe_context *lp,
                                   struct lp_compute_shader_variant *variant)
 {
+   llvmpipe_cs_finish_pending(lp);
+
    if ((LP_DEBUG & DEBUG_CS) || (gallivm_debug & GALLIVM_DEBUG_IR)) {
       debug_printf("llvmpipe: del cs #%u var %u v created %u v cached %u "
                    "v total cached %u inst %u total inst %u\n",
@@ -1841,6 +1905,132 @@ fill_grid_size(struct pipe_context *pipe,
 }
 
 
+/* Bound on the number of grids in flight per context. */
+#define LP_CS_MAX_PENDING 32
+
+/**
+ * A compute grid running on the thread pool that launch_grid didn't wait
+ * for.  It carries its own copy of the exec state, as the next launch
+ * updates the context's one, and holds references to the resources bound
+ * when it was launched.
+ *
+ * Grids without a barrier in between can thus overlap, keeping the pool
+ * busy across a burst of small dispatches.  Everything that may observe
+ * or change the results (flushes, and so barriers, draws, clears, variant
+ * deletion) first waits for the pending grids of the context with
+ * llvmpipe_cs_finish_pending().  Resource flushes for mapping or copying
+ * only wait if a pending grid references the resource, or if its shader
+ * has untracked_access.
+ */
+struct lp_cs_pending {
+   struct list_head list;
+   struct lp_cs_tpool_task *task;
+   struct lp_cs_job_info job_info;
+   struct lp_cs_exec exec;
+   bool untracked_access;
+   unsigned num_resources;
+   struct pipe_resource *resources[LP_MAX_TGSI_CONST_BUFFERS +
+                                   LP_MAX_TGSI_SHADER_BUFFERS +
+                                   LP_MAX_TGSI_SHADER_IMAGES +
+                                   PIPE_MAX_SHADER_SAMPLER_VIEWS];
+};
+
+
+static void
+lp_cs_pending_add_resource(struct lp_cs_pending *pending,
+                           struct pipe_resource *resource)
+{
+   if (resource) {
+      assert(pending->num_resources < ARRAY_SIZE(pending->resources));
+      pipe_resource_reference(&pending->resources[pending->num_resources++],
+                              resource);
+   }
+}
+
+
+static struct lp_cs_pending *
+lp_cs_pending_create(struct lp_cs_context *csctx,
+                     const struct lp_compute_shader *shader,
+                     const struct lp_cs_job_info *job_info)
+{
+   struct lp_cs_pending *pending = MALLOC_STRUCT(lp_cs_pending);
+   if (!pending)
+      return NULL;
+
+   pending->task = NULL;
+   pending->job_info = *job_info;
+   pending->exec = *job_info->current;
+   pending->job_info.current = &pending->exec;
+   pending->untracked_access = shader->untracked_access;
+   pending->num_resources = 0;
+   memset(pending->resources, 0, sizeof(pending->resources));
+
+   for (unsigned i = 0; i < ARRAY_SIZE(csctx->constants); i++)
+      lp_cs_pending_add_resource(pending, csctx->constants[i].current.buffer);
+   for (unsigned i = 0; i < ARRAY_SIZE(csctx->ssbos); i++)
+      lp_cs_pending_add_resource(pending, csctx->ssbos[i].current.buffer);
+   for (unsigned i = 0; i < ARRAY_SIZE(csctx->images); i++)
+      lp_cs_pending_add_resource(pending, csctx->images[i].current.resource);
+   for (unsigned i = 0; i < csctx->cs.current_tex_num; i++)
+      lp_cs_pending_add_resource(pending, csctx->cs.current_tex[i]);
+
+   return pending;
+}
+
+
+static void
+lp_cs_pending_retire(struct llvmpipe_context *llvmpipe,
+                     struct lp_cs_pending *pending)
+{
+   struct llvmpipe_screen *screen = llvmpipe_screen(llvmpipe->pipe.screen);
+
+   lp_cs_tpool_wait_for_task(screen->cs_tpool, &pending->task);
+
+   for (unsigned i = 0; i < pending->num_resources; i++)
+      pipe_resource_reference(&pending->resources[i], NULL);
+
+   list_del(&pending->list);
+   llvmpipe->num_cs_pending--;
+   FREE(pending);
+}
+
+
+/**
+ * Wait for all the compute grids of the context still in flight.
+ */
+void
+llvmpipe_cs_finish_pending(struct llvmpipe_context *llvmpipe)
+{
+   list_for_each_entry_safe(struct lp_cs_pending, pending,
+                            &llvmpipe->cs_pending, list) {
+      lp_cs_pending_retire(llvmpipe, pending);
+   }
+}
+
+
+/**
+ * Wait for the compute grids of the context still in flight if any of them
+ * may access the given resource.
+ */
+void
+llvmpipe_cs_finish_pending_resource(struct llvmpipe_context *llvmpipe,
+                                    const struct pipe_resource *resource)
+{
+   list_for_each_entry(struct lp_cs_pending, pending,
+                       &llvmpipe->cs_pending, list) {
+      bool referenced = pending->untracked_access;
+
+      for (unsigned i = 0; !referenced && i < pending->num_resources; i++)
+         referenced = pending->resources[i] == resource;
+
+      if (referenced) {
+         llvmpipe_cs_finish_pending(llvmpipe);
+         return;
+      }
+   }
+}
+
+
 static void
 llvmpipe_launch_grid(struct pipe_context *pipe,
                      const struct pipe_grid_info *info)
@@ -1871,12 +2061,31 @@ llvmpipe_launch_grid(struct pipe_context *pipe,
 
    int num_tasks = job_info.grid_size[2] * job_info.grid_size[1] * job_info.grid_size[0];
    if (num_tasks) {
-      struct lp_cs_tpool_task *task;
-      mtx_lock(&screen->cs_mutex);
-      task = lp_cs_tpool_queue_task(screen->cs_tpool, cs_exec_fn, &job_info, num_tasks);
-      mtx_unlock(&screen->cs_mutex);
+      /* Kernel inputs are only valid for the duration of the call. */
+      struct lp_cs_pending *pending = NULL;
+      if (!info->input && screen->cs_tpool->num_threads)
+         pending = lp_cs_pending_create(llvmpipe->csctx, llvmpipe->cs, &job_info);
+
+      if (pending) {
+         mtx_lock(&screen->cs_mutex);
+         pending->task = lp_cs_tpool_queue_task(screen->cs_tpool, cs_exec_fn,
+                                                &pending->job_info, num_tasks);
+         mtx_unlock(&screen->cs_mutex);
+
+         list_addtail(&pending->list, &llvmpipe->cs_pending);
+         if (++llvmpipe->num_cs_pending > LP_CS_MAX_PENDING) {
+            lp_cs_pending_retire(llvmpipe,
+                                 list_first_entry(&llvmpipe->cs_pending,
+                                                  struct lp_cs_pending, list));
+         }
+      } else {
+         struct lp_cs_tpool_task *task;
+         mtx_lock(&screen->cs_mutex);
+         task = lp_cs_tpool_queue_task(screen->cs_tpool, cs_exec_fn, &job_info, num_tasks);
+         mtx_unlock(&screen->cs_mutex);
 
-      lp_cs_tpool_wait_for_task(screen->cs_tpool, &task);
+         lp_cs_tpool_wait_for_task(screen->cs_tpool, &task);
+      }
    }
    if (!llvmpipe->queries_disabled)
       llvmpipe->pipeline_statistics.cs_invocations += num_tasks * info->block[0] * info->block[1] * info->block[2];
@@ -2207,6 +2416,8 @@ llvmpipe_draw_mesh_tasks(struct pipe_context *pipe,
    if (!llvmpipe_check_render_cond(lp))
       return;
 
+   llvmpipe_cs_finish_pending(lp);
+
    memset(&job_info, 0, sizeof(job_info));
    if (lp->dirty)
       llvmpipe_update_derived(lp);
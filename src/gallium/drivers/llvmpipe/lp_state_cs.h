@@ -123,6 +123,8 @@ struct lp_compute_shader {
    unsigned variants_created;
    unsigned variants_cached;
    bool zero_initialize_shared_memory;
+   /* Accesses memory not bound to the compute slots, see lp_cs_pending */
+   bool untracked_access;
 
    int max_global_buffers;
    struct pipe_resource **global_buffers;
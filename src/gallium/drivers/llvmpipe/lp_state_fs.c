@@ -68,6 +68,7 @@
 #include "util/u_dual_blend.h"
 #include "util/u_upload_mgr.h"
 #include "util/os_time.h"
+#include "util/u_atomic.h"
 #include "pipe/p_shader_tokens.h"
 #include "draw/draw_context.h"
 #include "tgsi/tgsi_dump.h"
@@ -633,6 +634,7 @@ fs_fb_fetch(const struct lp_build_fs_iface *iface,
 static void
 generate_fs_loop(struct gallivm_state *gallivm,
                  struct lp_fragment_shader *shader,
+                 nir_shader *nir,
                  const struct lp_fragment_shader_variant_key *key,
                  LLVMBuilderRef builder,
                  struct lp_type type,
@@ -1072,7 +1074,7 @@ generate_fs_loop(struct gallivm_state *gallivm,
       lp_build_tgsi_soa(gallivm, tokens, &params,
                         outputs);
    else
-      lp_build_nir_soa(gallivm, shader->base.ir.nir, &params,
+      lp_build_nir_soa(gallivm, nir, &params,
                        outputs);
 
    /* Alpha test */
@@ -3097,8 +3099,8 @@ generate_unswizzled_blend(struct gallivm_state *gallivm,
  * 2x2 pixels.
  */
 static void
-generate_fragment(struct llvmpipe_context *lp,
-                  struct lp_fragment_shader *shader,
+generate_fragment(struct lp_fragment_shader *shader,
+                  nir_shader *nir,
                   struct lp_fragment_shader_variant *variant,
                   unsigned partial_mask)
 {
@@ -3413,7 +3415,7 @@ generate_fragment(struct llvmpipe_context *lp,
       }
 
       generate_fs_loop(gallivm,
-                       shader, key,
+                       shader, nir, key,
                        builder,
                        fs_type,
                        variant->jit_context_type,
@@ -3728,6 +3730,161 @@ lp_fs_get_ir_cache_key(struct lp_fragment_shader_variant *variant,
 }
 
 
+struct lp_fs_optimize_job {
+   struct llvmpipe_context *lp;
+   struct lp_fragment_shader_variant *variant;
+   nir_shader *nir;
+   bool needs_caching;
+   unsigned char ir_sha1_cache_key[20];
+};
+
+
+/**
+ * Rebuild the LLVM functions of a variant with the full optimization
+ * pipeline, in a private LLVM context, and swap them in for the baseline
+ * ones.  Runs on the screen's fs_optimize_queue.
+ *
+ * Until the job's fence is signalled it owns the variant's LLVM state
+ * (gallivm, types and functions); the context thread only ever reads the
+ * jit function pointers, which are replaced atomically.
+ */
+static void
+lp_fs_variant_optimize(void *data, void *gdata, int thread_index)
+{
+   struct lp_fs_optimize_job *job = data;
+   struct llvmpipe_screen *screen = gdata;
+   struct lp_fragment_shader_variant *variant = job->variant;
+   struct lp_fragment_shader *shader = variant->shader;
+   struct lp_cached_code cached = { 0 };
+
+   LLVMContextRef context = LLVMContextCreate();
+   if (!context)
+      return;
+
+#if LLVM_VERSION_MAJOR == 15
+   LLVMContextSetOpaquePointers(context, false);
+#endif
+
+   char module_name[64];
+   snprintf(module_name, sizeof(module_name), "fs%u_variant%u_opt",
+            shader->no, variant->no);
+   struct gallivm_state *gallivm = gallivm_create(module_name, context,
+                                                  &cached);
+   if (!gallivm) {
+      LLVMContextDispose(context);
+      return;
+   }
+
+   variant->baseline_gallivm = variant->gallivm;
+   variant->gallivm = gallivm;
+   variant->jit_context_ptr_type = NULL;
+   lp_jit_init_types(variant);
+
+   const bool edge_test = variant->function[RAST_EDGE_TEST] != NULL;
+   const bool whole = variant->function[RAST_WHOLE] != NULL;
+   const bool linear = variant->linear_function != NULL;
+
+   variant->function[RAST_EDGE_TEST] = NULL;
+   variant->function[RAST_WHOLE] = NULL;
+   variant->linear_function = NULL;
+
+   if (edge_test)
+      generate_fragment(shader, job->nir, variant, RAST_EDGE_TEST);
+   if (whole)
+      generate_fragment(shader, job->nir, variant, RAST_WHOLE);
+   if (linear)
+      llvmpipe_fs_variant_linear_llvm(job->lp, shader, job->nir, variant);
+
+   gallivm_compile_module(gallivm);
+
+   if (edge_test) {
+      lp_jit_frag_func baseline = variant->jit_function[RAST_EDGE_TEST];
+      lp_jit_frag_func func = (lp_jit_frag_func)
+         gallivm_jit_function(gallivm, variant->function[RAST_EDGE_TEST]);
+
+      p_atomic_set(&variant->jit_function[RAST_EDGE_TEST], func);
+      if (!whole && variant->jit_function[RAST_WHOLE] == baseline)
+         p_atomic_set(&variant->jit_function[RAST_WHOLE], func);
+   }
+
+   if (whole) {
+      p_atomic_set(&variant->jit_function[RAST_WHOLE], (lp_jit_frag_func)
+                   gallivm_jit_function(gallivm,
+                                        variant->function[RAST_WHOLE]));
+   }
+
+   if (linear) {
+      p_atomic_set(&variant->jit_linear_llvm, (lp_jit_linear_llvm_func)
+                   gallivm_jit_function(gallivm, variant->linear_function));
+   }
+
+   if (job->needs_caching) {
+      lp_disk_cache_insert_shader(screen, &cached, job->ir_sha1_cache_key);
+   }
+
+   gallivm_free_ir(gallivm);
+   LLVMContextDispose(context);
+}
+
+
+static void
+lp_fs_variant_optimize_cleanup(void *data, void *gdata, int thread_index)
+{
+   struct lp_fs_optimize_job *job = data;
+
+   ralloc_free(job->nir);
+   FREE(job);
+}
+
+
+/**
+ * Queue the build of the optimized tier of a variant whose baseline has
+ * just been compiled.
+ */
+static void
+lp_fs_variant_queue_optimize(struct llvmpipe_context *lp,
+                             struct lp_fragment_shader_variant *variant,
+                             const unsigned char *ir_sha1_cache_key)
+{
+   struct llvmpipe_screen *screen = llvmpipe_screen(lp->pipe.screen);
+
+   /* Nothing to do for variants entirely covered by the C fastpaths. */
+   if (!variant->function[RAST_EDGE_TEST] &&
+       !variant->function[RAST_WHOLE] &&
+       !variant->linear_function)
+      return;
+
+   struct lp_fs_optimize_job *job = CALLOC_STRUCT(lp_fs_optimize_job);
+   if (!job)
+      return;
+
+   job->lp = lp;
+   job->variant = variant;
+
+   /* Building the IR runs NIR passes on the shader, so the job gets its
+    * own copy.
+    */
+   if (variant->shader->base.ir.nir) {
+      job->nir = nir_shader_clone(NULL, variant->shader->base.ir.nir);
+      if (!job->nir) {
+         FREE(job);
+         return;
+      }
+   }
+
+   if (ir_sha1_cache_key) {
+      job->needs_caching = true;
+      memcpy(job->ir_sha1_cache_key, ir_sha1_cache_key,
+             sizeof(job->ir_sha1_cache_key));
+   }
+
+   util_queue_add_job(&screen->fs_optimize_queue, job,
+                      &variant->optimize_fence,
+                      lp_fs_variant_optimize,
+                      lp_fs_variant_optimize_cleanup, 0);
+}
+
+
 /**
  * Generate a new fragment shader variant from the shader code and
  * other state indicated by the key.
@@ -3745,6 +3902,7 @@ generate_variant(struct llvmpipe_context *lp,
    memset(variant, 0, sizeof(*variant));
 
    pipe_reference_init(&variant->reference, 1);
+   util_queue_fence_init(&variant->optimize_fence);
    lp_fs_reference(lp, &variant->shader, shader);
 
    memcpy(&variant->key, key, shader->variant_key_size);
@@ -3761,10 +3919,19 @@ generate_variant(struct llvmpipe_context *lp,
          needs_caching = true;
    }
 
+   /* With tiered compilation a cache miss gets a quick unoptimized build
+    * now, and the optimized one later from the background queue.
+    */
+   const bool tiered = screen->tiered_compile && !cached.data_size;
+
    char module_name[64];
    snprintf(module_name, sizeof(module_name), "fs%u_variant%u",
             shader->no, shader->variants_created);
-   variant->gallivm = gallivm_create(module_name, lp->context, &cached);
+   if (tiered)
+      variant->gallivm = gallivm_create_no_opt(module_name, lp->context,
+                                               &cached);
+   else
+      variant->gallivm = gallivm_create(module_name, lp->context, &cached);
    if (!variant->gallivm) {
       FREE(variant);
       return NULL;
@@ -3862,15 +4029,21 @@ generate_variant(struct llvmpipe_context *lp,
    /* Determine whether this shader + pipeline state is a candidate for
     * the linear path.
     */
-   const bool linear_pipeline =
-         !key->stencil[0].enabled &&
-         !key->depth.enabled &&
-         !shader->info.base.uses_kill &&
-         !key->blend.logicop_enable &&
-         (key->cbuf_format[0] == PIPE_FORMAT_B8G8R8A8_UNORM ||
-          key->cbuf_format[0] == PIPE_FORMAT_B8G8R8X8_UNORM ||
-          key->cbuf_format[0] == PIPE_FORMAT_R8G8B8A8_UNORM ||
-          key->cbuf_format[0] == PIPE_FORMAT_R8G8B8X8_UNORM);
+   const char *linear_reason = NULL;
+   if (key->stencil[0].enabled)
+      linear_reason = "stencil test";
+   else if (key->depth.enabled)
+      linear_reason = "depth test";
+   else if (shader->info.base.uses_kill)
+      linear_reason = "shader uses kill";
+   else if (key->blend.logicop_enable)
+      linear_reason = "logic op";
+   else if (key->cbuf_format[0] != PIPE_FORMAT_B8G8R8A8_UNORM &&
+            key->cbuf_format[0] != PIPE_FORMAT_B8G8R8X8_UNORM &&
+            key->cbuf_format[0] != PIPE_FORMAT_R8G8B8A8_UNORM &&
+            key->cbuf_format[0] != PIPE_FORMAT_R8G8B8X8_UNORM)
+      linear_reason = "color buffer format";
+   const bool linear_pipeline = !linear_reason;
 
    memcpy(&variant->key, key, sizeof *key);
 
@@ -3883,12 +4056,12 @@ generate_variant(struct llvmpipe_context *lp,
    lp_jit_init_types(variant);
 
    if (variant->jit_function[RAST_EDGE_TEST] == NULL)
-      generate_fragment(lp, shader, variant, RAST_EDGE_TEST);
+      generate_fragment(shader, shader->base.ir.nir, variant, RAST_EDGE_TEST);
 
    if (variant->jit_function[RAST_WHOLE] == NULL) {
       if (variant->opaque) {
          /* Specialized shader, which doesn't need to read the color buffer. */
-         generate_fragment(lp, shader, variant, RAST_WHOLE);
+         generate_fragment(shader, shader->base.ir.nir, variant, RAST_WHOLE);
       }
    }
 
@@ -3912,13 +4085,15 @@ generate_variant(struct llvmpipe_context *lp,
          if (shader->kind == LP_FS_KIND_BLIT_RGBA ||
              shader->kind == LP_FS_KIND_BLIT_RGB1 ||
              shader->kind == LP_FS_KIND_LLVM_LINEAR) {
-            llvmpipe_fs_variant_linear_llvm(lp, shader, variant);
+            llvmpipe_fs_variant_linear_llvm(lp, shader, shader->base.ir.nir,
+                                            variant);
          }
       }
    } else {
       if (LP_DEBUG & DEBUG_LINEAR) {
          lp_debug_fs_variant(variant);
-         debug_printf("    ----> no linear path for this variant\n");
+         debug_printf("    ----> no linear path for this variant: %s\n",
+                      linear_reason);
       }
    }
 
@@ -3958,12 +4133,18 @@ generate_variant(struct llvmpipe_context *lp,
       lp_linear_check_variant(variant);
    }
 
-   if (needs_caching) {
+   /* Only the optimized tier goes to the disk cache. */
+   if (needs_caching && !tiered) {
       lp_disk_cache_insert_shader(screen, &cached, ir_sha1_cache_key);
    }
 
    gallivm_free_ir(variant->gallivm);
 
+   if (tiered) {
+      lp_fs_variant_queue_optimize(lp, variant,
+                                   needs_caching ? ir_sha1_cache_key : NULL);
+   }
+
    return variant;
 }
 
@@ -4134,6 +4315,16 @@ void
 llvmpipe_destroy_shader_variant(struct llvmpipe_context *lp,
                                 struct lp_fragment_shader_variant *variant)
 {
+   struct llvmpipe_screen *screen = llvmpipe_screen(lp->pipe.screen);
+
+   /* Cancel the optimized build if it hasn't started, else wait for it. */
+   if (!util_queue_fence_is_signalled(&variant->optimize_fence))
+      util_queue_drop_job(&screen->fs_optimize_queue,
+                          &variant->optimize_fence);
+   util_queue_fence_destroy(&variant->optimize_fence);
+
+   if (variant->baseline_gallivm)
+      gallivm_destroy(variant->baseline_gallivm);
    gallivm_destroy(variant->gallivm);
    lp_fs_reference(lp, &variant->shader, NULL);
    FREE(variant);
@@ -38,6 +38,7 @@
 #include "gallivm/lp_bld_tgsi.h" /* for lp_tgsi_info */
 #include "lp_bld_interp.h" /* for struct lp_shader_input */
 #include "util/u_inlines.h"
+#include "util/u_queue.h"
 #include "lp_jit.h"
 
 struct tgsi_token;
@@ -186,6 +187,13 @@ struct lp_fragment_shader_variant
    /* Total number of LLVM instructions generated */
    unsigned nr_instrs;
 
+   /* With tiered compilation, the code built first is unoptimized and the
+    * optimized functions replace it from a background job.  The baseline
+    * code is kept around as scenes may still be running it.
+    */
+   struct util_queue_fence optimize_fence;
+   struct gallivm_state *baseline_gallivm;
+
    struct lp_fs_variant_list_item list_item_global, list_item_local;
    struct lp_fragment_shader *shader;
 
@@ -239,6 +247,7 @@ llvmpipe_fs_variant_linear_fastpath(struct lp_fragment_shader_variant *variant);
 void
 llvmpipe_fs_variant_linear_llvm(struct llvmpipe_context *lp,
                                 struct lp_fragment_shader *shader,
+                                struct nir_shader *nir,
                                 struct lp_fragment_shader_variant *variant);
 
 void
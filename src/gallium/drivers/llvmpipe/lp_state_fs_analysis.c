@@ -530,18 +530,27 @@ llvmpipe_nir_is_linear_compat(struct nir_shader *shader,
 void
 llvmpipe_fs_analyse_nir(struct lp_fragment_shader *shader)
 {
-   if (shader->info.base.num_inputs <= LP_MAX_LINEAR_INPUTS &&
-       shader->info.base.num_outputs == 1 &&
-       shader->info.base.output_semantic_name[0] == TGSI_SEMANTIC_COLOR &&
-       shader->info.base.output_semantic_index[0] == 0 &&
-       !shader->info.indirect_textures &&
-       !shader->info.sampler_texture_units_different &&
-       shader->info.num_texs <= LP_MAX_LINEAR_TEXTURES &&
-       llvmpipe_nir_is_linear_compat(shader->base.ir.nir, &shader->info)) {
-      shader->kind = LP_FS_KIND_LLVM_LINEAR;
-   } else {
-      shader->kind = LP_FS_KIND_GENERAL;
-   }
+   const char *reason = NULL;
+
+   if (shader->info.base.num_inputs > LP_MAX_LINEAR_INPUTS)
+      reason = "too many inputs";
+   else if (shader->info.base.num_outputs != 1 ||
+            shader->info.base.output_semantic_name[0] != TGSI_SEMANTIC_COLOR ||
+            shader->info.base.output_semantic_index[0] != 0)
+      reason = "outputs other than a single color0";
+   else if (shader->info.indirect_textures)
+      reason = "indirect texture access";
+   else if (shader->info.sampler_texture_units_different)
+      reason = "sampler and texture units differ";
+   else if (shader->info.num_texs > LP_MAX_LINEAR_TEXTURES)
+      reason = "too many texture samples";
+   else if (!llvmpipe_nir_is_linear_compat(shader->base.ir.nir, &shader->info))
+      reason = "instructions not handled by the linear path";
+
+   shader->kind = reason ? LP_FS_KIND_GENERAL : LP_FS_KIND_LLVM_LINEAR;
+
+   if (reason && (LP_DEBUG & DEBUG_LINEAR))
+      debug_printf("llvmpipe: fs %u not linear: %s\n", shader->no, reason);
 }
 
 
@@ -127,6 +127,7 @@ emit_fetch_texel_linear(const struct lp_build_sampler_aos *base,
 static LLVMValueRef
 llvm_fragment_body(struct lp_build_context *bld,
                    struct lp_fragment_shader *shader,
+                   nir_shader *nir,
                    struct lp_fragment_shader_variant *variant,
                    struct linear_sampler* sampler,
                    LLVMValueRef *inputs_ptrs,
@@ -172,7 +173,7 @@ llvm_fragment_body(struct lp_build_context *bld,
                         &sampler->base,
                         &shader->info.base);
    } else {
-      nir_shader *clone = nir_shader_clone(NULL, shader->base.ir.nir);
+      nir_shader *clone = nir_shader_clone(NULL, nir);
       lp_build_nir_aos(gallivm, clone, fs_type,
                        rgba_order ? rgba_swizzles : bgra_swizzles,
                        consts_ptr, inputs, outputs,
@@ -245,6 +246,7 @@ llvm_fragment_body(struct lp_build_context *bld,
 void
 llvmpipe_fs_variant_linear_llvm(struct llvmpipe_context *lp,
                                 struct lp_fragment_shader *shader,
+                                nir_shader *nir,
                                 struct lp_fragment_shader_variant *variant)
 {
    assert(shader->kind == LP_FS_KIND_BLIT_RGBA ||
@@ -270,8 +272,8 @@ llvmpipe_fs_variant_linear_llvm(struct llvmpipe_context *lp,
       if (shader->base.tokens) {
          tgsi_dump(shader->base.tokens, 0);
       }
-      if (shader->base.ir.nir) {
-         nir_print_shader(shader->base.ir.nir, stderr);
+      if (nir) {
+         nir_print_shader(nir, stderr);
       }
    }
 
@@ -473,7 +475,7 @@ llvmpipe_fs_variant_linear_llvm(struct llvmpipe_context *lp,
                                               loop.counter, 4);
 
       /* Perform fragment shader body */
-      value = llvm_fragment_body(&bld, shader, variant, &sampler, inputs_ptrs,
+      value = llvm_fragment_body(&bld, shader, nir, variant, &sampler, inputs_ptrs,
                                  consts_ptr, blend_color, alpha_ref, fs_type,
                                  value);
 
@@ -519,7 +521,7 @@ llvmpipe_fs_variant_linear_llvm(struct llvmpipe_context *lp,
       buf = LLVMBuildLoad2(gallivm->builder, pixelt, buf_ptr, "");
       buf = LLVMBuildBitCast(builder, buf, bld.vec_type, "");
 
-      result = llvm_fragment_body(&bld, shader, variant, &sampler,
+      result = llvm_fragment_body(&bld, shader, nir, variant, &sampler,
                                   inputs_ptrs, consts_ptr, blend_color,
                                   alpha_ref, fs_type, buf);
       result = LLVMBuildBitCast(builder, result, pixelt, "");
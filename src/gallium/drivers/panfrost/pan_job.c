@@ -581,10 +581,70 @@ panfrost_batch_to_fb_info(const struct panfrost_batch *batch,
    }
 }
 
+/* Gather the GEM handles of all BOs accessed by the batch. The list is the
+ * same for the vertex/tiler and the fragment job chains, so it is built once
+ * per batch and shared by both submits.
+ */
+static uint32_t *
+panfrost_batch_get_bo_handles(struct panfrost_batch *batch,
+                              unsigned *out_count)
+{
+   struct panfrost_device *dev = pan_device(batch->ctx->base.screen);
+   unsigned count = 0;
+
+   uint32_t *bo_handles = calloc(panfrost_pool_num_bos(&batch->pool) +
+                                    panfrost_pool_num_bos(&batch->invisible_pool) +
+                                    batch->num_bos + 2,
+                                 sizeof(*bo_handles));
+   assert(bo_handles);
+
+   pan_bo_access *flags = util_dynarray_begin(&batch->bos);
+   unsigned end_bo = util_dynarray_num_elements(&batch->bos, pan_bo_access);
+
+   for (int i = 0; i < end_bo; ++i) {
+      if (!flags[i])
+         continue;
+
+      assert(count < batch->num_bos);
+      bo_handles[count++] = i;
+
+      /* Update the BO access flags so that panfrost_bo_wait() knows
+       * about all pending accesses.
+       * We only keep the READ/WRITE info since this is all the BO
+       * wait logic cares about.
+       * We also preserve existing flags as this batch might not
+       * be the first one to access the BO.
+       */
+      struct panfrost_bo *bo = pan_lookup_bo(dev, i);
+
+      bo->gpu_access |= flags[i] & (PAN_BO_ACCESS_RW);
+   }
+
+   panfrost_pool_get_bo_handles(&batch->pool, bo_handles + count);
+   count += panfrost_pool_num_bos(&batch->pool);
+   panfrost_pool_get_bo_handles(&batch->invisible_pool, bo_handles + count);
+   count += panfrost_pool_num_bos(&batch->invisible_pool);
+
+   /* Add the tiler heap to the list of accessed BOs if the batch has at
+    * least one tiler job. Tiler heap is written by tiler jobs and read
+    * by fragment jobs (the polygon list is coming from this heap).
+    */
+   if (batch->scoreboard.first_tiler)
+      bo_handles[count++] = dev->tiler_heap->gem_handle;
+
+   /* Always used on Bifrost, occassionally used on Midgard */
+   bo_handles[count++] = dev->sample_positions->gem_handle;
+
+   *out_count = count;
+   return bo_handles;
+}
+
 static int
 panfrost_batch_submit_ioctl(struct panfrost_batch *batch,
                             mali_ptr first_job_desc, uint32_t reqs,
-                            uint32_t in_sync, uint32_t out_sync)
+                            uint32_t in_sync, uint32_t out_sync,
+                            const uint32_t *bo_handles,
+                            unsigned bo_handle_count)
 {
    struct panfrost_context *ctx = batch->ctx;
    struct pipe_context *gallium = (struct pipe_context *)ctx;
@@ -593,7 +653,6 @@ panfrost_batch_submit_ioctl(struct panfrost_batch *batch,
       0,
    };
    uint32_t in_syncs[2];
-   uint32_t *bo_handles;
    int ret;
 
    /* If we trace, we always need a syncobj, so make one of our own if we
@@ -624,57 +683,12 @@ panfrost_batch_submit_ioctl(struct panfrost_batch *batch,
    if (submit.in_sync_count)
       submit.in_syncs = (uintptr_t)in_syncs;
 
-   bo_handles = calloc(panfrost_pool_num_bos(&batch->pool) +
-                          panfrost_pool_num_bos(&batch->invisible_pool) +
-                          batch->num_bos + 2,
-                       sizeof(*bo_handles));
-   assert(bo_handles);
-
-   pan_bo_access *flags = util_dynarray_begin(&batch->bos);
-   unsigned end_bo = util_dynarray_num_elements(&batch->bos, pan_bo_access);
-
-   for (int i = 0; i < end_bo; ++i) {
-      if (!flags[i])
-         continue;
-
-      assert(submit.bo_handle_count < batch->num_bos);
-      bo_handles[submit.bo_handle_count++] = i;
-
-      /* Update the BO access flags so that panfrost_bo_wait() knows
-       * about all pending accesses.
-       * We only keep the READ/WRITE info since this is all the BO
-       * wait logic cares about.
-       * We also preserve existing flags as this batch might not
-       * be the first one to access the BO.
-       */
-      struct panfrost_bo *bo = pan_lookup_bo(dev, i);
-
-      bo->gpu_access |= flags[i] & (PAN_BO_ACCESS_RW);
-   }
-
-   panfrost_pool_get_bo_handles(&batch->pool,
-                                bo_handles + submit.bo_handle_count);
-   submit.bo_handle_count += panfrost_pool_num_bos(&batch->pool);
-   panfrost_pool_get_bo_handles(&batch->invisible_pool,
-                                bo_handles + submit.bo_handle_count);
-   submit.bo_handle_count += panfrost_pool_num_bos(&batch->invisible_pool);
-
-   /* Add the tiler heap to the list of accessed BOs if the batch has at
-    * least one tiler job. Tiler heap is written by tiler jobs and read
-    * by fragment jobs (the polygon list is coming from this heap).
-    */
-   if (batch->scoreboard.first_tiler)
-      bo_handles[submit.bo_handle_count++] = dev->tiler_heap->gem_handle;
-
-   /* Always used on Bifrost, occassionally used on Midgard */
-   bo_handles[submit.bo_handle_count++] = dev->sample_positions->gem_handle;
-
    submit.bo_handles = (u64)(uintptr_t)bo_handles;
+   submit.bo_handle_count = bo_handle_count;
    if (ctx->is_noop)
       ret = 0;
    else
       ret = drmIoctl(dev->fd, DRM_IOCTL_PANFROST_SUBMIT, &submit);
-   free(bo_handles);
 
    if (ret)
       return errno;
@@ -719,8 +733,18 @@ panfrost_batch_submit_jobs(struct panfrost_batch *batch,
    bool has_draws = batch->scoreboard.first_job;
    bool has_tiler = batch->scoreboard.first_tiler;
    bool has_frag = panfrost_has_fragment_job(batch);
+   mali_ptr fragjob = 0;
    int ret = 0;
 
+   /* Emit the fragment job up front, since it may allocate from the batch
+    * pool and every BO has to be in the shared handle list.
+    */
+   if (has_frag)
+      fragjob = screen->vtbl.emit_fragment_job(batch, fb);
+
+   unsigned bo_handle_count;
+   uint32_t *bo_handles = panfrost_batch_get_bo_handles(batch, &bo_handle_count);
+
    /* Take the submit lock to make sure no tiler jobs from other context
     * are inserted between our tiler and fragment jobs, failing to do that
     * might result in tiler heap corruption.
@@ -730,16 +754,16 @@ panfrost_batch_submit_jobs(struct panfrost_batch *batch,
 
    if (has_draws) {
       ret = panfrost_batch_submit_ioctl(batch, batch->scoreboard.first_job, 0,
-                                        in_sync, has_frag ? 0 : out_sync);
+                                        in_sync, has_frag ? 0 : out_sync,
+                                        bo_handles, bo_handle_count);
 
       if (ret)
          goto done;
    }
 
    if (has_frag) {
-      mali_ptr fragjob = screen->vtbl.emit_fragment_job(batch, fb);
       ret = panfrost_batch_submit_ioctl(batch, fragjob, PANFROST_JD_REQ_FS, 0,
-                                        out_sync);
+                                        out_sync, bo_handles, bo_handle_count);
       if (ret)
          goto done;
    }
@@ -748,6 +772,8 @@ done:
    if (has_tiler)
       pthread_mutex_unlock(&dev->submit_lock);
 
+   free(bo_handles);
+
    return ret;
 }
 
@@ -28,6 +28,7 @@
 
 #include "sfn_debug.h"
 
+#include <bitset>
 #include <cassert>
 #include <queue>
 
@@ -90,6 +91,23 @@ operator<(const Group& lhs, const Group& rhs)
 
 using GroupRegisters = std::priority_queue<Group>;
 
+using ColorSet = std::bitset<124>;
+
+/* Collect the colors already assigned to the neighbours of a register,
+ * so that a free color can be picked with one pass over the adjacency
+ * list instead of one pass per color tried. */
+static void
+mark_used_colors(const LiveRangeMap::ChannelLiveRange& ranges,
+                 const ComponentInterference::Row& adjacency,
+                 ColorSet& used)
+{
+   for (auto adj : adjacency) {
+      int color = ranges[adj].m_color;
+      if (color >= 0 && (size_t)color < used.size())
+         used.set(color);
+   }
+}
+
 static bool
 group_allocation(LiveRangeMap& lrm,
                  const Interference& interference,
@@ -113,75 +131,30 @@ group_allocation(LiveRangeMap& lrm,
       if (group.priority > 0)
          color = 0;
 
-      while (color < 124) {
-         /* Find the coloring for the first channel */
-         bool color_in_use = false;
-         int comp = start_comp;
-
-         auto& adjecency = interference.row(start_comp, group.channels[comp]->index());
-         auto& regs = lrm.component(comp);
+      ColorSet used;
+      for (int comp = start_comp; comp < 4; ++comp) {
+         if (group.channels[comp])
+            mark_used_colors(lrm.component(comp),
+                             interference.row(comp, group.channels[comp]->index()),
+                             used);
+      }
 
-         sfn_log << SfnLog::merge << "Try color " << color;
+      while (color < 124 && used.test(color))
+         ++color;
 
-         for (auto adj : adjecency) {
-            if (regs[adj].m_color == color) {
-               color_in_use = true;
-               sfn_log << SfnLog::merge << " in use\n";
-               break;
-            }
-         }
+      if (color == 124)
+         return false;
 
-         if (color_in_use) {
-            ++color;
-            continue;
-         }
+      sfn_log << SfnLog::merge << "Use color " << color << "\n";
 
-         /* First channel color found, check whether it can be used for all
-          * channels */
-         while (comp < 4) {
-            sfn_log << SfnLog::merge << " interference: ";
-            if (group.channels[comp]) {
-               auto& component_life_ranges = lrm.component(comp);
-               auto& adjecencies = interference.row(comp, group.channels[comp]->index());
-
-               for (auto adj_index : adjecencies) {
-                  sfn_log << SfnLog::merge << *component_life_ranges[adj_index].m_register
-                          << " ";
-                  if (component_life_ranges[adj_index].m_color == color) {
-                     color_in_use = true;
-                     sfn_log << SfnLog::merge << "used";
-                     break;
-                  }
-               }
-
-               if (color_in_use)
-                  break;
-            }
-            ++comp;
+      for (auto reg : group.channels) {
+         if (reg) {
+            auto& vregs = lrm.component(reg->chan());
+            auto& vreg_cmp = vregs[reg->index()];
+            assert(vreg_cmp.m_start != -1 || vreg_cmp.m_end != -1);
+            vreg_cmp.m_color = color;
          }
-
-         /* We couldn't allocate all channels with this color, so try next */
-         if (color_in_use) {
-            ++color;
-            sfn_log << SfnLog::merge << "\n";
-            continue;
-         }
-         sfn_log << SfnLog::merge << " success\n";
-
-         /* Coloring successful */
-         for (auto reg : group.channels) {
-            if (reg) {
-               auto& vregs = lrm.component(reg->chan());
-               auto& vreg_cmp = vregs[reg->index()];
-               assert(vreg_cmp.m_start != -1 || vreg_cmp.m_end != -1);
-               vreg_cmp.m_color = color;
-            }
-         }
-         break;
       }
-
-      if (color == 124)
-         return false;
    }
 
    return true;
@@ -201,29 +174,17 @@ scalar_allocation(LiveRangeMap& lrm, const Interference& interference)
 
          sfn_log << SfnLog::merge << "Color " << *r.m_register << "\n";
 
-         auto& adjecency = interference.row(comp, r.m_register->index());
+         ColorSet used;
+         mark_used_colors(live_ranges, interference.row(comp, r.m_register->index()), used);
 
          int color = 0;
+         while (color < 124 && used.test(color))
+            ++color;
 
-         while (color < 124) {
-            bool color_in_use = false;
-            for (auto adj : adjecency) {
-               if (live_ranges[adj].m_color == color) {
-                  color_in_use = true;
-                  break;
-               }
-            }
-
-            if (color_in_use) {
-               ++color;
-               continue;
-            }
-
-            r.m_color = color;
-            break;
-         }
          if (color == 124)
             return false;
+
+         r.m_color = color;
       }
    }
    return true;
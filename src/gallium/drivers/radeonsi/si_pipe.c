@@ -1081,6 +1081,15 @@ static void si_test_gds_memory_management(struct si_context *sctx, unsigned allo
    exit(0);
 }
 
+/* The disk cache is how compiled shaders are shared between processes: a
+ * process that finds a main part there skips compilation and only uploads
+ * the binary.  The uploaded code itself stays per-process: each process has
+ * its own GPU VM, and binaries get relocated against per-context scratch
+ * addresses at upload time (see si_shader_binary_upload), so a shared code
+ * BO couldn't be mapped at a common address or with common contents.  For
+ * many processes running the same application, MESA_DISK_CACHE_DATABASE
+ * gives a single-file cache that is safe for concurrent readers and writers.
+ */
 static void si_disk_cache_create(struct si_screen *sscreen)
 {
    /* Don't use the cache if shader dumping is enabled. */
@@ -1270,6 +1270,7 @@ struct si_context {
    unsigned num_prim_restart_calls;
    unsigned num_compute_calls;
    unsigned num_cp_dma_calls;
+   unsigned num_shader_compile_stalls;
    unsigned num_vs_flushes;
    unsigned num_ps_flushes;
    unsigned num_cs_flushes;
@@ -124,6 +124,9 @@ static bool si_query_sw_begin(struct si_context *sctx, struct si_query *squery)
    case SI_QUERY_CP_DMA_CALLS:
       query->begin_result = sctx->num_cp_dma_calls;
       break;
+   case SI_QUERY_SHADER_COMPILE_STALLS:
+      query->begin_result = sctx->num_shader_compile_stalls;
+      break;
    case SI_QUERY_NUM_VS_FLUSHES:
       query->begin_result = sctx->num_vs_flushes;
       break;
@@ -283,6 +286,9 @@ static bool si_query_sw_end(struct si_context *sctx, struct si_query *squery)
    case SI_QUERY_CP_DMA_CALLS:
       query->end_result = sctx->num_cp_dma_calls;
       break;
+   case SI_QUERY_SHADER_COMPILE_STALLS:
+      query->end_result = sctx->num_shader_compile_stalls;
+      break;
    case SI_QUERY_NUM_VS_FLUSHES:
       query->end_result = sctx->num_vs_flushes;
       break;
@@ -1722,6 +1728,7 @@ static struct pipe_driver_query_info si_driver_query_list[] = {
    X("prim-restart-calls", PRIM_RESTART_CALLS, UINT64, AVERAGE),
    X("compute-calls", COMPUTE_CALLS, UINT64, AVERAGE),
    X("cp-dma-calls", CP_DMA_CALLS, UINT64, AVERAGE),
+   X("shader-compile-stalls", SHADER_COMPILE_STALLS, UINT64, AVERAGE),
    X("num-vs-flushes", NUM_VS_FLUSHES, UINT64, AVERAGE),
    X("num-ps-flushes", NUM_PS_FLUSHES, UINT64, AVERAGE),
    X("num-cs-flushes", NUM_CS_FLUSHES, UINT64, AVERAGE),
@@ -31,6 +31,7 @@ enum
    SI_QUERY_PRIM_RESTART_CALLS,
    SI_QUERY_COMPUTE_CALLS,
    SI_QUERY_CP_DMA_CALLS,
+   SI_QUERY_SHADER_COMPILE_STALLS,
    SI_QUERY_NUM_VS_FLUSHES,
    SI_QUERY_NUM_PS_FLUSHES,
    SI_QUERY_NUM_CS_FLUSHES,
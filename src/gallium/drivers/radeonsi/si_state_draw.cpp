@@ -1908,11 +1908,13 @@ static void si_emit_draw_packets(struct si_context *sctx, const struct pipe_draw
             }
          } else {
             if (index_bias_varies) {
-               /* Only BaseVertex varies. */
+               /* Only BaseVertex varies. Multi-draws often have runs of draws with the
+                * same bias, so only re-emit it when it changes.
+                */
                for (unsigned i = 0; i < num_draws; i++) {
                   uint64_t va = index_va + draws[i].start * index_size;
 
-                  if (i > 0)
+                  if (i > 0 && draws[i].index_bias != draws[i - 1].index_bias)
                      radeon_set_sh_reg(sh_base_reg + SI_SGPR_BASE_VERTEX * 4, draws[i].index_bias);
 
                   radeon_emit(PKT3(PKT3_DRAW_INDEX_2, 4, render_cond_bit));
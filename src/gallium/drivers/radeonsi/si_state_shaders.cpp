@@ -2593,6 +2593,17 @@ use_local_key_copy(const SHADER_KEY_TYPE *key, SHADER_KEY_TYPE *local_key, unsig
    return local_key;
 }
 
+/* Wait for a shader (or selector main part) to finish compiling, and count
+ * it as a compile stall for the HUD if it wasn't ready yet.
+ */
+static void si_wait_shader_fence(struct si_context *sctx, struct util_queue_fence *fence)
+{
+   if (!util_queue_fence_is_signalled(fence)) {
+      sctx->num_shader_compile_stalls++;
+      util_queue_fence_wait(fence);
+   }
+}
+
 #define NO_INLINE_UNIFORMS false
 
 /**
@@ -2652,7 +2663,7 @@ again:
             goto current_not_ready;
          }
 
-         util_queue_fence_wait(&current->ready);
+         si_wait_shader_fence(sctx, &current->ready);
       }
 
       return current->compilation_failed ? -1 : 0;
@@ -2663,7 +2674,7 @@ current_not_ready:
     * compilation calls this function too, and therefore must enter
     * the mutex first.
     */
-   util_queue_fence_wait(&sel->ready);
+   si_wait_shader_fence(sctx, &sel->ready);
 
    simple_mtx_lock(&sel->mutex);
 
@@ -2709,7 +2720,7 @@ current_not_ready:
                goto again;
             }
 
-            util_queue_fence_wait(&iter->ready);
+            si_wait_shader_fence(sctx, &iter->ready);
          }
 
          if (iter->compilation_failed) {
@@ -2751,7 +2762,7 @@ current_not_ready:
 
       /* We need to wait for the previous shader. */
       if (previous_stage_sel)
-         util_queue_fence_wait(&previous_stage_sel->ready);
+         si_wait_shader_fence(sctx, &previous_stage_sel->ready);
    }
 
    bool is_pure_monolithic =
@@ -2860,6 +2871,8 @@ current_not_ready:
    simple_mtx_unlock(&sel->mutex);
 
    assert(!shader->is_optimized);
+   /* There is no variant to fall back to, so the draw waits for this. */
+   sctx->num_shader_compile_stalls++;
    si_build_shader_variant(shader, -1, false);
 
    util_queue_fence_signal(&shader->ready);
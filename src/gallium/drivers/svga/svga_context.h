@@ -64,6 +64,7 @@ enum svga_hud {
    SVGA_QUERY_NUM_RESOURCE_UPDATES,
    SVGA_QUERY_NUM_BUFFER_UPLOADS,
    SVGA_QUERY_NUM_CONST_BUF_UPDATES,
+   SVGA_QUERY_NUM_CONST_BUF_SKIPPED,
    SVGA_QUERY_NUM_CONST_UPDATES,
    SVGA_QUERY_NUM_SHADER_RELOCATIONS,
    SVGA_QUERY_NUM_SURFACE_RELOCATIONS,
@@ -281,6 +282,7 @@ struct svga_velems_state {
 
 struct svga_constant_buffer {
    struct svga_winsys_surface *handle;
+   unsigned offset;
    unsigned size;
 };
 
@@ -714,6 +716,7 @@ struct svga_context
       uint64_t num_resource_updates;    /**< SVGA_QUERY_NUM_RESOURCE_UPDATES */
       uint64_t num_buffer_uploads;      /**< SVGA_QUERY_NUM_BUFFER_UPLOADS */
       uint64_t num_const_buf_updates;   /**< SVGA_QUERY_NUM_CONST_BUF_UPDATES */
+      uint64_t num_const_buf_skipped;   /**< SVGA_QUERY_NUM_CONST_BUF_SKIPPED */
       uint64_t num_const_updates;       /**< SVGA_QUERY_NUM_CONST_UPDATES */
       uint64_t num_shaders;             /**< SVGA_QUERY_NUM_SHADERS */
 
@@ -732,6 +732,7 @@ svga_create_query(struct pipe_context *pipe,
    case SVGA_QUERY_NUM_RESOURCE_UPDATES:
    case SVGA_QUERY_NUM_BUFFER_UPLOADS:
    case SVGA_QUERY_NUM_CONST_BUF_UPDATES:
+   case SVGA_QUERY_NUM_CONST_BUF_SKIPPED:
    case SVGA_QUERY_NUM_CONST_UPDATES:
    case SVGA_QUERY_NUM_FAILED_ALLOCATIONS:
    case SVGA_QUERY_NUM_COMMANDS_PER_DRAW:
@@ -819,6 +820,7 @@ svga_destroy_query(struct pipe_context *pipe, struct pipe_query *q)
    case SVGA_QUERY_NUM_RESOURCE_UPDATES:
    case SVGA_QUERY_NUM_BUFFER_UPLOADS:
    case SVGA_QUERY_NUM_CONST_BUF_UPDATES:
+   case SVGA_QUERY_NUM_CONST_BUF_SKIPPED:
    case SVGA_QUERY_NUM_CONST_UPDATES:
    case SVGA_QUERY_NUM_FAILED_ALLOCATIONS:
    case SVGA_QUERY_NUM_COMMANDS_PER_DRAW:
@@ -928,6 +930,9 @@ svga_begin_query(struct pipe_context *pipe, struct pipe_query *q)
    case SVGA_QUERY_NUM_CONST_BUF_UPDATES:
       sq->begin_count = svga->hud.num_const_buf_updates;
       break;
+   case SVGA_QUERY_NUM_CONST_BUF_SKIPPED:
+      sq->begin_count = svga->hud.num_const_buf_skipped;
+      break;
    case SVGA_QUERY_NUM_CONST_UPDATES:
       sq->begin_count = svga->hud.num_const_updates;
       break;
@@ -1052,6 +1057,9 @@ svga_end_query(struct pipe_context *pipe, struct pipe_query *q)
    case SVGA_QUERY_NUM_CONST_BUF_UPDATES:
       sq->end_count = svga->hud.num_const_buf_updates;
       break;
+   case SVGA_QUERY_NUM_CONST_BUF_SKIPPED:
+      sq->end_count = svga->hud.num_const_buf_skipped;
+      break;
    case SVGA_QUERY_NUM_CONST_UPDATES:
       sq->end_count = svga->hud.num_const_updates;
       break;
@@ -1178,6 +1186,7 @@ svga_get_query_result(struct pipe_context *pipe,
    case SVGA_QUERY_NUM_RESOURCE_UPDATES:
    case SVGA_QUERY_NUM_BUFFER_UPLOADS:
    case SVGA_QUERY_NUM_CONST_BUF_UPDATES:
+   case SVGA_QUERY_NUM_CONST_BUF_SKIPPED:
    case SVGA_QUERY_NUM_CONST_UPDATES:
    case SVGA_QUERY_NUM_SHADER_RELOCATIONS:
    case SVGA_QUERY_NUM_SURFACE_RELOCATIONS:
@@ -945,6 +945,8 @@ svga_get_driver_query_info(struct pipe_screen *screen,
             PIPE_DRIVER_QUERY_TYPE_UINT64),
       QUERY("num-const-buf-updates", SVGA_QUERY_NUM_CONST_BUF_UPDATES,
             PIPE_DRIVER_QUERY_TYPE_UINT64),
+      QUERY("num-const-buf-skipped", SVGA_QUERY_NUM_CONST_BUF_SKIPPED,
+            PIPE_DRIVER_QUERY_TYPE_UINT64),
       QUERY("num-const-updates", SVGA_QUERY_NUM_CONST_UPDATES,
             PIPE_DRIVER_QUERY_TYPE_UINT64),
       QUERY("num-shader-relocations", SVGA_QUERY_NUM_SHADER_RELOCATIONS,
@@ -845,8 +845,18 @@ emit_constbuf(struct svga_context *svga,
    const struct svga_screen *screen = svga_screen(svga->pipe.screen);
    const struct svga_winsys_screen *sws = screen->sws;
 
+   /* Nothing to do if the slot is already bound to the same range of the
+    * same surface.  The surface is still referenced by
+    * svga_validate_constant_buffers() at draw time.
+    */
+   if (dst_handle &&
+       svga->state.hw_draw.constbufoffsets[shader][slot].handle == dst_handle &&
+       svga->state.hw_draw.constbufoffsets[shader][slot].offset == offset &&
+       svga->state.hw_draw.constbufoffsets[shader][slot].size == new_buf_size) {
+      svga->hud.num_const_buf_skipped++;
+   }
    /* Issue the SetSingleConstantBuffer command */
-   if (!sws->have_constant_buffer_offset_cmd ||
+   else if (!sws->have_constant_buffer_offset_cmd ||
        svga->state.hw_draw.constbufoffsets[shader][slot].handle != dst_handle ||
        svga->state.hw_draw.constbufoffsets[shader][slot].size != new_buf_size) {
       ret = SVGA3D_vgpu10_SetSingleConstantBuffer(svga->swc,
@@ -883,6 +893,7 @@ emit_constbuf(struct svga_context *svga,
     */
    pipe_resource_reference(&svga->state.hw_draw.constbuf[shader][slot], dst_buffer);
    svga->state.hw_draw.constbufoffsets[shader][slot].handle = dst_handle;
+   svga->state.hw_draw.constbufoffsets[shader][slot].offset = offset;
    svga->state.hw_draw.constbufoffsets[shader][slot].size = new_buf_size;
 
    pipe_resource_reference(&dst_buffer, NULL);
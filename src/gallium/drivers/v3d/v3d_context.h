@@ -600,6 +600,10 @@ struct v3d_context {
 
         uint32_t tf_prims_generated;
         uint32_t prims_generated;
+        /* Number of BCL/RCL jobs submitted to the kernel, for the
+         * V3D_QUERY_JOBS_SUBMITTED driver query.
+         */
+        uint32_t jobs_submitted;
         bool prim_restart;
 
         uint32_t n_primitives_generated_queries_in_flight;
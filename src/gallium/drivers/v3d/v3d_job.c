@@ -567,6 +567,7 @@ v3d_job_submit(struct v3d_context *v3d, struct v3d_job *job)
                                         "Expect corruption.\n", strerror(errno));
                         warned = true;
                 } else if (!ret) {
+                        v3d->jobs_submitted++;
                         if (v3d->active_perfmon)
                                 v3d->active_perfmon->job_submitted = true;
                 }
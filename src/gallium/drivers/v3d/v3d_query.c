@@ -37,8 +37,26 @@ v3d_get_driver_query_info(struct pipe_screen *pscreen, unsigned index,
                           struct pipe_driver_query_info *info)
 {
         struct v3d_screen *screen = v3d_screen(pscreen);
+        unsigned num_perfcnt = v3d_get_driver_query_info_perfcnt(screen, 0, NULL);
 
-        return v3d_get_driver_query_info_perfcnt(screen, index, info);
+        if (!info)
+                return num_perfcnt + 1;
+
+        if (index < num_perfcnt)
+                return v3d_get_driver_query_info_perfcnt(screen, index, info);
+
+        if (index > num_perfcnt)
+                return 0;
+
+        info->group_id = ~(unsigned)0;
+        info->name = "jobs-submitted";
+        info->query_type = V3D_QUERY_JOBS_SUBMITTED;
+        info->result_type = PIPE_DRIVER_QUERY_RESULT_TYPE_AVERAGE;
+        info->type = PIPE_DRIVER_QUERY_TYPE_UINT64;
+        info->flags = 0;
+        info->max_value.u64 = 0;
+
+        return 1;
 }
 
 static struct pipe_query *
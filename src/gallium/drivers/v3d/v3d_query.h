@@ -28,6 +28,11 @@
 
 struct v3d_query;
 
+/* Software driver query, placed after the range used by the perfmon
+ * counters.
+ */
+#define V3D_QUERY_JOBS_SUBMITTED (PIPE_QUERY_DRIVER_SPECIFIC + 1024)
+
 struct v3d_query_funcs {
         void (*destroy_query)(struct v3d_context *v3d, struct v3d_query *query);
         bool (*begin_query)(struct v3d_context *v3d, struct v3d_query *query);
@@ -39,7 +39,7 @@ struct v3d_query_pipe
 {
         struct v3d_query base;
 
-        enum pipe_query_type type;
+        unsigned type;
         struct v3d_bo *bo;
 
         uint32_t start, end;
@@ -91,6 +91,9 @@ v3d_begin_query_pipe(struct v3d_context *v3d, struct v3d_query *query)
                 v3d->current_oq = pquery->bo;
                 v3d->dirty |= V3D_DIRTY_OQ;
                 break;
+        case V3D_QUERY_JOBS_SUBMITTED:
+                pquery->start = v3d->jobs_submitted;
+                break;
         default:
                 unreachable("unsupported query type");
         }
@@ -129,6 +132,9 @@ v3d_end_query_pipe(struct v3d_context *v3d, struct v3d_query *query)
                 v3d->current_oq = NULL;
                 v3d->dirty |= V3D_DIRTY_OQ;
                 break;
+        case V3D_QUERY_JOBS_SUBMITTED:
+                pquery->end = v3d->jobs_submitted;
+                break;
         default:
                 unreachable("unsupported query type");
         }
@@ -170,6 +176,7 @@ v3d_get_query_result_pipe(struct v3d_context *v3d, struct v3d_query *query,
                 break;
         case PIPE_QUERY_PRIMITIVES_GENERATED:
         case PIPE_QUERY_PRIMITIVES_EMITTED:
+        case V3D_QUERY_JOBS_SUBMITTED:
                 vresult->u64 = pquery->end - pquery->start;
                 break;
         default:
@@ -189,7 +196,8 @@ static const struct v3d_query_funcs pipe_query_funcs = {
 struct pipe_query *
 v3d_create_query_pipe(struct v3d_context *v3d, unsigned query_type, unsigned index)
 {
-        if (query_type >= PIPE_QUERY_DRIVER_SPECIFIC)
+        if (query_type >= PIPE_QUERY_DRIVER_SPECIFIC &&
+            query_type != V3D_QUERY_JOBS_SUBMITTED)
                 return NULL;
 
         struct v3d_query_pipe *pquery = calloc(1, sizeof(*pquery));
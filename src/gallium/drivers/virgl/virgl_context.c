@@ -1037,6 +1037,7 @@ void virgl_flush_eq(struct virgl_context *ctx, void *closure,
    virgl_transfer_queue_clear(&ctx->queue, ctx->cbuf);
 
    virgl_submit_cmd(rs->vws, ctx->cbuf, fence);
+   ctx->last_copy_transfer.cdw = 0;
 
    /* Reserve some space for transfers. */
    if (ctx->encoded_transfers)
@@ -101,6 +101,20 @@ struct virgl_context {
 
    /* The total size of staging resources used in queued copy transfers. */
    uint64_t queued_staging_res_size;
+
+   /* The last buffer copy transfer encoded into cbuf.  A following
+    * copy transfer that continues both its source and destination ranges
+    * is merged into it by growing the box in place.
+    */
+   struct {
+      const struct virgl_hw_res *dst_hw_res;
+      const struct virgl_hw_res *src_hw_res;
+      unsigned dst_end;
+      unsigned src_end;
+      unsigned usage;
+      /* cbuf->cdw right after the command, or 0 when there is none */
+      unsigned cdw;
+   } last_copy_transfer;
 };
 
 static inline struct virgl_sampler_view *
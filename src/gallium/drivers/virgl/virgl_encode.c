@@ -1507,6 +1507,35 @@ void virgl_encode_transfer(struct virgl_screen *vs, struct virgl_cmd_buf *buf,
    virgl_encoder_write_dword(buf, direction);
 }
 
+static bool
+virgl_encoder_try_merge_copy_transfer(struct virgl_context *ctx,
+                                      struct virgl_transfer *trans)
+{
+   /* Nothing may have been encoded since the last copy transfer, and it
+    * must not have been flushed.
+    */
+   if (!ctx->last_copy_transfer.cdw ||
+       ctx->last_copy_transfer.cdw != ctx->cbuf->cdw ||
+       ctx->last_copy_transfer.dst_hw_res != trans->hw_res ||
+       ctx->last_copy_transfer.src_hw_res != trans->copy_src_hw_res ||
+       ctx->last_copy_transfer.dst_end != (unsigned)trans->base.box.x ||
+       ctx->last_copy_transfer.src_end != trans->copy_src_offset ||
+       ctx->last_copy_transfer.usage != trans->base.usage)
+      return false;
+
+   uint32_t *cmd = &ctx->cbuf->buf[ctx->cbuf->cdw - (VIRGL_COPY_TRANSFER3D_SIZE + 1)];
+   const unsigned width = trans->base.box.width;
+
+   cmd[VIRGL_RESOURCE_IW_STRIDE] += width;
+   cmd[VIRGL_RESOURCE_IW_LAYER_STRIDE] += width;
+   cmd[VIRGL_RESOURCE_IW_W] += width;
+
+   ctx->last_copy_transfer.dst_end += width;
+   ctx->last_copy_transfer.src_end += width;
+
+   return true;
+}
+
 void virgl_encode_copy_transfer(struct virgl_context *ctx,
                                 struct virgl_transfer *trans)
 {
@@ -1526,6 +1555,18 @@ void virgl_encode_copy_transfer(struct virgl_context *ctx,
       }
    }
    assert(trans->copy_src_hw_res);
+
+   /* Buffer uploads with stride == width (the staged map covers exactly
+    * the box) can be merged with the copy transfer right before them when
+    * both the destination and the staging ranges are contiguous.
+    */
+   const bool mergeable =
+      trans->base.resource->target == PIPE_BUFFER &&
+      trans->direction == VIRGL_TRANSFER_TO_HOST &&
+      trans->base.stride == trans->base.box.width;
+   if (mergeable && virgl_encoder_try_merge_copy_transfer(ctx, trans))
+      return;
+
    command = VIRGL_CMD0(VIRGL_CCMD_COPY_TRANSFER3D, 0, VIRGL_COPY_TRANSFER3D_SIZE);
    
    virgl_encoder_write_cmd_dword(ctx, command);
@@ -1536,6 +1577,17 @@ void virgl_encode_copy_transfer(struct virgl_context *ctx,
    vs->vws->emit_res(vs->vws, ctx->cbuf, trans->copy_src_hw_res, true);
    virgl_encoder_write_dword(ctx->cbuf, trans->copy_src_offset);
    virgl_encoder_write_dword(ctx->cbuf, direction_and_synchronized);
+
+   if (mergeable) {
+      ctx->last_copy_transfer.dst_hw_res = trans->hw_res;
+      ctx->last_copy_transfer.src_hw_res = trans->copy_src_hw_res;
+      ctx->last_copy_transfer.dst_end = trans->base.box.x + trans->base.box.width;
+      ctx->last_copy_transfer.src_end = trans->copy_src_offset + trans->base.box.width;
+      ctx->last_copy_transfer.usage = trans->base.usage;
+      ctx->last_copy_transfer.cdw = ctx->cbuf->cdw;
+   } else {
+      ctx->last_copy_transfer.cdw = 0;
+   }
 }
 
 void virgl_encode_end_transfers(struct virgl_cmd_buf *buf)
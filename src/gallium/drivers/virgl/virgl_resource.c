@@ -373,10 +373,24 @@ virgl_staging_map(struct virgl_context *vctx,
    align_offset = vres->b.target == PIPE_BUFFER ?
                   vtransfer->base.box.x % VIRGL_MAP_BUFFER_ALIGNMENT :
                   0;
+   unsigned alignment = VIRGL_MAP_BUFFER_ALIGNMENT;
+
+   /* When the unused part of the staging buffer already starts at the
+    * right offset relative to an alignment boundary, which is what a series
+    * of contiguous buffer uploads leaves behind, allocate right there.  This
+    * keeps the staging ranges contiguous so that the copy transfers can be
+    * merged by virgl_encode_copy_transfer.
+    */
+   if (align_offset && vctx->staging.hw_res &&
+       vctx->staging.offset % VIRGL_MAP_BUFFER_ALIGNMENT == align_offset &&
+       vctx->staging.offset + size <= vctx->staging.size) {
+      align_offset = 0;
+      alignment = 1;
+   }
 
    alloc_succeeded =
       virgl_staging_alloc(&vctx->staging, size + align_offset,
-                          VIRGL_MAP_BUFFER_ALIGNMENT,
+                          alignment,
                           &vtransfer->copy_src_offset,
                           &vtransfer->copy_src_hw_res,
                           &map_addr);
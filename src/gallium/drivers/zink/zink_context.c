@@ -5496,6 +5496,7 @@ zink_update_barriers(struct zink_context *ctx, bool is_compute,
    ctx->barrier_set_idx[is_compute] = !ctx->barrier_set_idx[is_compute];
    ctx->need_barriers[is_compute] = &ctx->update_barriers[is_compute][ctx->barrier_set_idx[is_compute]];
    ASSERTED bool check_rp = ctx->batch.in_rp && ctx->dynamic_fb.tc_info.zsbuf_invalidate;
+   zink_buffer_barrier_batch_begin(ctx);
    set_foreach(need_barriers, he) {
       struct zink_resource *res = (struct zink_resource *)he->key;
       if (res->bind_count[is_compute]) {
@@ -5527,6 +5528,7 @@ zink_update_barriers(struct zink_context *ctx, bool is_compute,
       if (!need_barriers->entries)
          break;
    }
+   zink_screen(ctx->base.screen)->buffer_barrier_batch_end(ctx);
 }
 
 /**
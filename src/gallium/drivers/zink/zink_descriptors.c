@@ -1136,6 +1136,48 @@ update_separable(struct zink_context *ctx, struct zink_program *pg)
    }
 }
 
+static struct zink_db_buffer_cache_entry *
+get_db_buffer_cache_entry(struct zink_context *ctx, size_t offset)
+{
+   const size_t ubos = offsetof(struct zink_context, di.db.ubos);
+   const size_t ssbos = offsetof(struct zink_context, di.db.ssbos);
+
+   if (!ctx->dd.db.buffer_cache)
+      return NULL;
+   if (offset >= ubos && offset < ubos + sizeof(ctx->di.db.ubos))
+      return &ctx->dd.db.buffer_cache[(offset - ubos) / sizeof(VkDescriptorAddressInfoEXT)];
+   if (offset >= ssbos && offset < ssbos + sizeof(ctx->di.db.ssbos))
+      return &ctx->dd.db.buffer_cache[(sizeof(ctx->di.db.ubos) + offset - ssbos) / sizeof(VkDescriptorAddressInfoEXT)];
+   return NULL;
+}
+
+/* a buffer descriptor is fully determined by its type, size and
+ * VkDescriptorAddressInfoEXT (address, range and format), so slots which
+ * haven't been rebound since they were last written can skip
+ * vkGetDescriptorEXT and copy the last result into the new set
+ */
+static void
+get_db_descriptor(struct zink_context *ctx, VkDescriptorGetInfoEXT *info, size_t offset, size_t size, uint8_t *dst)
+{
+   struct zink_screen *screen = zink_screen(ctx->base.screen);
+   struct zink_db_buffer_cache_entry *entry = get_db_buffer_cache_entry(ctx, offset);
+
+   /* VkDescriptorDataEXT is a union of pointers; the member doesn't matter */
+   info->data.pSampler = (void*)(((uint8_t*)ctx) + offset);
+   if (!entry) {
+      VKSCR(GetDescriptorEXT)(screen->dev, info, size, dst);
+      return;
+   }
+   if (entry->type != info->type || entry->size != size ||
+       memcmp(&entry->info, info->data.pUniformBuffer, sizeof(entry->info))) {
+      VKSCR(GetDescriptorEXT)(screen->dev, info, size, entry->db);
+      memcpy(&entry->info, info->data.pUniformBuffer, sizeof(entry->info));
+      entry->type = info->type;
+      entry->size = size;
+   }
+   memcpy(dst, entry->db, size);
+}
+
 /* updates the mask of changed_sets and binds the mask of bind_sets */
 static void
 zink_descriptors_update_masked_buffer(struct zink_context *ctx, bool is_compute, uint8_t changed_sets, uint8_t bind_sets)
@@ -1168,11 +1210,9 @@ zink_descriptors_update_masked_buffer(struct zink_context *ctx, bool is_compute,
             if (screen->info.db_props.combinedImageSamplerDescriptorSingleArray ||
                 key->bindings[i].descriptorType != VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER ||
                 key->bindings[i].descriptorCount == 1) {
-               for (unsigned j = 0; j < key->bindings[i].descriptorCount; j++) {
-                  /* VkDescriptorDataEXT is a union of pointers; the member doesn't matter */
-                  info.data.pSampler = (void*)(((uint8_t*)ctx) + pg->dd.db_template[type][i].offset + j * pg->dd.db_template[type][i].stride);
-                  VKSCR(GetDescriptorEXT)(screen->dev, &info, pg->dd.db_template[type][i].db_size, bs->dd.db_map + desc_offset + j * pg->dd.db_template[type][i].db_size);
-               }
+               for (unsigned j = 0; j < key->bindings[i].descriptorCount; j++)
+                  get_db_descriptor(ctx, &info, pg->dd.db_template[type][i].offset + j * pg->dd.db_template[type][i].stride,
+                                    pg->dd.db_template[type][i].db_size, bs->dd.db_map + desc_offset + j * pg->dd.db_template[type][i].db_size);
             } else {
                assert(key->bindings[i].descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
                char buf[1024];
@@ -1644,6 +1684,10 @@ zink_descriptors_init(struct zink_context *ctx)
       }
       /* start small */
       ctx->dd.db.max_db_size = 250;
+      if (screen->info.db_props.robustUniformBufferDescriptorSize <= ZINK_MAX_DB_BUFFER_DESCRIPTOR_SIZE &&
+          screen->info.db_props.robustStorageBufferDescriptorSize <= ZINK_MAX_DB_BUFFER_DESCRIPTOR_SIZE)
+         ctx->dd.db.buffer_cache = calloc((sizeof(ctx->di.db.ubos) + sizeof(ctx->di.db.ssbos)) / sizeof(VkDescriptorAddressInfoEXT),
+                                          sizeof(struct zink_db_buffer_cache_entry));
    }
 
    return true;
@@ -1658,6 +1702,8 @@ zink_descriptors_deinit(struct zink_context *ctx)
       VKSCR(DestroyDescriptorSetLayout)(screen->dev, ctx->dd.push_dsl[0]->layout, NULL);
    if (ctx->dd.push_dsl[1])
       VKSCR(DestroyDescriptorSetLayout)(screen->dev, ctx->dd.push_dsl[1]->layout, NULL);
+   if (zink_descriptor_mode == ZINK_DESCRIPTOR_MODE_DB)
+      free(ctx->dd.db.buffer_cache);
 }
 
 /* called on screen creation */
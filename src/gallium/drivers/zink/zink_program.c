@@ -1519,12 +1519,15 @@ zink_destroy_gfx_program(struct zink_screen *screen,
 
    if (prog->is_separable)
       zink_gfx_program_reference(screen, &prog->full_prog, NULL);
+   bool has_optimized = false;
    for (unsigned r = 0; r < ARRAY_SIZE(prog->pipelines); r++) {
       for (int i = 0; i < max_idx; ++i) {
          hash_table_foreach(&prog->pipelines[r][i], entry) {
             struct zink_gfx_pipeline_cache_entry *pc_entry = entry->data;
 
             util_queue_fence_wait(&pc_entry->fence);
+            has_optimized |= pc_entry->gpl.unoptimized_pipeline ||
+                             (prog->base.uses_shobj && !prog->is_separable && pc_entry->pipeline);
             VKSCR(DestroyPipeline)(screen->dev, pc_entry->pipeline, NULL);
             VKSCR(DestroyPipeline)(screen->dev, pc_entry->gpl.unoptimized_pipeline, NULL);
             free(pc_entry);
@@ -1532,6 +1535,14 @@ zink_destroy_gfx_program(struct zink_screen *screen,
       }
    }
 
+   /* optimized pipelines are compiled in the background after the pipeline
+    * cache was last stored: store it once more so the next run finds them
+    */
+   if (has_optimized) {
+      util_queue_fence_wait(&prog->base.cache_fence);
+      zink_screen_update_pipeline_cache(screen, &prog->base, false);
+   }
+
    deinit_program(screen, &prog->base);
 
    for (int i = 0; i < ZINK_GFX_SHADER_COUNT; ++i) {
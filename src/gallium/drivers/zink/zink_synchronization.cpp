@@ -264,6 +264,16 @@ unordered_res_exec(const struct zink_context *ctx, const struct zink_resource *r
    return res->obj->unordered_write || !zink_batch_usage_matches(res->obj->bo->writes.u, ctx->batch.state);
 }
 
+/* pick the cmdbuf for a transfer/barrier on src/dst: work that doesn't depend on
+ * anything already recorded this batch goes to barrier_cmdbuf, which is submitted
+ * ahead of the main cmdbuf, so uploads are hoisted out of render passes without
+ * needing a separate queue
+ *
+ * uploads still can't go to a dedicated transfer queue: every resource is created
+ * VK_SHARING_MODE_EXCLUSIVE for the gfx queue family, so a transfer queue would need
+ * queue family ownership transfers on both queues plus a semaphore wait for every
+ * batch that consumes an upload
+ */
 VkCommandBuffer
 zink_get_cmdbuf(struct zink_context *ctx, struct zink_resource *src, struct zink_resource *dst)
 {
@@ -589,6 +599,24 @@ zink_resource_buffer_barrier(struct zink_context *ctx, struct zink_resource *res
 
    if (!can_skip_unordered && !can_skip_ordered) {
       VkCommandBuffer cmdbuf = is_write ? zink_get_cmdbuf(ctx, NULL, res) : zink_get_cmdbuf(ctx, res, NULL);
+      VkPipelineStageFlags stages = res->obj->access_stage ? res->obj->access_stage : pipeline_access_stage(res->obj->access);
+      if (ctx->buffer_barrier_batch.active) {
+         /* buffer barriers are global memory barriers, so all of them for the same cmdbuf
+          * can be merged into one and recorded by zink_buffer_barrier_batch_end()
+          */
+         unsigned idx = cmdbuf == ctx->batch.state->barrier_cmdbuf;
+         if (unordered && usage_matches) {
+            ctx->buffer_barrier_batch.src_stage[idx] |= res->obj->unordered_access_stage;
+            ctx->buffer_barrier_batch.src_access[idx] |= res->obj->unordered_access;
+         } else {
+            ctx->buffer_barrier_batch.src_stage[idx] |= stages;
+            ctx->buffer_barrier_batch.src_access[idx] |= res->obj->access;
+         }
+         ctx->buffer_barrier_batch.dst_stage[idx] |= pipeline;
+         ctx->buffer_barrier_batch.dst_access[idx] |= flags;
+         ctx->buffer_barrier_batch.cmdbuf[idx] = cmdbuf;
+         goto done;
+      }
       bool marker = false;
       if (unlikely(zink_tracing)) {
          char buf[4096];
@@ -596,7 +624,6 @@ zink_resource_buffer_barrier(struct zink_context *ctx, struct zink_resource *res
          marker = zink_cmd_debug_marker_begin(ctx, cmdbuf, "buffer_barrier(%s)", buf);
       }
 
-      VkPipelineStageFlags stages = res->obj->access_stage ? res->obj->access_stage : pipeline_access_stage(res->obj->access);;
       if (HAS_SYNC2) {
          VkMemoryBarrier2 bmb;
          bmb.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
@@ -646,6 +673,7 @@ zink_resource_buffer_barrier(struct zink_context *ctx, struct zink_resource *res
       zink_cmd_debug_marker_end(ctx, cmdbuf, marker);
    }
 
+done:
    resource_check_defer_buffer_barrier(ctx, res, pipeline);
 
    if (is_write)
@@ -668,14 +696,81 @@ zink_resource_buffer_barrier(struct zink_context *ctx, struct zink_resource *res
       zink_resource_copies_reset(res);
 }
 
+/* start merging the memory barriers of buffer_barrier() calls instead of recording
+ * one vkCmdPipelineBarrier per resource; the caller must not record any other commands
+ * until screen->buffer_barrier_batch_end()
+ */
+void
+zink_buffer_barrier_batch_begin(struct zink_context *ctx)
+{
+   assert(!ctx->buffer_barrier_batch.active);
+   memset(&ctx->buffer_barrier_batch, 0, sizeof(ctx->buffer_barrier_batch));
+   ctx->buffer_barrier_batch.active = true;
+}
+
+/* record the merged buffer barriers, at most one per cmdbuf */
+template <bool HAS_SYNC2>
+void
+zink_buffer_barrier_batch_end(struct zink_context *ctx)
+{
+   assert(ctx->buffer_barrier_batch.active);
+   ctx->buffer_barrier_batch.active = false;
+
+   for (unsigned i = 0; i < ARRAY_SIZE(ctx->buffer_barrier_batch.cmdbuf); i++) {
+      VkCommandBuffer cmdbuf = ctx->buffer_barrier_batch.cmdbuf[i];
+      if (!cmdbuf)
+         continue;
+      assert(cmdbuf == (i ? ctx->batch.state->barrier_cmdbuf : ctx->batch.state->cmdbuf));
+
+      if (HAS_SYNC2) {
+         VkMemoryBarrier2 bmb;
+         bmb.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER_2;
+         bmb.pNext = NULL;
+         bmb.srcStageMask = ctx->buffer_barrier_batch.src_stage[i];
+         bmb.srcAccessMask = ctx->buffer_barrier_batch.src_access[i];
+         bmb.dstStageMask = ctx->buffer_barrier_batch.dst_stage[i];
+         bmb.dstAccessMask = ctx->buffer_barrier_batch.dst_access[i];
+         VkDependencyInfo dep = {
+            VK_STRUCTURE_TYPE_DEPENDENCY_INFO,
+            NULL,
+            0,
+            1,
+            &bmb,
+            0,
+            NULL,
+            0,
+            NULL
+         };
+         VKCTX(CmdPipelineBarrier2)(cmdbuf, &dep);
+      } else {
+         VkMemoryBarrier bmb;
+         bmb.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+         bmb.pNext = NULL;
+         bmb.srcAccessMask = ctx->buffer_barrier_batch.src_access[i];
+         bmb.dstAccessMask = ctx->buffer_barrier_batch.dst_access[i];
+         VKCTX(CmdPipelineBarrier)(
+            cmdbuf,
+            ctx->buffer_barrier_batch.src_stage[i] ? ctx->buffer_barrier_batch.src_stage[i] : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+            ctx->buffer_barrier_batch.dst_stage[i],
+            0,
+            1, &bmb,
+            0, NULL,
+            0, NULL
+         );
+      }
+   }
+}
+
 void
 zink_synchronization_init(struct zink_screen *screen)
 {
    if (screen->info.have_vulkan13 || screen->info.have_KHR_synchronization2) {
       screen->buffer_barrier = zink_resource_buffer_barrier<true>;
       screen->image_barrier = zink_resource_image_barrier<true>;
+      screen->buffer_barrier_batch_end = zink_buffer_barrier_batch_end<true>;
    } else {
       screen->buffer_barrier = zink_resource_buffer_barrier<false>;
       screen->image_barrier = zink_resource_image_barrier<false>;
+      screen->buffer_barrier_batch_end = zink_buffer_barrier_batch_end<false>;
    }
 }
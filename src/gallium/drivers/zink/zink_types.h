@@ -76,6 +76,8 @@
 #define ZINK_MAX_SHADER_IMAGES 32
 /* total number of bindless ids that can be allocated */
 #define ZINK_MAX_BINDLESS_HANDLES 1024
+/* largest buffer descriptor that can be kept in the db buffer descriptor cache */
+#define ZINK_MAX_DB_BUFFER_DESCRIPTOR_SIZE 64
 
 /* enum zink_descriptor_type */
 #define ZINK_MAX_DESCRIPTOR_SETS 6
@@ -423,6 +425,14 @@ struct zink_descriptor_template {
    size_t offset; //the offset of the base host pointer to update from
 };
 
+/* the last descriptor written for a ubo/ssbo slot in db mode */
+struct zink_db_buffer_cache_entry {
+   VkDescriptorAddressInfoEXT info;
+   VkDescriptorType type;
+   size_t size;
+   uint8_t db[ZINK_MAX_DB_BUFFER_DESCRIPTOR_SIZE];
+};
+
 /* ctx->dd; created at context creation */
 struct zink_descriptor_data {
    bool bindless_bound;
@@ -447,6 +457,8 @@ struct zink_descriptor_data {
          struct pipe_transfer *bindless_db_xfer;
          uint32_t bindless_db_offsets[4];
          unsigned max_db_size;
+         /* indexed by ctx->di.db.ubos slots followed by ctx->di.db.ssbos slots */
+         struct zink_db_buffer_cache_entry *buffer_cache;
       } db;
    };
 
@@ -1486,6 +1498,7 @@ struct zink_screen {
 
    void (*buffer_barrier)(struct zink_context *ctx, struct zink_resource *res, VkAccessFlags flags, VkPipelineStageFlags pipeline);
    void (*image_barrier)(struct zink_context *ctx, struct zink_resource *res, VkImageLayout new_layout, VkAccessFlags flags, VkPipelineStageFlags pipeline);
+   void (*buffer_barrier_batch_end)(struct zink_context *ctx);
 
    bool compact_descriptors; /**< toggled if descriptor set ids are compacted */
    uint8_t desc_set_id[ZINK_MAX_DESCRIPTOR_SETS]; /**< converts enum zink_descriptor_type -> the actual set id */
@@ -1976,6 +1989,15 @@ struct zink_context {
    struct set *need_barriers[2]; //gfx, compute
    struct set update_barriers[2][2]; //[gfx, compute][current, next]
    uint8_t barrier_set_idx[2];
+   /* buffer barriers merged during zink_update_barriers: [cmdbuf, barrier_cmdbuf] */
+   struct {
+      bool active;
+      VkCommandBuffer cmdbuf[2];
+      VkPipelineStageFlags src_stage[2];
+      VkPipelineStageFlags dst_stage[2];
+      VkAccessFlags src_access[2];
+      VkAccessFlags dst_access[2];
+   } buffer_barrier_batch;
    unsigned memory_barrier;
 
    uint32_t ds3_states;
@@ -1088,6 +1088,16 @@ handle_set_stage_buffer(struct rendering_state *state,
                         gl_shader_stage stage,
                         uint32_t index)
 {
+   struct pipe_constant_buffer *cbuf = &state->const_buffer[stage][index];
+
+   /* Rebinding the same set memory is common: descriptors are read through
+    * the buffer pointer, so there's nothing to update in the driver.
+    */
+   if (cbuf->buffer == bo && cbuf->buffer_offset == offset &&
+       cbuf->buffer_size == bo->width0 && !cbuf->user_buffer &&
+       state->num_const_bufs[stage] > index)
+      return;
+
    state->const_buffer[stage][index].buffer = bo;
    state->const_buffer[stage][index].buffer_offset = offset;
    state->const_buffer[stage][index].buffer_size = bo->width0;
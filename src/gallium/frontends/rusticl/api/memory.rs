@@ -1663,6 +1663,10 @@ fn enqueue_map_buffer(
         return Err(CL_INVALID_CONTEXT);
     }
 
+    // The old content doesn't have to be synced if the whole buffer gets invalidated.
+    let discard =
+        bit_check(map_flags, CL_MAP_WRITE_INVALIDATE_REGION) && offset == 0 && size == b.size;
+
     let ptr = b.map_buffer(&q, offset, size)?;
     create_and_queue(
         q,
@@ -1670,7 +1674,7 @@ fn enqueue_map_buffer(
         evs,
         event,
         block,
-        Box::new(move |q, ctx| b.sync_shadow_buffer(q, ctx, ptr)),
+        Box::new(move |q, ctx| b.sync_shadow_buffer(q, ctx, ptr, discard)),
     )?;
 
     Ok(ptr)
@@ -2142,6 +2146,11 @@ fn enqueue_map_image(
         unsafe { image_slice_pitch.as_mut().unwrap() }
     };
 
+    // The old content doesn't have to be synced if the whole image gets invalidated.
+    let discard = bit_check(map_flags, CL_MAP_WRITE_INVALIDATE_REGION)
+        && origin == CLVec::default()
+        && region == i.image_desc.size();
+
     let ptr = i.map_image(
         &q,
         &origin,
@@ -2156,7 +2165,7 @@ fn enqueue_map_image(
         evs,
         event,
         block,
-        Box::new(move |q, ctx| i.sync_shadow_image(q, ctx, ptr)),
+        Box::new(move |q, ctx| i.sync_shadow_image(q, ctx, ptr, discard)),
     )?;
 
     Ok(ptr)
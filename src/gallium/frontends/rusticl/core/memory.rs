@@ -985,15 +985,17 @@ impl Mem {
         Ok(())
     }
 
-    // TODO: only sync on map when the memory is not mapped with discard
+    /// `discard` is set when the whole buffer gets mapped with CL_MAP_WRITE_INVALIDATE_REGION, in
+    /// which case the old content doesn't need to be copied.
     pub fn sync_shadow_buffer(
         &self,
         q: &Arc<Queue>,
         ctx: &PipeContext,
         ptr: *mut c_void,
+        discard: bool,
     ) -> CLResult<()> {
         let mut lock = self.maps.lock().unwrap();
-        if !lock.increase_ref(q.device, ptr) {
+        if !lock.increase_ref(q.device, ptr) || discard {
             return Ok(());
         }
 
@@ -1015,15 +1017,17 @@ impl Mem {
         }
     }
 
-    // TODO: only sync on map when the memory is not mapped with discard
+    /// `discard` is set when the whole image gets mapped with CL_MAP_WRITE_INVALIDATE_REGION, in
+    /// which case the old content doesn't need to be copied.
     pub fn sync_shadow_image(
         &self,
         q: &Arc<Queue>,
         ctx: &PipeContext,
         ptr: *mut c_void,
+        discard: bool,
     ) -> CLResult<()> {
         let mut lock = self.maps.lock().unwrap();
-        if !lock.increase_ref(q.device, ptr) {
+        if !lock.increase_ref(q.device, ptr) || discard {
             return Ok(());
         }
 
@@ -180,7 +180,12 @@ impl ProgramBuild {
             let mut bin = spirv.to_bin().to_vec();
             bin.extend_from_slice(name.as_bytes());
 
-            for (k, v) in &self.spec_constants {
+            // HashMap iteration order differs between processes, so sort the spec constants to
+            // get a stable key.
+            let mut spec_constants: Vec<_> = self.spec_constants.iter().collect();
+            spec_constants.sort_unstable_by_key(|(k, _)| **k);
+
+            for (k, v) in spec_constants {
                 bin.extend_from_slice(&k.to_ne_bytes());
                 unsafe {
                     // SAFETY: we fully initialize this union
@@ -33,6 +33,9 @@ pub struct Queue {
 
 impl_cl_type_trait!(cl_command_queue, Queue, CL_INVALID_COMMAND_QUEUE);
 
+/// Maximum number of application flushes the queue thread handles with a single pipe flush.
+const MAX_COALESCED_FLUSHES: usize = 8;
+
 fn flush_events(evs: &mut Vec<Arc<Event>>, pipe: &PipeContext) {
     if !evs.is_empty() {
         pipe.flush().wait();
@@ -70,10 +73,15 @@ impl Queue {
                             break;
                         }
 
-                        let new_events = r.unwrap();
+                        // Also take the batches the application has flushed in the meantime, so
+                        // consecutive flushes end up in a single pipe flush. Only what is already
+                        // queued is taken, and at most MAX_COALESCED_FLUSHES batches, so a busy
+                        // producer can't hold back the completion of earlier events.
+                        let mut batches = vec![r.unwrap()];
+                        batches.extend(rx_t.try_iter().take(MAX_COALESCED_FLUSHES - 1));
                         let mut flushed = Vec::new();
 
-                        for e in new_events {
+                        for e in batches.into_iter().flatten() {
                             // If we hit any deps from another queue, flush so we don't risk a dead
                             // lock.
                             if e.deps.iter().any(|ev| ev.queue != e.queue) {
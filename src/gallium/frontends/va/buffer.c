@@ -501,6 +501,7 @@ vlVaSyncBuffer(VADriverContextP ctx, VABufferID buf_id, uint64_t timeout_ns)
 
    vlVaSurface* surf = handle_table_get(drv->htab, buf->associated_encode_input_surf);
 
+   mtx_lock(&context->mutex);
    if ((buf->feedback) && (context->decoder->entrypoint == PIPE_VIDEO_ENTRYPOINT_ENCODE)) {
       context->decoder->get_feedback(context->decoder, buf->feedback, &(buf->coded_size));
       buf->feedback = NULL;
@@ -512,6 +513,7 @@ vlVaSyncBuffer(VADriverContextP ctx, VABufferID buf_id, uint64_t timeout_ns)
          buf->associated_encode_input_surf = VA_INVALID_ID;
       }
    }
+   mtx_unlock(&context->mutex);
 
    mtx_unlock(&drv->mutex);
    return VA_STATUS_SUCCESS;
@@ -366,6 +366,8 @@ vlVaCreateContext(VADriverContextP ctx, VAConfigID config_id, int picture_width,
       }
    }
 
+   (void) mtx_init(&context->mutex, mtx_plain);
+
    mtx_lock(&drv->mutex);
    *context_id = handle_table_add(drv->htab, context);
    mtx_unlock(&drv->mutex);
@@ -393,6 +395,9 @@ vlVaDestroyContext(VADriverContextP ctx, VAContextID context_id)
       return VA_STATUS_ERROR_INVALID_CONTEXT;
    }
 
+   /* Wait for any vaSyncSurface still waiting on this context's decoder. */
+   mtx_lock(&context->mutex);
+
    if (context->decoder) {
       if (context->desc.base.entry_point == PIPE_VIDEO_ENTRYPOINT_ENCODE) {
          if (u_reduce_video_profile(context->decoder->profile) ==
@@ -426,6 +431,8 @@ vlVaDestroyContext(VADriverContextP ctx, VAContextID context_id)
       FREE(context->deint);
    }
    FREE(context->desc.base.decrypt_key);
+   mtx_unlock(&context->mutex);
+   mtx_destroy(&context->mutex);
    FREE(context);
    handle_table_remove(drv->htab, context_id);
    mtx_unlock(&drv->mutex);
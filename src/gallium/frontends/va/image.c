@@ -33,6 +33,8 @@
 #include "util/u_surface.h"
 #include "util/u_video.h"
 #include "util/u_process.h"
+#include "util/streaming-load-memcpy.h"
+#include "util/format/u_format.h"
 
 #include "vl/vl_winsys.h"
 #include "vl/vl_video_buffer.h"
@@ -488,6 +490,29 @@ vlVaSetImagePalette(VADriverContextP ctx, VAImageID image, unsigned char *palett
    return VA_STATUS_ERROR_UNIMPLEMENTED;
 }
 
+/* Copy a plane out of a mapped surface. The mapping is usually write-combined
+ * or uncached GPU memory, so use streaming loads instead of plain memcpy.
+ */
+static void
+vlVaReadbackRect(uint8_t *dst, unsigned dst_stride,
+                 enum pipe_format format, unsigned width, unsigned height,
+                 uint8_t *src, unsigned src_stride)
+{
+   unsigned row_size = util_format_get_stride(format, width);
+   unsigned rows = util_format_get_nblocksy(format, height);
+
+   if (dst_stride == row_size && src_stride == row_size) {
+      util_streaming_load_memcpy(dst, src, (size_t)row_size * rows);
+      return;
+   }
+
+   for (unsigned y = 0; y < rows; y++) {
+      util_streaming_load_memcpy(dst, src, row_size);
+      dst += dst_stride;
+      src += src_stride;
+   }
+}
+
 VAStatus
 vlVaGetImage(VADriverContextP ctx, VASurfaceID surface, int x, int y,
              unsigned int width, unsigned int height, VAImageID image)
@@ -615,10 +640,10 @@ vlVaGetImage(VADriverContextP ctx, VASurfaceID surface, int x, int y,
                transfer->stride, view_resources[i]->array_size,
                map, box.width, box.height);
          } else {
-            util_copy_rect((uint8_t*)(data[i] + pitches[i] * j),
-               view_resources[i]->format,
-               pitches[i] * view_resources[i]->array_size, 0, 0,
-               box.width, box.height, map, transfer->stride, 0, 0);
+            vlVaReadbackRect((uint8_t*)(data[i] + pitches[i] * j),
+               pitches[i] * view_resources[i]->array_size,
+               view_resources[i]->format, box.width, box.height,
+               map, transfer->stride);
          }
          pipe_texture_unmap(drv->pipe, transfer);
       }
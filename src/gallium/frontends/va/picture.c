@@ -790,11 +790,13 @@ vlVaRenderPicture(VADriverContextP ctx, VAContextID context_id, VABufferID *buff
       mtx_unlock(&drv->mutex);
       return VA_STATUS_ERROR_INVALID_CONTEXT;
    }
+   mtx_lock(&context->mutex);
 
    /* Always process VAProtectedSliceDataBufferType first because it changes the state */
    for (i = 0; i < num_buffers; ++i) {
       vlVaBuffer *buf = handle_table_get(drv->htab, buffers[i]);
       if (!buf) {
+         mtx_unlock(&context->mutex);
          mtx_unlock(&drv->mutex);
          return VA_STATUS_ERROR_INVALID_BUFFER;
       }
@@ -874,6 +876,7 @@ vlVaRenderPicture(VADriverContextP ctx, VAContextID context_id, VABufferID *buff
          break;
       }
    }
+   mtx_unlock(&context->mutex);
    mtx_unlock(&drv->mutex);
 
    return vaStatus;
@@ -1062,6 +1065,7 @@ vlVaEndPicture(VADriverContextP ctx, VAContextID context_id)
       *out_target = surf->buffer;
    }
 
+   mtx_lock(&context->mutex);
    if (context->decoder->entrypoint == PIPE_VIDEO_ENTRYPOINT_ENCODE) {
       context->desc.base.fence = &surf->fence;
       struct pipe_screen *screen = context->decoder->context->screen;
@@ -1139,6 +1143,7 @@ vlVaEndPicture(VADriverContextP ctx, VAContextID context_id)
          context->desc.av1enc.frame_num++;
    }
 
+   mtx_unlock(&context->mutex);
    mtx_unlock(&drv->mutex);
    return VA_STATUS_SUCCESS;
 }
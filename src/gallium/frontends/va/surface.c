@@ -137,29 +137,40 @@ vlVaSyncSurface(VADriverContextP ctx, VASurfaceID render_target)
       return VA_STATUS_ERROR_UNSUPPORTED_ENTRYPOINT;
    }
 
+   mtx_lock(&context->mutex);
+
    if (context->decoder->entrypoint == PIPE_VIDEO_ENTRYPOINT_PROCESSING) {
       /* If driver does not implement get_processor_fence assume no
        * async work needed to be waited on and return success
        */
       int ret = (context->decoder->get_processor_fence) ? 0 : 1;
+      struct pipe_fence_handle *fence = surf->fence;
+
+      /* The fence belongs to the decoder, which the context mutex keeps
+       * alive, so the wait doesn't need to block other VA calls.
+       */
+      mtx_unlock(&drv->mutex);
 
       if (context->decoder->get_processor_fence)
          ret = context->decoder->get_processor_fence(context->decoder,
-                                                     surf->fence,
+                                                     fence,
                                                      PIPE_DEFAULT_DECODER_FEEDBACK_TIMEOUT_NS);
 
-      mtx_unlock(&drv->mutex);
+      mtx_unlock(&context->mutex);
       // Assume that the GPU has hung otherwise.
       return ret ? VA_STATUS_SUCCESS : VA_STATUS_ERROR_TIMEDOUT;
    } else if (context->decoder->entrypoint == PIPE_VIDEO_ENTRYPOINT_BITSTREAM) {
+      struct pipe_fence_handle *fence = surf->fence;
       int ret = 0;
 
+      mtx_unlock(&drv->mutex);
+
       if (context->decoder->get_decoder_fence)
          ret = context->decoder->get_decoder_fence(context->decoder,
-                                                   surf->fence,
+                                                   fence,
                                                    PIPE_DEFAULT_DECODER_FEEDBACK_TIMEOUT_NS);
 
-      mtx_unlock(&drv->mutex);
+      mtx_unlock(&context->mutex);
       // Assume that the GPU has hung otherwise.
       return ret ? VA_STATUS_SUCCESS : VA_STATUS_ERROR_TIMEDOUT;
    } else if (context->decoder->entrypoint == PIPE_VIDEO_ENTRYPOINT_ENCODE) {
@@ -186,6 +197,7 @@ vlVaSyncSurface(VADriverContextP ctx, VASurfaceID render_target)
       surf->coded_buf->feedback = NULL;
       surf->coded_buf->associated_encode_input_surf = VA_INVALID_ID;
    }
+   mtx_unlock(&context->mutex);
    mtx_unlock(&drv->mutex);
    return VA_STATUS_SUCCESS;
 }
@@ -236,6 +248,7 @@ vlVaQuerySurfaceStatus(VADriverContextP ctx, VASurfaceID render_target, VASurfac
       return VA_STATUS_ERROR_UNSUPPORTED_ENTRYPOINT;
    }
 
+   mtx_lock(&context->mutex);
    if (context->decoder->entrypoint == PIPE_VIDEO_ENTRYPOINT_ENCODE) {
       if(surf->feedback == NULL)
          *status=VASurfaceReady;
@@ -274,6 +287,7 @@ vlVaQuerySurfaceStatus(VADriverContextP ctx, VASurfaceID render_target, VASurfac
       else
          *status = VASurfaceRendering;
    }
+   mtx_unlock(&context->mutex);
 
    mtx_unlock(&drv->mutex);
 
@@ -372,6 +372,12 @@ typedef struct {
    bool needs_begin_frame;
    void *blit_cs;
    int packed_header_type;
+
+   /* Held around every call into the decoder. Taken with the driver mutex
+    * held; vaSyncSurface then drops the driver mutex and waits holding only
+    * this one.
+    */
+   mtx_t mutex;
 } vlVaContext;
 
 typedef struct {
@@ -1868,6 +1868,12 @@ static int amdgpu_cs_flush(struct radeon_cmdbuf *rcs,
       amdgpu_inc_bo_num_active_ioctls(cur->num_slab_buffers, cur->slab_buffers);
       amdgpu_inc_bo_num_active_ioctls(cur->num_sparse_buffers, cur->sparse_buffers);
 
+      /* Each CS has at most one submission in flight, because "cst" is
+       * reused for it below.  So the submit thread never sees two queued
+       * jobs from the same CS that it could merge, and jobs from different
+       * CSs can't share an ioctl: they may belong to different kernel
+       * contexts and each needs its own fence.
+       */
       amdgpu_cs_sync_flush(rcs);
 
       /* Swap command streams. "cst" is going to be submitted. */
@@ -524,6 +524,17 @@ static const struct gbm_dri_visual gbm_dri_visuals_table[] = {
    },
 };
 
+static int
+gbm_format_to_visual_index(uint32_t gbm_format)
+{
+   for (size_t i = 0; i < ARRAY_SIZE(gbm_dri_visuals_table); i++) {
+      if (gbm_dri_visuals_table[i].gbm_format == gbm_format)
+         return i;
+   }
+
+   return -1;
+}
+
 static int
 gbm_format_to_dri_format(uint32_t gbm_format)
 {
@@ -555,11 +566,14 @@ gbm_dri_is_format_supported(struct gbm_device *gbm,
    struct gbm_dri_device *dri = gbm_dri_device(gbm);
    int count;
 
+   STATIC_ASSERT(ARRAY_SIZE(gbm_dri_visuals_table) <= GBM_DRI_MAX_VISUALS);
+
    if ((usage & GBM_BO_USE_CURSOR) && (usage & GBM_BO_USE_RENDERING))
       return 0;
 
    format = gbm_core.v0.format_canonicalize(format);
-   if (gbm_format_to_dri_format(format) == 0)
+   int index = gbm_format_to_visual_index(format);
+   if (index < 0 || gbm_dri_visuals_table[index].dri_image_format == 0)
       return 0;
 
    /* If there is no query, fall back to the small table which was originally
@@ -575,12 +589,17 @@ gbm_dri_is_format_supported(struct gbm_device *gbm,
       }
    }
 
-   /* This returns false if the format isn't supported */
-   if (!dri->image->queryDmaBufModifiers(dri->screen, format, 0, NULL, NULL,
-                                         &count))
-      return 0;
+   /* The answer doesn't change for the lifetime of the screen, and racing
+    * callers store the same value.
+    */
+   if (!dri->format_supported[index]) {
+      /* This returns false if the format isn't supported */
+      dri->format_supported[index] =
+         dri->image->queryDmaBufModifiers(dri->screen, format, 0, NULL, NULL,
+                                          &count) ? 1 : -1;
+   }
 
-   return 1;
+   return dri->format_supported[index] > 0;
 }
 
 static int
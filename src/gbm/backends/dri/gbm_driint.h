@@ -60,6 +60,8 @@ struct gbm_dri_visual {
    bool is_float;
 };
 
+#define GBM_DRI_MAX_VISUALS 64
+
 struct gbm_dri_device {
    struct gbm_device base;
 
@@ -124,6 +126,11 @@ struct gbm_dri_device {
 
    const struct gbm_dri_visual *visual_table;
    int num_visuals;
+
+   /* Cached queryDmaBufModifiers results per entry of the visuals table:
+    * 0 if not queried yet, 1 if supported, -1 if not.
+    */
+   int8_t format_supported[GBM_DRI_MAX_VISUALS];
 };
 
 struct gbm_dri_bo {
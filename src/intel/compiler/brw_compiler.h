@@ -1987,6 +1987,11 @@ struct brw_compile_fs_params {
    bool allow_spilling;
    bool use_rep_send;
 
+   /* Don't try a SIMD32 compile, to save compile time on shaders that are
+    * not expected to be used for long.
+    */
+   bool skip_simd32;
+
    struct brw_compile_stats *stats;
 
    void *log_data;
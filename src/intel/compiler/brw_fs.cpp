@@ -7786,7 +7786,7 @@ brw_compile_fs(const struct brw_compiler *compiler,
    if (!has_spilled &&
        v8->max_dispatch_width >= 32 && !params->use_rep_send &&
        devinfo->ver >= 6 && !simd16_failed &&
-       INTEL_SIMD(FS, 32)) {
+       !params->skip_simd32 && INTEL_SIMD(FS, 32)) {
       /* Try a SIMD32 compile */
       v32 = std::make_unique<fs_visitor>(compiler, params->log_data, mem_ctx, &key->base,
                                          &prog_data->base, nir, 32,
@@ -8055,6 +8055,11 @@ brw_compile_cs(const struct brw_compiler *compiler,
 
    std::unique_ptr<fs_visitor> v[3];
 
+   /* The variants are compiled in order and not concurrently: each one
+    * allocates out of mem_ctx and writes prog_data, imports the uniform
+    * layout of the first variant that compiled, and only gets to spill or
+    * run at all depending on how the narrower ones turned out.
+    */
    for (unsigned simd = 0; simd < 3; simd++) {
       if (!brw_simd_should_compile(simd_state, simd))
          continue;
@@ -31,6 +31,8 @@
 #include "util/set.h"
 #include "util/register_allocate.h"
 
+#include <algorithm>
+
 using namespace brw;
 
 static void
@@ -341,8 +343,10 @@ public:
    bool assign_regs(bool allow_spilling, bool spill_all);
 
 private:
+   void setup_fixed_interference(unsigned node, int node_start_ip);
    void setup_live_interference(unsigned node,
                                 int node_start_ip, int node_end_ip);
+   void setup_vgrf_live_interference();
    void setup_inst_interference(const fs_inst *inst);
 
    void build_interference_graph(bool allow_spilling);
@@ -482,8 +486,7 @@ namespace {
 }
 
 void
-fs_reg_alloc::setup_live_interference(unsigned node,
-                                      int node_start_ip, int node_end_ip)
+fs_reg_alloc::setup_fixed_interference(unsigned node, int node_start_ip)
 {
    /* Mark any virtual grf that is live between the start of the program and
     * the last use of a payload node interfering with that payload node.
@@ -511,6 +514,13 @@ fs_reg_alloc::setup_live_interference(unsigned node,
    /* Everything interferes with the scratch header */
    if (scratch_header_node >= 0)
       ra_add_node_interference(g, node, scratch_header_node);
+}
+
+void
+fs_reg_alloc::setup_live_interference(unsigned node,
+                                      int node_start_ip, int node_end_ip)
+{
+   setup_fixed_interference(node, node_start_ip);
 
    /* Add interference with every vgrf whose live range intersects this
     * node's.  We only need to look at nodes below this one as the reflexivity
@@ -525,6 +535,61 @@ fs_reg_alloc::setup_live_interference(unsigned node,
    }
 }
 
+/**
+ * Add the live range interference between all the VGRFs at once.
+ *
+ * This is equivalent to calling setup_live_interference() on every VGRF
+ * node, but instead of testing every pair of VGRFs it sweeps over the live
+ * ranges in order of their start IP and only tests the ranges that are still
+ * live, which is much cheaper on big shaders.
+ */
+void
+fs_reg_alloc::setup_vgrf_live_interference()
+{
+   const unsigned count = fs->alloc.count;
+   unsigned *order = ralloc_array(mem_ctx, unsigned, count);
+   unsigned *active = ralloc_array(mem_ctx, unsigned, count);
+   unsigned active_count = 0;
+
+   for (unsigned i = 0; i < count; i++)
+      order[i] = i;
+
+   std::sort(order, order + count, [this](unsigned a, unsigned b) {
+      return live.vgrf_start[a] < live.vgrf_start[b];
+   });
+
+   for (unsigned i = 0; i < count; i++) {
+      const unsigned vgrf = order[i];
+      const int start_ip = live.vgrf_start[vgrf];
+      const int end_ip = live.vgrf_end[vgrf];
+
+      setup_fixed_interference(first_vgrf_node + vgrf, start_ip);
+
+      /* Ranges are visited in increasing start order, so a range that ended
+       * before this one starts can't interfere with any later range either.
+       */
+      unsigned kept = 0;
+      for (unsigned j = 0; j < active_count; j++) {
+         const unsigned other = active[j];
+         if (live.vgrf_end[other] <= start_ip)
+            continue;
+
+         active[kept++] = other;
+
+         if (live.vgrf_start[other] < end_ip)
+            ra_add_node_interference(g, first_vgrf_node + vgrf,
+                                     first_vgrf_node + other);
+      }
+      active_count = kept;
+
+      if (end_ip > start_ip)
+         active[active_count++] = vgrf;
+   }
+
+   ralloc_free(order);
+   ralloc_free(active);
+}
+
 void
 fs_reg_alloc::setup_inst_interference(const fs_inst *inst)
 {
@@ -731,11 +796,7 @@ fs_reg_alloc::build_interference_graph(bool allow_spilling)
    }
 
    /* Add interference based on the live range of the register */
-   for (unsigned i = 0; i < fs->alloc.count; i++) {
-      setup_live_interference(first_vgrf_node + i,
-                              live.vgrf_start[i],
-                              live.vgrf_end[i]);
-   }
+   setup_vgrf_live_interference();
 
    /* Add interference based on the instructions in which a register is used.
     */
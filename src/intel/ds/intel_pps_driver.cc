@@ -10,6 +10,7 @@
 
 #include <dirent.h>
 #include <fcntl.h>
+#include <iterator>
 #include <math.h>
 #include <poll.h>
 #include <strings.h>
@@ -24,7 +25,6 @@
 #include "perf/intel_perf_query.h"
 
 #include <pps/pps.h>
-#include <pps/pps_algorithm.h>
 
 #include "intel_pps_perf.h"
 #include "intel_pps_priv.h"
@@ -39,7 +39,7 @@ namespace pps
 
 uint64_t IntelDriver::get_min_sampling_period_ns()
 {
-   return (2.f * perf->devinfo.timestamp_frequency) / 1000000000ull;
+   return (2 * 1000000000ull) / perf->devinfo.timestamp_frequency;
 }
 
 IntelDriver::IntelDriver()
@@ -245,6 +245,8 @@ std::vector<PerfRecord> IntelDriver::parse_perf_records(const std::vector<uint8_
       iter += header->size;
    }
 
+   last_gpu_timestamp = prev_gpu_timestamp;
+
    return records;
 }
 
@@ -286,7 +288,9 @@ bool IntelDriver::dump_perfcnt()
       total_bytes_read = 0;
    }
 
-   APPEND(records, new_records);
+   records.insert(std::end(records),
+                  std::make_move_iterator(std::begin(new_records)),
+                  std::make_move_iterator(std::end(new_records)));
 
    if (records.size() < 2) {
       // Not enough records to accumulate
@@ -317,7 +321,7 @@ uint64_t IntelDriver::gpu_next()
    auto gpu_timestamp = records[1].timestamp;
 
    // Consume first record
-   records.erase(std::begin(records), std::begin(records) + 1);
+   records.pop_front();
 
    return intel_device_info_timebase_scale(&perf->devinfo, gpu_timestamp);
 }
@@ -57,6 +57,9 @@ static const uint32_t xtile_span = 64;
 static const uint32_t ytile_width = 128;
 static const uint32_t ytile_height = 32;
 static const uint32_t ytile_span = 16;
+static const uint32_t tile4_width = 128;
+static const uint32_t tile4_height = 32;
+static const uint32_t tile4_span = 16;
 
 static inline uint32_t
 ror(uint32_t n, uint32_t d)
@@ -405,6 +408,69 @@ linear_to_ytiled(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
    }
 }
 
+/**
+ * Tile4 offset of byte column 'x' within a tile.
+ *
+ * A Tile4 is made of 64B cells, each holding 4 rows of a 16B column.  Cells
+ * are grouped four across and two down into 512B blocks, and the blocks are
+ * laid out two across and four down in the 4KB tile.  The byte offset for
+ * (x, y) is thus the following interleaving of the x and y bits:
+ *
+ *    y[4:3] x[6] y[2] x[5:4] y[1:0] x[3:0]
+ */
+static inline uint32_t
+tile4_x_offset(uint32_t x)
+{
+   return (x & 0xf) | ((x & 0x30) << 2) | ((x & 0x40) << 3);
+}
+
+/**
+ * Tile4 offset of row 'y' within a tile.
+ *
+ * \sa tile4_x_offset
+ */
+static inline uint32_t
+tile4_y_offset(uint32_t y)
+{
+   return ((y & 0x3) << 4) | ((y & 0x4) << 6) | ((y & 0x18) << 7);
+}
+
+/**
+ * Copy texture data from linear to Tile4 layout.
+ *
+ * Tile4 is only used on platforms without bit-6 swizzling, so 'swizzle_bit'
+ * must be zero.
+ *
+ * \copydoc tile_copy_fn
+ */
+static inline void
+linear_to_tile4(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
+                uint32_t y0, uint32_t y1,
+                char *dst, const char *src,
+                int32_t src_pitch,
+                uint32_t swizzle_bit,
+                isl_mem_copy_fn mem_copy,
+                isl_mem_copy_fn mem_copy_align16)
+{
+   assert(swizzle_bit == 0);
+
+   src += (ptrdiff_t)y0 * src_pitch;
+
+   for (uint32_t y = y0; y < y1; y++) {
+      const uint32_t yo = tile4_y_offset(y);
+
+      mem_copy(dst + tile4_x_offset(x0) + yo, src + x0, x1 - x0);
+
+      for (uint32_t x = x1; x < x2; x += tile4_span) {
+         mem_copy_align16(dst + tile4_x_offset(x) + yo, src + x, tile4_span);
+      }
+
+      mem_copy_align16(dst + tile4_x_offset(x2) + yo, src + x2, x3 - x2);
+
+      src += src_pitch;
+   }
+}
+
 /**
  * Copy texture data from X tile layout to linear.
  *
@@ -569,6 +635,39 @@ ytiled_to_linear(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
    }
 }
 
+/**
+ * Copy texture data from Tile4 layout to linear.
+ *
+ * \copydoc linear_to_tile4
+ */
+static inline void
+tile4_to_linear(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
+                uint32_t y0, uint32_t y1,
+                char *dst, const char *src,
+                int32_t dst_pitch,
+                uint32_t swizzle_bit,
+                isl_mem_copy_fn mem_copy,
+                isl_mem_copy_fn mem_copy_align16)
+{
+   assert(swizzle_bit == 0);
+
+   dst += (ptrdiff_t)y0 * dst_pitch;
+
+   for (uint32_t y = y0; y < y1; y++) {
+      const uint32_t yo = tile4_y_offset(y);
+
+      mem_copy(dst + x0, src + tile4_x_offset(x0) + yo, x1 - x0);
+
+      for (uint32_t x = x1; x < x2; x += tile4_span) {
+         mem_copy_align16(dst + x, src + tile4_x_offset(x) + yo, tile4_span);
+      }
+
+      mem_copy_align16(dst + x2, src + tile4_x_offset(x2) + yo, x3 - x2);
+
+      dst += dst_pitch;
+   }
+}
+
 #if defined(INLINE_SSE41)
 static ALWAYS_INLINE void *
 _memcpy_streaming_load(void *dest, const void *src, size_t count)
@@ -588,7 +687,7 @@ _memcpy_streaming_load(void *dest, const void *src, size_t count)
       _mm_storeu_si128(((__m128i *)dest) + 3, val3);
       return dest;
    } else {
-      assert(count < 64); /* and (count < 16) for ytiled */
+      assert(count < 64); /* and (count < 16) for ytiled and tile4 */
       return memcpy(dest, src, count);
    }
 }
@@ -704,6 +803,48 @@ linear_to_ytiled_faster(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
                     dst, src, src_pitch, swizzle_bit, mem_copy, mem_copy);
 }
 
+/**
+ * Copy texture data from linear to Tile4 layout, faster.
+ *
+ * Same as \ref linear_to_tile4 but faster, because it passes constant
+ * parameters for common cases, allowing the compiler to inline code
+ * optimized for those cases.
+ *
+ * \copydoc tile_copy_fn
+ */
+static FLATTEN void
+linear_to_tile4_faster(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
+                       uint32_t y0, uint32_t y1,
+                       char *dst, const char *src,
+                       int32_t src_pitch,
+                       uint32_t swizzle_bit,
+                       isl_memcpy_type copy_type)
+{
+   isl_mem_copy_fn mem_copy = choose_copy_function(copy_type);
+
+   if (x0 == 0 && x3 == tile4_width && y0 == 0 && y1 == tile4_height) {
+      if (mem_copy == memcpy)
+         return linear_to_tile4(0, 0, tile4_width, tile4_width, 0, tile4_height,
+                                dst, src, src_pitch, swizzle_bit, memcpy, memcpy);
+      else if (mem_copy == rgba8_copy)
+         return linear_to_tile4(0, 0, tile4_width, tile4_width, 0, tile4_height,
+                                dst, src, src_pitch, swizzle_bit,
+                                rgba8_copy, rgba8_copy_aligned_dst);
+      else
+         unreachable("not reached");
+   } else {
+      if (mem_copy == memcpy)
+         return linear_to_tile4(x0, x1, x2, x3, y0, y1,
+                                dst, src, src_pitch, swizzle_bit, memcpy, memcpy);
+      else if (mem_copy == rgba8_copy)
+         return linear_to_tile4(x0, x1, x2, x3, y0, y1,
+                                dst, src, src_pitch, swizzle_bit,
+                                rgba8_copy, rgba8_copy_aligned_dst);
+      else
+         unreachable("not reached");
+   }
+}
+
 /**
  * Copy texture data from X tile layout to linear, faster.
  *
@@ -816,6 +957,60 @@ ytiled_to_linear_faster(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
                     dst, src, dst_pitch, swizzle_bit, mem_copy, mem_copy);
 }
 
+/**
+ * Copy texture data from Tile4 layout to linear, faster.
+ *
+ * Same as \ref tile4_to_linear but faster, because it passes constant
+ * parameters for common cases, allowing the compiler to inline code
+ * optimized for those cases.
+ *
+ * \copydoc tile_copy_fn
+ */
+static FLATTEN void
+tile4_to_linear_faster(uint32_t x0, uint32_t x1, uint32_t x2, uint32_t x3,
+                       uint32_t y0, uint32_t y1,
+                       char *dst, const char *src,
+                       int32_t dst_pitch,
+                       uint32_t swizzle_bit,
+                       isl_memcpy_type copy_type)
+{
+   isl_mem_copy_fn mem_copy = choose_copy_function(copy_type);
+
+   if (x0 == 0 && x3 == tile4_width && y0 == 0 && y1 == tile4_height) {
+      if (mem_copy == memcpy)
+         return tile4_to_linear(0, 0, tile4_width, tile4_width, 0, tile4_height,
+                                dst, src, dst_pitch, swizzle_bit, memcpy, memcpy);
+      else if (mem_copy == rgba8_copy)
+         return tile4_to_linear(0, 0, tile4_width, tile4_width, 0, tile4_height,
+                                dst, src, dst_pitch, swizzle_bit,
+                                rgba8_copy, rgba8_copy_aligned_src);
+#if defined(INLINE_SSE41)
+      else if (copy_type == ISL_MEMCPY_STREAMING_LOAD)
+         return tile4_to_linear(0, 0, tile4_width, tile4_width, 0, tile4_height,
+                                dst, src, dst_pitch, swizzle_bit,
+                                memcpy, _memcpy_streaming_load);
+#endif
+      else
+         unreachable("not reached");
+   } else {
+      if (mem_copy == memcpy)
+         return tile4_to_linear(x0, x1, x2, x3, y0, y1,
+                                dst, src, dst_pitch, swizzle_bit, memcpy, memcpy);
+      else if (mem_copy == rgba8_copy)
+         return tile4_to_linear(x0, x1, x2, x3, y0, y1,
+                                dst, src, dst_pitch, swizzle_bit,
+                                rgba8_copy, rgba8_copy_aligned_src);
+#if defined(INLINE_SSE41)
+      else if (copy_type == ISL_MEMCPY_STREAMING_LOAD)
+         return tile4_to_linear(x0, x1, x2, x3, y0, y1,
+                                dst, src, dst_pitch, swizzle_bit,
+                                memcpy, _memcpy_streaming_load);
+#endif
+      else
+         unreachable("not reached");
+   }
+}
+
 /**
  * Copy from linear to tiled texture.
  *
@@ -853,6 +1048,11 @@ linear_to_tiled(uint32_t xt1, uint32_t xt2,
       th = ytile_height;
       span = ytile_span;
       tile_copy = linear_to_ytiled_faster;
+   } else if (tiling == ISL_TILING_4) {
+      tw = tile4_width;
+      th = tile4_height;
+      span = tile4_span;
+      tile_copy = linear_to_tile4_faster;
    } else {
       unreachable("unsupported tiling");
    }
@@ -944,6 +1144,11 @@ tiled_to_linear(uint32_t xt1, uint32_t xt2,
       th = ytile_height;
       span = ytile_span;
       tile_copy = ytiled_to_linear_faster;
+   } else if (tiling == ISL_TILING_4) {
+      tw = tile4_width;
+      th = tile4_height;
+      span = tile4_span;
+      tile_copy = tile4_to_linear_faster;
    } else {
       unreachable("unsupported tiling");
    }
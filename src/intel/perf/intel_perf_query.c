@@ -1274,6 +1274,13 @@ accumulate_oa_reports(struct intel_perf_context *perf_ctx,
    bool last_report_ctx_match = true;
    int out_duration = 0;
 
+   /* Largest timestamp delta (in GPU ticks) that scales to at most 5
+    * seconds, so that the checks on every periodic report below don't need
+    * intel_device_info_timebase_scale() and its divisions.
+    */
+   const uint64_t max_delta_ticks =
+      ((5000000000ull + 1) * devinfo->timestamp_frequency - 1) / 1000000000ull;
+
    assert(query->oa.map != NULL);
 
    start = last = query->oa.map;
@@ -1331,18 +1338,14 @@ accumulate_oa_reports(struct intel_perf_context *perf_ctx,
             /* Ignore reports that come before the start marker.
              * (Note: takes care to allow overflow of 32bit timestamps)
              */
-            if (intel_device_info_timebase_scale(devinfo,
-                                               report[1] - start[1]) > 5000000000) {
+            if ((uint32_t)(report[1] - start[1]) > max_delta_ticks)
                continue;
-            }
 
             /* Ignore reports that come after the end marker.
              * (Note: takes care to allow overflow of 32bit timestamps)
              */
-            if (intel_device_info_timebase_scale(devinfo,
-                                               report[1] - end[1]) <= 5000000000) {
+            if ((uint32_t)(report[1] - end[1]) <= max_delta_ticks)
                goto end;
-            }
 
             /* For Gfx8+ since the counters continue while other
              * contexts are running we need to discount any unrelated
@@ -441,6 +441,14 @@ anv_block_pool_expand_range(struct anv_block_pool *pool, uint32_t size)
    if (result != VK_SUCCESS)
       return result;
 
+   /* Only publishing the new BO needs the device mutex: queue submission
+    * walks the pool's BO list under it.  The allocation itself is
+    * serialized by the block pool state protocol, so doing it outside the
+    * lock keeps a growing pool from stalling every submit and every other
+    * pool that needs the mutex.
+    */
+   pthread_mutex_lock(&pool->device->mutex);
+
    pool->bos[pool->nbos++] = new_bo;
 
    /* This pointer will always point to the first BO in the list */
@@ -449,6 +457,8 @@ anv_block_pool_expand_range(struct anv_block_pool *pool, uint32_t size)
    assert(pool->nbos < ANV_MAX_BLOCK_POOL_BOS);
    pool->size = size;
 
+   pthread_mutex_unlock(&pool->device->mutex);
+
    return VK_SUCCESS;
 }
 
@@ -503,8 +513,6 @@ anv_block_pool_grow(struct anv_block_pool *pool, struct anv_block_state *state,
 {
    VkResult result = VK_SUCCESS;
 
-   pthread_mutex_lock(&pool->device->mutex);
-
    assert(state == &pool->state);
 
    /* Gather a little usage information on the pool.  Since we may have
@@ -548,8 +556,6 @@ anv_block_pool_grow(struct anv_block_pool *pool, struct anv_block_state *state,
       result = anv_block_pool_expand_range(pool, size);
    }
 
-   pthread_mutex_unlock(&pool->device->mutex);
-
    if (result != VK_SUCCESS)
       return 0;
 
@@ -1339,6 +1339,9 @@ anv_physical_device_try_create(struct vk_instance *vk_instance,
    device->use_call_secondary =
       !debug_get_bool_option("ANV_DISABLE_SECONDARY_CMD_BUFFER_CALLS", false);
 
+   device->fast_gpl_libs =
+      debug_get_bool_option("ANV_FAST_GPL_LIBS", false);
+
    device->has_implicit_ccs = device->info.has_aux_map ||
                               device->info.verx10 >= 125;
 
@@ -709,6 +709,18 @@ anv_graphics_pipeline_stage_fragment_dynamic(const struct anv_pipeline_stage *st
           stage->key.wm.alpha_to_coverage == BRW_SOMETIMES;
 }
 
+/* Fragment shaders of retained GPL libraries skip SIMD32 with
+ * ANV_FAST_GPL_LIBS, the link-time optimized pipeline compiles it.
+ */
+static bool
+anv_pipeline_skip_fs_simd32(const struct anv_graphics_base_pipeline *pipeline)
+{
+   return pipeline->base.device->physical->fast_gpl_libs &&
+          pipeline->base.type == ANV_PIPELINE_GRAPHICS_LIB &&
+          (pipeline->base.flags &
+           VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT);
+}
+
 static void
 anv_pipeline_hash_common(struct mesa_sha1 *ctx,
                          const struct anv_pipeline *pipeline)
@@ -751,6 +763,11 @@ anv_pipeline_hash_graphics(struct anv_graphics_base_pipeline *pipeline,
       _mesa_sha1_update(&ctx, &afs, sizeof(afs));
    }
 
+   if (pipeline->base.active_stages & VK_SHADER_STAGE_FRAGMENT_BIT) {
+      const bool skip_simd32 = anv_pipeline_skip_fs_simd32(pipeline);
+      _mesa_sha1_update(&ctx, &skip_simd32, sizeof(skip_simd32));
+   }
+
    _mesa_sha1_final(&ctx, sha1_out);
 }
 
@@ -1470,6 +1487,7 @@ anv_pipeline_compile_fs(const struct brw_compiler *compiler,
       .prog_data = &fs_stage->prog_data.wm,
 
       .allow_spilling = true,
+      .skip_simd32 = anv_pipeline_skip_fs_simd32(pipeline),
       .stats = fs_stage->stats,
       .log_data = device,
    };
@@ -887,6 +887,12 @@ struct anv_physical_device {
     bool                                        always_use_bindless;
     bool                                        use_call_secondary;
 
+    /** Compile GPL libraries that retain link time optimization info with
+     *  a reduced set of dispatch widths, as they are expected to be replaced
+     *  by a link optimized pipeline.
+     */
+    bool                                        fast_gpl_libs;
+
     /** True if we can use timeline semaphores through execbuf */
     bool                                        has_exec_timeline;
 
@@ -1061,6 +1067,9 @@ struct anv_queue {
       uint32_t                               engine_id; /* Xe */
    };
 
+   /** Number of BOs in the last execbuf, used to size the next one (i915) */
+   uint32_t                                  last_exec_bo_count;
+
    /** Synchronization object for debug purposes (DEBUG_SYNC) */
    struct vk_sync                           *sync;
 
@@ -1588,6 +1597,28 @@ _anv_combine_address(struct anv_batch *batch, void *location,
       VG(VALGRIND_CHECK_MEM_IS_DEFINED(dw, ARRAY_SIZE(dwords0) * 4));\
    } while (0)
 
+/* Same as anv_batch_emit_merge() but skips the packet if it is identical to
+ * the last one recorded in shadow, and records it in shadow otherwise.
+ */
+#define anv_batch_emit_merge_if_changed(batch, shadow, dwords0, dwords1) \
+   do {                                                                 \
+      uint32_t merged[ARRAY_SIZE(dwords0)];                             \
+      uint32_t *dw;                                                     \
+                                                                        \
+      STATIC_ASSERT(ARRAY_SIZE(dwords0) == ARRAY_SIZE(dwords1));        \
+      STATIC_ASSERT(ARRAY_SIZE(dwords0) == ARRAY_SIZE(shadow));         \
+      for (uint32_t i = 0; i < ARRAY_SIZE(dwords0); i++)                \
+         merged[i] = (dwords0)[i] | (dwords1)[i];                       \
+      if (memcmp(merged, (shadow), sizeof(merged)) == 0)                \
+         break;                                                         \
+      dw = anv_batch_emit_dwords((batch), ARRAY_SIZE(dwords0));         \
+      if (!dw)                                                          \
+         break;                                                         \
+      memcpy(dw, merged, sizeof(merged));                               \
+      memcpy((shadow), merged, sizeof(merged));                         \
+      VG(VALGRIND_CHECK_MEM_IS_DEFINED(dw, ARRAY_SIZE(dwords0) * 4));\
+   } while (0)
+
 #define anv_batch_emit(batch, cmd, name)                            \
    for (struct cmd name = { __anv_cmd_header(cmd) },                    \
         *_dst = anv_batch_emit_dwords(batch, __anv_cmd_length(cmd));    \
@@ -2815,6 +2846,20 @@ struct anv_cmd_graphics_state {
    struct vk_vertex_input_state vertex_input;
    struct vk_sample_locations_state sample_locations;
 
+   /**
+    * Last packed value of the packets emitted by
+    * genX(cmd_buffer_flush_dynamic_state), used to skip emitting identical
+    * packets again. Packet headers are never 0, so a zeroed entry never
+    * matches. Entries must be zeroed with anv_cmd_buffer_invalidate_emitted()
+    * whenever something else programs these packets.
+    */
+   struct {
+      uint32_t sf[4];
+      uint32_t raster[5];
+      uint32_t wm[2];
+      uint32_t wm_ds[4];
+   } emitted;
+
    bool object_preemption;
    bool has_uint_rt;
 
@@ -3236,6 +3281,16 @@ anv_cmd_buffer_get_view_count(struct anv_cmd_buffer *cmd_buffer)
    return MAX2(1, util_bitcount(gfx->view_mask));
 }
 
+/* Forget the packets recorded in anv_cmd_graphics_state::emitted, for when
+ * the hardware state was programmed behind the dynamic state tracking.
+ */
+static inline void
+anv_cmd_buffer_invalidate_emitted(struct anv_cmd_buffer *cmd_buffer)
+{
+   memset(&cmd_buffer->state.gfx.emitted, 0,
+          sizeof(cmd_buffer->state.gfx.emitted));
+}
+
 enum anv_bo_sync_state {
    /** Indicates that this is a new (or newly reset fence) */
    ANV_BO_SYNC_STATE_RESET,
@@ -229,6 +229,21 @@ anv_device_utrace_flush_cmd_buffers(struct anv_queue *queue,
    return result;
 }
 
+static void
+anv_utrace_clear_ts_buffer(struct u_trace_context *utctx, void *timestamps)
+{
+   struct anv_device *device =
+      container_of(utctx, struct anv_device, ds.trace_context);
+   struct anv_bo *bo = timestamps;
+
+   /* anv_utrace_read_ts() relies on unwritten timestamps being 0 */
+   memset(bo->map, 0, bo->size);
+#ifdef SUPPORT_INTEL_INTEGRATED_GPUS
+   if (device->physical->memory.need_clflush)
+         intel_clflush_range(bo->map, bo->size);
+#endif
+}
+
 static void *
 anv_utrace_create_ts_buffer(struct u_trace_context *utctx, uint32_t size_b)
 {
@@ -245,11 +260,7 @@ anv_utrace_create_ts_buffer(struct u_trace_context *utctx, uint32_t size_b)
                         &bo);
    assert(result == VK_SUCCESS);
 
-   memset(bo->map, 0, bo->size);
-#ifdef SUPPORT_INTEL_INTEGRATED_GPUS
-   if (device->physical->memory.need_clflush)
-         intel_clflush_range(bo->map, bo->size);
-#endif
+   anv_utrace_clear_ts_buffer(utctx, bo);
 
    return bo;
 }
@@ -357,6 +368,7 @@ anv_device_utrace_init(struct anv_device *device)
                         anv_utrace_record_ts,
                         anv_utrace_read_ts,
                         anv_utrace_delete_submit);
+   device->ds.trace_context.clear_timestamp_buffer = anv_utrace_clear_ts_buffer;
 
    for (uint32_t q = 0; q < device->queue_count; q++) {
       struct anv_queue *queue = &device->queues[q];
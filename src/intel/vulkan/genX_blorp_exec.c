@@ -355,6 +355,7 @@ blorp_exec_on_render(struct blorp_batch *batch,
    cmd_buffer->state.gfx.dirty |= dirty;
    BITSET_OR(cmd_buffer->vk.dynamic_graphics_state.dirty,
              cmd_buffer->vk.dynamic_graphics_state.dirty, dyn_dirty);
+   anv_cmd_buffer_invalidate_emitted(cmd_buffer);
    cmd_buffer->state.push_constants_dirty |= VK_SHADER_STAGE_ALL_GRAPHICS;
 }
 
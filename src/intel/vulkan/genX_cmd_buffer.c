@@ -4060,6 +4060,7 @@ genX(CmdExecuteCommands)(
    primary->state.gfx.push_constant_stages = 0;
    primary->state.compute.cfe_state_valid = false;
    vk_dynamic_graphics_state_dirty_all(&primary->vk.dynamic_graphics_state);
+   anv_cmd_buffer_invalidate_emitted(primary);
 
    /* Each of the secondary command buffers will use its own state base
     * address.  We need to re-emit state base address for the primary after
@@ -497,7 +497,9 @@ genX(cmd_buffer_flush_dynamic_state)(struct anv_cmd_buffer *cmd_buffer)
          dyn->rs.depth_bias.representation == VK_DEPTH_BIAS_REPRESENTATION_FLOAT_EXT;
 
       GENX(3DSTATE_SF_pack)(NULL, sf_dw, &sf);
-      anv_batch_emit_merge(&cmd_buffer->batch, sf_dw, pipeline->gfx8.sf);
+      anv_batch_emit_merge_if_changed(&cmd_buffer->batch,
+                                      cmd_buffer->state.gfx.emitted.sf,
+                                      sf_dw, pipeline->gfx8.sf);
    }
 
    if ((cmd_buffer->state.gfx.dirty & ANV_CMD_DIRTY_PIPELINE) ||
@@ -570,8 +572,9 @@ genX(cmd_buffer_flush_dynamic_state)(struct anv_cmd_buffer *cmd_buffer)
          .ViewportZNearClipTestEnable = depth_clip_enable,
       };
       GENX(3DSTATE_RASTER_pack)(NULL, raster_dw, &raster);
-      anv_batch_emit_merge(&cmd_buffer->batch, raster_dw,
-                           pipeline->gfx8.raster);
+      anv_batch_emit_merge_if_changed(&cmd_buffer->batch,
+                                      cmd_buffer->state.gfx.emitted.raster,
+                                      raster_dw, pipeline->gfx8.raster);
    }
 
    /* Stencil reference values moved from COLOR_CALC_STATE in gfx8 to
@@ -621,31 +624,46 @@ genX(cmd_buffer_flush_dynamic_state)(struct anv_cmd_buffer *cmd_buffer)
       struct vk_depth_stencil_state opt_ds = dyn->ds;
       vk_optimize_depth_stencil_state(&opt_ds, ds_aspects, true);
 
-      anv_batch_emit(&cmd_buffer->batch, GENX(3DSTATE_WM_DEPTH_STENCIL), ds) {
-         ds.DoubleSidedStencilEnable = true;
-
-         ds.StencilTestMask = opt_ds.stencil.front.compare_mask & 0xff;
-         ds.StencilWriteMask = opt_ds.stencil.front.write_mask & 0xff;
-
-         ds.BackfaceStencilTestMask = opt_ds.stencil.back.compare_mask & 0xff;
-         ds.BackfaceStencilWriteMask = opt_ds.stencil.back.write_mask & 0xff;
-
-         ds.StencilReferenceValue = opt_ds.stencil.front.reference & 0xff;
-         ds.BackfaceStencilReferenceValue = opt_ds.stencil.back.reference & 0xff;
-
-         ds.DepthTestEnable = opt_ds.depth.test_enable;
-         ds.DepthBufferWriteEnable = opt_ds.depth.write_enable;
-         ds.DepthTestFunction = genX(vk_to_intel_compare_op)[opt_ds.depth.compare_op];
-         ds.StencilTestEnable = opt_ds.stencil.test_enable;
-         ds.StencilBufferWriteEnable = opt_ds.stencil.write_enable;
-         ds.StencilFailOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.front.op.fail];
-         ds.StencilPassDepthPassOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.front.op.pass];
-         ds.StencilPassDepthFailOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.front.op.depth_fail];
-         ds.StencilTestFunction = genX(vk_to_intel_compare_op)[opt_ds.stencil.front.op.compare];
-         ds.BackfaceStencilFailOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.back.op.fail];
-         ds.BackfaceStencilPassDepthPassOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.back.op.pass];
-         ds.BackfaceStencilPassDepthFailOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.back.op.depth_fail];
-         ds.BackfaceStencilTestFunction = genX(vk_to_intel_compare_op)[opt_ds.stencil.back.op.compare];
+      struct GENX(3DSTATE_WM_DEPTH_STENCIL) ds = {
+         GENX(3DSTATE_WM_DEPTH_STENCIL_header),
+         .DoubleSidedStencilEnable = true,
+      };
+
+      ds.StencilTestMask = opt_ds.stencil.front.compare_mask & 0xff;
+      ds.StencilWriteMask = opt_ds.stencil.front.write_mask & 0xff;
+
+      ds.BackfaceStencilTestMask = opt_ds.stencil.back.compare_mask & 0xff;
+      ds.BackfaceStencilWriteMask = opt_ds.stencil.back.write_mask & 0xff;
+
+      ds.StencilReferenceValue = opt_ds.stencil.front.reference & 0xff;
+      ds.BackfaceStencilReferenceValue = opt_ds.stencil.back.reference & 0xff;
+
+      ds.DepthTestEnable = opt_ds.depth.test_enable;
+      ds.DepthBufferWriteEnable = opt_ds.depth.write_enable;
+      ds.DepthTestFunction = genX(vk_to_intel_compare_op)[opt_ds.depth.compare_op];
+      ds.StencilTestEnable = opt_ds.stencil.test_enable;
+      ds.StencilBufferWriteEnable = opt_ds.stencil.write_enable;
+      ds.StencilFailOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.front.op.fail];
+      ds.StencilPassDepthPassOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.front.op.pass];
+      ds.StencilPassDepthFailOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.front.op.depth_fail];
+      ds.StencilTestFunction = genX(vk_to_intel_compare_op)[opt_ds.stencil.front.op.compare];
+      ds.BackfaceStencilFailOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.back.op.fail];
+      ds.BackfaceStencilPassDepthPassOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.back.op.pass];
+      ds.BackfaceStencilPassDepthFailOp = genX(vk_to_intel_stencil_op)[opt_ds.stencil.back.op.depth_fail];
+      ds.BackfaceStencilTestFunction = genX(vk_to_intel_compare_op)[opt_ds.stencil.back.op.compare];
+
+      uint32_t ds_dw[GENX(3DSTATE_WM_DEPTH_STENCIL_length)];
+      GENX(3DSTATE_WM_DEPTH_STENCIL_pack)(NULL, ds_dw, &ds);
+
+      if (memcmp(ds_dw, cmd_buffer->state.gfx.emitted.wm_ds,
+                 sizeof(ds_dw)) != 0) {
+         uint32_t *dw = anv_batch_emit_dwords(&cmd_buffer->batch,
+                                              ARRAY_SIZE(ds_dw));
+         if (dw) {
+            memcpy(dw, ds_dw, sizeof(ds_dw));
+            memcpy(cmd_buffer->state.gfx.emitted.wm_ds, ds_dw,
+                   sizeof(ds_dw));
+         }
       }
 
       const bool pma = want_stencil_pma_fix(cmd_buffer, &opt_ds);
@@ -757,7 +775,9 @@ genX(cmd_buffer_flush_dynamic_state)(struct anv_cmd_buffer *cmd_buffer)
       };
       GENX(3DSTATE_WM_pack)(NULL, wm_dwords, &wm);
 
-      anv_batch_emit_merge(&cmd_buffer->batch, wm_dwords, pipeline->gfx8.wm);
+      anv_batch_emit_merge_if_changed(&cmd_buffer->batch,
+                                      cmd_buffer->state.gfx.emitted.wm,
+                                      wm_dwords, pipeline->gfx8.wm);
    }
 
    if ((cmd_buffer->state.gfx.dirty & ANV_CMD_DIRTY_PIPELINE) ||
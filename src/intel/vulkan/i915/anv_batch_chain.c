@@ -88,6 +88,33 @@ anv_execbuf_add_bo_bitset(struct anv_device *device,
                           BITSET_WORD *deps,
                           uint32_t extra_flags);
 
+static VkResult
+anv_execbuf_grow_bos(struct anv_device *device,
+                     struct anv_execbuf *exec,
+                     uint32_t new_len)
+{
+   assert(new_len > exec->bo_array_length);
+
+   struct drm_i915_gem_exec_object2 *new_objects =
+      vk_realloc(exec->alloc, exec->objects,
+                 new_len * sizeof(*new_objects), 8, exec->alloc_scope);
+   if (new_objects == NULL)
+      return vk_error(device, VK_ERROR_OUT_OF_HOST_MEMORY);
+
+   exec->objects = new_objects;
+
+   struct anv_bo **new_bos =
+      vk_realloc(exec->alloc, exec->bos, new_len * sizeof(*new_bos), 8,
+                 exec->alloc_scope);
+   if (new_bos == NULL)
+      return vk_error(device, VK_ERROR_OUT_OF_HOST_MEMORY);
+
+   exec->bos = new_bos;
+   exec->bo_array_length = new_len;
+
+   return VK_SUCCESS;
+}
+
 static VkResult
 anv_execbuf_add_bo(struct anv_device *device,
                    struct anv_execbuf *exec,
@@ -106,24 +133,11 @@ anv_execbuf_add_bo(struct anv_device *device,
        * an id that we can use later.
        */
       if (exec->bo_count >= exec->bo_array_length) {
-         uint32_t new_len = exec->objects ? exec->bo_array_length * 2 : 64;
-
-         struct drm_i915_gem_exec_object2 *new_objects =
-            vk_realloc(exec->alloc, exec->objects,
-                       new_len * sizeof(*new_objects), 8, exec->alloc_scope);
-         if (new_objects == NULL)
-            return vk_error(device, VK_ERROR_OUT_OF_HOST_MEMORY);
-
-         exec->objects = new_objects;
-
-         struct anv_bo **new_bos =
-            vk_realloc(exec->alloc, exec->bos, new_len * sizeof(*new_bos), 8,
-                       exec->alloc_scope);
-         if (new_bos == NULL)
-            return vk_error(device, VK_ERROR_OUT_OF_HOST_MEMORY);
-
-         exec->bos = new_bos;
-         exec->bo_array_length = new_len;
+         VkResult result =
+            anv_execbuf_grow_bos(device, exec,
+                                 exec->objects ? exec->bo_array_length * 2 : 64);
+         if (result != VK_SUCCESS)
+            return result;
       }
 
       assert(exec->bo_count < exec->bo_array_length);
@@ -633,6 +647,17 @@ i915_queue_exec_locked(struct anv_queue *queue,
    if (result != VK_SUCCESS)
       goto error;
 
+   /* With softpin every memory object goes into every execbuf, so the list
+    * is usually about as long as last time.  Size it for that up front
+    * rather than growing it from scratch on each submit.
+    */
+   if (queue->last_exec_bo_count > 64) {
+      const uint32_t len = util_next_power_of_two(queue->last_exec_bo_count);
+      result = anv_execbuf_grow_bos(device, &execbuf, len);
+      if (result != VK_SUCCESS)
+         goto error;
+   }
+
    if (utrace_submit && !utrace_submit->batch_bo) {
       result = anv_execbuf_add_sync(device, &execbuf,
                                     utrace_submit->sync,
@@ -691,6 +716,8 @@ i915_queue_exec_locked(struct anv_queue *queue,
    if (result != VK_SUCCESS)
       goto error;
 
+   queue->last_exec_bo_count = execbuf.bo_count;
+
    const bool has_perf_query =
       perf_query_pool && perf_query_pass >= 0 && cmd_buffer_count;
 
@@ -1718,7 +1718,8 @@ no_shm_fence:
 }
 
 static bool
-dri3_detect_drawable_is_window(struct loader_dri3_drawable *draw)
+dri3_detect_drawable_is_window(struct loader_dri3_drawable *draw,
+                               xcb_get_geometry_cookie_t *geom_cookie)
 {
    /* Try to select for input on the window.
     *
@@ -1735,6 +1736,11 @@ dri3_detect_drawable_is_window(struct loader_dri3_drawable *draw)
                                        XCB_PRESENT_EVENT_MASK_COMPLETE_NOTIFY |
                                        XCB_PRESENT_EVENT_MASK_IDLE_NOTIFY);
 
+   /* Queue the geometry request behind it, so that both are answered by the
+    * round trip below.
+    */
+   *geom_cookie = xcb_get_geometry(draw->conn, draw->drawable);
+
    /* Check to see if our select input call failed. If it failed with a
     * BadWindow error, then assume the drawable is a pixmap.
     */
@@ -1756,13 +1762,20 @@ dri3_detect_drawable_is_window(struct loader_dri3_drawable *draw)
    return true;
 }
 
+/* Also sends the GetGeometry request for the drawable, right after selecting
+ * for present events so that no ConfigureNotify can be missed in between.
+ * The caller owns the returned cookie, even on failure.
+ */
 static bool
-dri3_setup_present_event(struct loader_dri3_drawable *draw)
+dri3_setup_present_event(struct loader_dri3_drawable *draw,
+                         xcb_get_geometry_cookie_t *geom_cookie)
 {
    /* No need to setup for pixmap drawable. */
    if (draw->type == LOADER_DRI3_DRAWABLE_PIXMAP ||
-       draw->type == LOADER_DRI3_DRAWABLE_PBUFFER)
+       draw->type == LOADER_DRI3_DRAWABLE_PBUFFER) {
+      *geom_cookie = xcb_get_geometry(draw->conn, draw->drawable);
       return true;
+   }
 
    draw->eid = xcb_generate_id(draw->conn);
 
@@ -1771,10 +1784,11 @@ dri3_setup_present_event(struct loader_dri3_drawable *draw)
                                XCB_PRESENT_EVENT_MASK_CONFIGURE_NOTIFY |
                                XCB_PRESENT_EVENT_MASK_COMPLETE_NOTIFY |
                                XCB_PRESENT_EVENT_MASK_IDLE_NOTIFY);
+      *geom_cookie = xcb_get_geometry(draw->conn, draw->drawable);
    } else {
       assert(draw->type == LOADER_DRI3_DRAWABLE_UNKNOWN);
 
-      if (!dri3_detect_drawable_is_window(draw))
+      if (!dri3_detect_drawable_is_window(draw, geom_cookie))
          return false;
 
       if (draw->type != LOADER_DRI3_DRAWABLE_WINDOW)
@@ -1808,13 +1822,12 @@ dri3_update_drawable(struct loader_dri3_drawable *draw)
 
       draw->first_init = false;
 
-      if (!dri3_setup_present_event(draw)) {
+      if (!dri3_setup_present_event(draw, &geom_cookie)) {
+         xcb_discard_reply(draw->conn, geom_cookie.sequence);
          mtx_unlock(&draw->mtx);
          return false;
       }
 
-      geom_cookie = xcb_get_geometry(draw->conn, draw->drawable);
-
       geom_reply = xcb_get_geometry_reply(draw->conn, geom_cookie, NULL);
 
       if (!geom_reply) {
@@ -36,7 +36,10 @@
 #include "main/glthread.h"
 #include "main/glthread_marshal.h"
 #include "main/hash.h"
+#include "util/log.h"
+#include "util/perf/cpu_trace.h"
 #include "util/u_atomic.h"
+#include "util/u_debug.h"
 #include "util/u_thread.h"
 #include "util/u_cpu_detect.h"
 
@@ -221,6 +224,8 @@ _mesa_glthread_init(struct gl_context *ctx)
    glthread->next_batch = &glthread->batches[glthread->next];
    glthread->used = 0;
    glthread->stats.queue = &glthread->queue;
+   glthread->print_syncs = debug_get_bool_option("MESA_GLTHREAD_PRINT_SYNCS",
+                                                 false);
 
    glthread->LastDListChangeBatchIndex = -1;
 
@@ -412,10 +417,15 @@ _mesa_glthread_finish(struct gl_context *ctx)
 void
 _mesa_glthread_finish_before(struct gl_context *ctx, const char *func)
 {
-   _mesa_glthread_finish(ctx);
+   /* Name the trace slice after the GL function that forced the sync, so
+    * that frame pacing problems can be traced back to the app call.
+    */
+   MESA_TRACE_SCOPE(func);
 
-   /* Uncomment this if you want to know where glthread syncs. */
-   /*printf("fallback to sync: %s\n", func);*/
+   if (unlikely(ctx->GLThread.print_syncs))
+      mesa_logi("glthread: fallback to sync: %s", func);
+
+   _mesa_glthread_finish(ctx);
 }
 
 void
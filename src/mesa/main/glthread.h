@@ -186,6 +186,9 @@ struct glthread_state
    bool enabled;
    bool inside_begin_end;
 
+   /** Whether to print the GL function that forced a sync (for debugging). */
+   bool print_syncs;
+
    /** Display lists. */
    GLenum16 ListMode; /**< Zero if not inside display list, else list mode. */
    unsigned ListBase;
@@ -505,10 +505,13 @@ _mesa_marshal_BufferSubData_merged(GLuint target_or_name, GLintptr offset,
    /* TODO: Handle offset == 0 && size < buffer_size.
     *       If offset == 0 and size == buffer_size, it's better to discard
     *       the buffer storage, but we don't know the buffer size in glthread.
+    *       That doesn't matter if the data doesn't fit into a batch, because
+    *       the only other option is to sync.
     */
    if (ctx->Const.AllowGLThreadBufferSubDataOpt &&
        ctx->Dispatch.Current != ctx->Dispatch.ContextLost &&
-       data && offset > 0 && size > 0) {
+       data && size > 0 &&
+       (offset > 0 || cmd_size > MARSHAL_MAX_CMD_SIZE)) {
       struct gl_buffer_object *upload_buffer = NULL;
       unsigned upload_offset = 0;
 
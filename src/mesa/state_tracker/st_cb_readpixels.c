@@ -494,6 +494,21 @@ st_ReadPixels(struct gl_context *ctx, GLint x, GLint y,
          return;
    }
 
+   /* Reads from texture attachments into a PBO can use the compute download
+    * path of glGetTexImage, which handles more format/type conversions than
+    * the fragment shader path above and never maps the destination.
+    */
+   if ((st->allow_compute_based_texture_transfer ||
+        st->force_compute_based_texture_transfer) &&
+       pack->BufferObj &&
+       rb->TexImage && rb->TexImage->pt == src && src->nr_samples <= 1 &&
+       _mesa_fb_orientation(ctx->ReadBuffer) == Y_0_BOTTOM &&
+       format != GL_DEPTH_COMPONENT && format != GL_STENCIL_INDEX) {
+      if (st_GetTexSubImage_shader(ctx, x, y, rb->rtt_slice, width, height, 1,
+                                   format, type, pack, pixels, rb->TexImage))
+         return;
+   }
+
    if (needs_integer_signed_unsigned_conversion(ctx, format, type)) {
       goto fallback;
    }
@@ -2719,7 +2719,8 @@ non_blit_transfer:
    if (done)
       return;
    if (st->allow_compute_based_texture_transfer || st->force_compute_based_texture_transfer) {
-      if (st_GetTexSubImage_shader(ctx, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels, texImage))
+      if (st_GetTexSubImage_shader(ctx, xoffset, yoffset, zoffset, width, height, depth, format, type,
+                                   &ctx->Pack, pixels, texImage))
          return;
    }
 cpu_transfer:
@@ -114,7 +114,8 @@ bool
 st_GetTexSubImage_shader(struct gl_context * ctx,
                          GLint xoffset, GLint yoffset, GLint zoffset,
                          GLsizei width, GLsizei height, GLint depth,
-                         GLenum format, GLenum type, void * pixels,
+                         GLenum format, GLenum type,
+                         const struct gl_pixelstore_attrib *pack, void * pixels,
                          struct gl_texture_image *texImage);
 
 enum pipe_format
@@ -1184,7 +1184,7 @@ fail:
 
 static void
 copy_converted_buffer(struct gl_context * ctx,
-                    struct gl_pixelstore_attrib *pack,
+                    const struct gl_pixelstore_attrib *pack,
                     enum pipe_texture_target view_target,
                     struct pipe_resource *dst, enum pipe_format dst_format,
                     GLint xoffset, GLint yoffset, GLint zoffset,
@@ -1241,7 +1241,8 @@ bool
 st_GetTexSubImage_shader(struct gl_context * ctx,
                          GLint xoffset, GLint yoffset, GLint zoffset,
                          GLsizei width, GLsizei height, GLint depth,
-                         GLenum format, GLenum type, void * pixels,
+                         GLenum format, GLenum type,
+                         const struct gl_pixelstore_attrib *pack, void * pixels,
                          struct gl_texture_image *texImage)
 {
    struct st_context *st = st_context(ctx);
@@ -1261,7 +1262,7 @@ st_GetTexSubImage_shader(struct gl_context * ctx,
    /* See if the texture format already matches the format and type,
     * in which case the memcpy-based fast path will be used. */
    if (_mesa_format_matches_format_and_type(texImage->TexFormat, format,
-                                            type, ctx->Pack.SwapBytes, NULL)) {
+                                            type, pack->SwapBytes, NULL)) {
       return false;
    }
    enum swizzle_clamp swizzle_clamp = 0;
@@ -1318,14 +1319,14 @@ st_GetTexSubImage_shader(struct gl_context * ctx,
        (!util_format_is_float(src_format) && dst_format == PIPE_FORMAT_L32_FLOAT))
       return false;
 
-   dst = download_texture_compute(st, &ctx->Pack, xoffset, yoffset, zoffset, width, height, depth,
+   dst = download_texture_compute(st, pack, xoffset, yoffset, zoffset, width, height, depth,
                                   level, layer, format, type, src_format, view_target, src, dst_format,
                                   swizzle_clamp);
    if (!dst)
       return false;
 
-   if (!can_copy_direct(&ctx->Pack) || !ctx->Pack.BufferObj) {
-      copy_converted_buffer(ctx, &ctx->Pack, view_target, dst, dst_format, xoffset, yoffset, zoffset,
+   if (!can_copy_direct(pack) || !pack->BufferObj) {
+      copy_converted_buffer(ctx, pack, view_target, dst, dst_format, xoffset, yoffset, zoffset,
                           width, height, depth, format, type, pixels);
 
       pipe_resource_reference(&dst, NULL);
@@ -28,10 +28,30 @@
 #include "util/u_math.h"
 #include "util/u_memory.h"
 #include "util/rb_tree.h"
+#include "util/hash_table.h"
 
 #include <assert.h>
 #include <stdio.h>
 
+static uint32_t
+hash_scalar_const(const void *key)
+{
+   const struct dxil_const *c = key;
+   uint32_t hash = _mesa_hash_pointer(c->value.type);
+   if (c->undef)
+      return hash ^ 1;
+   return _mesa_hash_data_with_seed(&c->int_value, sizeof(c->int_value), hash);
+}
+
+static bool
+scalar_const_equal(const void *a, const void *b)
+{
+   const struct dxil_const *lhs = a, *rhs = b;
+   return lhs->value.type == rhs->value.type &&
+          lhs->undef == rhs->undef &&
+          (lhs->undef || lhs->int_value == rhs->int_value);
+}
+
 void
 dxil_module_init(struct dxil_module *m, void *ralloc_ctx)
 {
@@ -49,6 +69,8 @@ dxil_module_init(struct dxil_module *m, void *ralloc_ctx)
    list_inithead(&m->attr_set_list);
    list_inithead(&m->gvar_list);
    list_inithead(&m->const_list);
+   m->scalar_consts = _mesa_hash_table_create(ralloc_ctx, hash_scalar_const,
+                                              scalar_const_equal);
    list_inithead(&m->mdnode_list);
    list_inithead(&m->md_named_node_list);
 
@@ -340,7 +362,7 @@ create_type(struct dxil_module *m, enum type_type type)
                                         sizeof(struct dxil_type));
    if (ret) {
       ret->type = type;
-      ret->id = list_length(&m->type_list);
+      ret->id = m->num_types++;
       list_addtail(&ret->head, &m->type_list);
    }
    return ret;
@@ -1577,7 +1599,7 @@ emit_type_table(struct dxil_module *m)
 {
    if (!enter_subblock(m, DXIL_TYPE_BLOCK, 4) ||
        !emit_type_table_abbrevs(m) ||
-       !emit_record_int(m, 1, 1 + list_length(&m->type_list)))
+       !emit_record_int(m, 1, 1 + m->num_types))
       return false;
 
    list_for_each_entry(struct dxil_type, type, &m->type_list, head) {
@@ -1603,29 +1625,41 @@ create_const(struct dxil_module *m, const struct dxil_type *type, bool undef)
    return ret;
 }
 
+/* Scalar constants and undefs make up the bulk of the constant table, so
+ * they are deduplicated through a hash table keyed on the type and the raw
+ * 64-bit payload instead of walking const_list.
+ */
 static const struct dxil_value *
-get_int_const(struct dxil_module *m, const struct dxil_type *type,
-              intmax_t value)
+get_scalar_const(struct dxil_module *m, const struct dxil_const *key)
 {
-   assert(type && type->type == TYPE_INTEGER);
-
-   struct dxil_const *c;
-   LIST_FOR_EACH_ENTRY(c, &m->const_list, head) {
-      if (c->value.type != type || c->undef)
-         continue;
-
-      if (c->int_value == value)
-         return &c->value;
-   }
+   uint32_t hash = hash_scalar_const(key);
+   struct hash_entry *entry =
+      _mesa_hash_table_search_pre_hashed(m->scalar_consts, hash, key);
+   if (entry)
+      return &((struct dxil_const *)entry->key)->value;
 
-   c = create_const(m, type, false);
+   struct dxil_const *c = create_const(m, key->value.type, key->undef);
    if (!c)
       return NULL;
 
-   c->int_value = value;
+   c->int_value = key->int_value;
+   _mesa_hash_table_insert_pre_hashed(m->scalar_consts, hash, c, c);
    return &c->value;
 }
 
+static const struct dxil_value *
+get_int_const(struct dxil_module *m, const struct dxil_type *type,
+              intmax_t value)
+{
+   assert(type && type->type == TYPE_INTEGER);
+
+   struct dxil_const key = {
+      .value.type = type,
+      .int_value = value,
+   };
+   return get_scalar_const(m, &key);
+}
+
 static intmax_t
 get_int_from_const_value(const struct dxil_value *value)
 {
@@ -1721,21 +1755,11 @@ dxil_module_get_float16_const(struct dxil_module *m, uint16_t value)
    if (!type)
       return NULL;
 
-   struct dxil_const *c;
-   LIST_FOR_EACH_ENTRY(c, &m->const_list, head) {
-      if (c->value.type != type || c->undef)
-         continue;
-
-      if (c->int_value == (uintmax_t)value)
-         return &c->value;
-   }
-
-   c = create_const(m, type, false);
-   if (!c)
-      return NULL;
-
-   c->int_value = (uintmax_t)value;
-   return &c->value;
+   struct dxil_const key = {
+      .value.type = type,
+      .int_value = (uintmax_t)value,
+   };
+   return get_scalar_const(m, &key);
 }
 
 const struct dxil_value *
@@ -1745,21 +1769,11 @@ dxil_module_get_float_const(struct dxil_module *m, float value)
    if (!type)
       return NULL;
 
-   struct dxil_const *c;
-   LIST_FOR_EACH_ENTRY(c, &m->const_list, head) {
-      if (c->value.type != type || c->undef)
-         continue;
-
-      if (c->float_value == value)
-         return &c->value;
-   }
-
-   c = create_const(m, type, false);
-   if (!c)
-      return NULL;
-
-   c->float_value = value;
-   return &c->value;
+   struct dxil_const key = {
+      .value.type = type,
+      .float_value = value,
+   };
+   return get_scalar_const(m, &key);
 }
 
 const struct dxil_value *
@@ -1769,21 +1783,11 @@ dxil_module_get_double_const(struct dxil_module *m, double value)
    if (!type)
       return NULL;
 
-   struct dxil_const *c;
-   LIST_FOR_EACH_ENTRY(c, &m->const_list, head) {
-      if (c->value.type != type || c->undef)
-         continue;
-
-      if (c->float_value == value)
-         return &c->value;
-   }
-
-   c = create_const(m, type, false);
-   if (!c)
-      return NULL;
-
-   c->float_value = value;
-   return &c->value;
+   struct dxil_const key = {
+      .value.type = type,
+      .float_value = value,
+   };
+   return get_scalar_const(m, &key);
 }
 
 const struct dxil_value *
@@ -1845,17 +1849,11 @@ dxil_module_get_undef(struct dxil_module *m, const struct dxil_type *type)
 {
    assert(type != NULL);
 
-   struct dxil_const *c;
-   LIST_FOR_EACH_ENTRY(c, &m->const_list, head) {
-      if (c->value.type != type)
-         continue;
-
-      if (c->undef)
-         return &c->value;
-   }
-
-   c = create_const(m, type, true);
-   return c ? &c->value : NULL;
+   struct dxil_const key = {
+      .value.type = type,
+      .undef = true,
+   };
+   return get_scalar_const(m, &key);
 }
 
 const struct dxil_value *
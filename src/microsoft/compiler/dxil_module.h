@@ -249,11 +249,13 @@ struct dxil_module {
    size_t num_blocks;
 
    struct list_head type_list;
+   unsigned num_types;
    struct list_head gvar_list;
    struct list_head func_list;
    struct list_head func_def_list;
    struct list_head attr_set_list;
    struct list_head const_list;
+   struct hash_table *scalar_consts;
    struct list_head mdnode_list;
    struct list_head md_named_node_list;
    const struct dxil_type *void_type;
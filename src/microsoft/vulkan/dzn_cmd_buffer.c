@@ -3194,6 +3194,14 @@ dzn_cmd_buffer_update_heaps(struct dzn_cmd_buffer *cmdbuf, uint32_t bindpoint)
          new_heap_offsets[type] = dst_heap_offset;
          update_root_desc_table[type] = true;
 
+         /* Copy the descriptors of all bound sets with a single CopyDescriptors()
+          * call instead of one CopyDescriptorsSimple() per set. The set ranges
+          * don't overlap in the destination heap, so this is equivalent.
+          */
+         D3D12_CPU_DESCRIPTOR_HANDLE dst_starts[MAX_SETS], src_starts[MAX_SETS];
+         UINT range_sizes[MAX_SETS];
+         UINT range_count = 0;
+
          for (uint32_t s = 0; s < MAX_SETS; s++) {
             const struct dzn_descriptor_set *set = desc_state->sets[s].set;
             if (!set) continue;
@@ -3201,10 +3209,27 @@ dzn_cmd_buffer_update_heaps(struct dzn_cmd_buffer *cmdbuf, uint32_t bindpoint)
             uint32_t set_heap_offset = pipeline->sets[s].heap_offsets[type];
             uint32_t set_desc_count = MIN2(pipeline->sets[s].range_desc_count[type], set->heap_sizes[type]);
             if (set_desc_count) {
-               dzn_descriptor_heap_copy(device, dst_heap, dst_heap_offset + set_heap_offset,
-                                        &set->pool->heaps[type], set->heap_offsets[type],
-                                        set_desc_count, type);
+               dst_starts[range_count] =
+                  dzn_descriptor_heap_get_cpu_handle(dst_heap, dst_heap_offset + set_heap_offset);
+               src_starts[range_count] =
+                  dzn_descriptor_heap_get_cpu_handle(&set->pool->heaps[type], set->heap_offsets[type]);
+               range_sizes[range_count] = set_desc_count;
+               range_count++;
             }
+         }
+
+         if (range_count) {
+            ID3D12Device1_CopyDescriptors(device->dev,
+                                          range_count, dst_starts, range_sizes,
+                                          range_count, src_starts, range_sizes,
+                                          type);
+         }
+
+         for (uint32_t s = 0; s < MAX_SETS; s++) {
+            const struct dzn_descriptor_set *set = desc_state->sets[s].set;
+            if (!set) continue;
+
+            uint32_t set_heap_offset = pipeline->sets[s].heap_offsets[type];
 
             if (type == D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV) {
                uint32_t dynamic_buffer_count = pipeline->sets[s].dynamic_buffer_count;
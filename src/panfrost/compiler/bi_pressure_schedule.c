@@ -42,6 +42,9 @@ struct sched_node {
 
    /* Instruction this node represents */
    bi_instr *instr;
+
+   /* Position of the instruction in the original block */
+   unsigned index;
 };
 
 static void
@@ -54,7 +57,8 @@ add_dep(struct sched_node *a, struct sched_node *b)
 static struct dag *
 create_dag(bi_context *ctx, bi_block *block, void *memctx)
 {
-   struct dag *dag = dag_create(ctx);
+   struct dag *dag = dag_create(memctx);
+   unsigned index = 0;
 
    struct sched_node **last_write =
       calloc(ctx->ssa_alloc, sizeof(struct sched_node *));
@@ -76,6 +80,7 @@ create_dag(bi_context *ctx, bi_block *block, void *memctx)
 
       struct sched_node *node = rzalloc(memctx, struct sched_node);
       node->instr = I;
+      node->index = index++;
       dag_init_node(dag, &node->dag);
 
       /* Reads depend on writes, no other hazards in SSA */
@@ -211,6 +216,9 @@ calculate_pressure_delta(bi_instr *I, BITSET_WORD *live)
 /*
  * Choose the next instruction, bottom-up. For now we use a simple greedy
  * heuristic: choose the instruction that has the best effect on liveness.
+ * Ties go to the instruction that came last in the original order, so that
+ * instructions are only moved when it actually helps pressure and the
+ * original (latency-friendly) order is otherwise kept.
  */
 static struct sched_node *
 choose_instr(struct sched_ctx *s)
@@ -221,7 +229,8 @@ choose_instr(struct sched_ctx *s)
    list_for_each_entry(struct sched_node, n, &s->dag->heads, dag.link) {
       int32_t delta = calculate_pressure_delta(n->instr, s->live);
 
-      if (delta < min_delta) {
+      if (delta < min_delta ||
+          (delta == min_delta && n->index > best->index)) {
          best = n;
          min_delta = delta;
       }
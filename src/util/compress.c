@@ -35,15 +35,103 @@
 #endif
 
 #ifdef HAVE_ZSTD
+#include <stdlib.h>
 #include "zstd.h"
 #endif
 
 #include "util/compress.h"
+#include "util/simple_mtx.h"
 #include "macros.h"
 
 /* 3 is the recomended level, with 22 as the absolute maximum */
 #define ZSTD_COMPRESSION_LEVEL 3
 
+#ifdef HAVE_ZSTD
+/* Shader cache entries are small, so creating and tearing down a zstd
+ * context (and its workspace) costs about as much as the actual
+ * (de)compression.  Keep a few idle contexts around for reuse; this is
+ * enough for the disk cache queue threads plus the thread doing lookups.
+ */
+#define ZSTD_MAX_IDLE_CTX 8
+
+static simple_mtx_t zstd_ctx_mtx = SIMPLE_MTX_INITIALIZER;
+static ZSTD_CCtx *idle_cctx[ZSTD_MAX_IDLE_CTX];
+static ZSTD_DCtx *idle_dctx[ZSTD_MAX_IDLE_CTX];
+static unsigned num_idle_cctx, num_idle_dctx;
+static bool zstd_atexit_registered;
+
+static void
+zstd_ctx_atexit(void)
+{
+   simple_mtx_lock(&zstd_ctx_mtx);
+   while (num_idle_cctx)
+      ZSTD_freeCCtx(idle_cctx[--num_idle_cctx]);
+   while (num_idle_dctx)
+      ZSTD_freeDCtx(idle_dctx[--num_idle_dctx]);
+   simple_mtx_unlock(&zstd_ctx_mtx);
+}
+
+static ZSTD_CCtx *
+zstd_get_cctx(void)
+{
+   ZSTD_CCtx *cctx = NULL;
+
+   simple_mtx_lock(&zstd_ctx_mtx);
+   if (num_idle_cctx)
+      cctx = idle_cctx[--num_idle_cctx];
+   simple_mtx_unlock(&zstd_ctx_mtx);
+
+   return cctx ? cctx : ZSTD_createCCtx();
+}
+
+static void
+zstd_put_cctx(ZSTD_CCtx *cctx)
+{
+   simple_mtx_lock(&zstd_ctx_mtx);
+   if (num_idle_cctx < ZSTD_MAX_IDLE_CTX) {
+      if (!zstd_atexit_registered) {
+         atexit(zstd_ctx_atexit);
+         zstd_atexit_registered = true;
+      }
+      idle_cctx[num_idle_cctx++] = cctx;
+      cctx = NULL;
+   }
+   simple_mtx_unlock(&zstd_ctx_mtx);
+
+   ZSTD_freeCCtx(cctx);
+}
+
+static ZSTD_DCtx *
+zstd_get_dctx(void)
+{
+   ZSTD_DCtx *dctx = NULL;
+
+   simple_mtx_lock(&zstd_ctx_mtx);
+   if (num_idle_dctx)
+      dctx = idle_dctx[--num_idle_dctx];
+   simple_mtx_unlock(&zstd_ctx_mtx);
+
+   return dctx ? dctx : ZSTD_createDCtx();
+}
+
+static void
+zstd_put_dctx(ZSTD_DCtx *dctx)
+{
+   simple_mtx_lock(&zstd_ctx_mtx);
+   if (num_idle_dctx < ZSTD_MAX_IDLE_CTX) {
+      if (!zstd_atexit_registered) {
+         atexit(zstd_ctx_atexit);
+         zstd_atexit_registered = true;
+      }
+      idle_dctx[num_idle_dctx++] = dctx;
+      dctx = NULL;
+   }
+   simple_mtx_unlock(&zstd_ctx_mtx);
+
+   ZSTD_freeDCtx(dctx);
+}
+#endif
+
 size_t
 util_compress_max_compressed_len(size_t in_data_size)
 {
@@ -75,8 +163,14 @@ util_compress_deflate(const uint8_t *in_data, size_t in_data_size,
                       uint8_t *out_data, size_t out_buff_size)
 {
 #ifdef HAVE_ZSTD
-   size_t ret = ZSTD_compress(out_data, out_buff_size, in_data, in_data_size,
-                              ZSTD_COMPRESSION_LEVEL);
+   ZSTD_CCtx *cctx = zstd_get_cctx();
+   if (!cctx)
+      return 0;
+
+   size_t ret = ZSTD_compressCCtx(cctx, out_data, out_buff_size,
+                                  in_data, in_data_size,
+                                  ZSTD_COMPRESSION_LEVEL);
+   zstd_put_cctx(cctx);
    if (ZSTD_isError(ret))
       return 0;
 
@@ -125,7 +219,13 @@ util_compress_inflate(const uint8_t *in_data, size_t in_data_size,
                       uint8_t *out_data, size_t out_data_size)
 {
 #ifdef HAVE_ZSTD
-   size_t ret = ZSTD_decompress(out_data, out_data_size, in_data, in_data_size);
+   ZSTD_DCtx *dctx = zstd_get_dctx();
+   if (!dctx)
+      return false;
+
+   size_t ret = ZSTD_decompressDCtx(dctx, out_data, out_data_size,
+                                    in_data, in_data_size);
+   zstd_put_dctx(dctx);
    return !ZSTD_isError(ret);
 #elif defined(HAVE_ZLIB)
    z_stream strm;
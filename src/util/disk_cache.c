@@ -42,7 +42,8 @@
 #include "util/u_debug.h"
 #include "util/rand_xor.h"
 #include "util/u_atomic.h"
-#include "util/mesa-sha1.h"
+#include "util/mesa-blake3.h"
+#include "util/os_time.h"
 #include "util/perf/cpu_trace.h"
 #include "util/ralloc.h"
 #include "util/compiler.h"
@@ -62,7 +63,7 @@
  * - There is no strict requirement that cache versions be backwards
  *   compatible but effort should be taken to limit disruption where possible.
  */
-#define CACHE_VERSION 1
+#define CACHE_VERSION 2
 
 #define DRV_KEY_CPY(_dst, _src, _src_size) \
 do {                                       \
@@ -312,9 +313,13 @@ void
 disk_cache_destroy(struct disk_cache *cache)
 {
    if (unlikely(cache && cache->stats.enabled)) {
-      printf("disk shader cache:  hits = %u, misses = %u\n",
+      printf("disk shader cache:  hits = %u, misses = %u, puts = %u, "
+             "read = %" PRIu64 " KiB in %" PRIu64 " ms\n",
              cache->stats.hits,
-             cache->stats.misses);
+             cache->stats.misses,
+             cache->stats.puts,
+             cache->stats.bytes_read / 1024,
+             cache->stats.get_time_ns / 1000000);
    }
 
    if (cache && util_queue_is_initialized(&cache->cache_queue)) {
@@ -559,6 +564,7 @@ disk_cache_put(struct disk_cache *cache, const cache_key key,
       create_put_job(cache, key, (void*)data, size, cache_item_metadata, false);
 
    if (dc_job) {
+      p_atomic_inc(&cache->stats.puts);
       util_queue_fence_init(&dc_job->fence);
       util_queue_add_job(&cache->cache_queue, dc_job, &dc_job->fence,
                          cache_put, destroy_put_job, dc_job->size);
@@ -579,6 +585,7 @@ disk_cache_put_nocopy(struct disk_cache *cache, const cache_key key,
       create_put_job(cache, key, data, size, cache_item_metadata, true);
 
    if (dc_job) {
+      p_atomic_inc(&cache->stats.puts);
       util_queue_fence_init(&dc_job->fence);
       util_queue_add_job(&cache->cache_queue, dc_job, &dc_job->fence,
                          cache_put, destroy_put_job_nocopy, dc_job->size);
@@ -588,10 +595,14 @@ disk_cache_put_nocopy(struct disk_cache *cache, const cache_key key,
 void *
 disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
 {
+   int64_t start = os_time_get_nano();
+   size_t buf_size = 0;
    void *buf = NULL;
 
    if (size)
       *size = 0;
+   else
+      size = &buf_size;
 
    if (cache->foz_ro_cache)
       buf = disk_cache_load_item_foz(cache->foz_ro_cache, key, size);
@@ -610,16 +621,76 @@ disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
       }
    }
 
-   if (unlikely(cache->stats.enabled)) {
-      if (buf)
-         p_atomic_inc(&cache->stats.hits);
-      else
-         p_atomic_inc(&cache->stats.misses);
+   if (buf) {
+      p_atomic_inc(&cache->stats.hits);
+      p_atomic_add(&cache->stats.bytes_read, *size);
+   } else {
+      p_atomic_inc(&cache->stats.misses);
    }
+   p_atomic_add(&cache->stats.get_time_ns, os_time_get_nano() - start);
+
+   MESA_TRACE_COUNTER("disk cache hits", p_atomic_read(&cache->stats.hits));
+   MESA_TRACE_COUNTER("disk cache misses", p_atomic_read(&cache->stats.misses));
+   MESA_TRACE_COUNTER("disk cache read KiB",
+                      p_atomic_read(&cache->stats.bytes_read) / 1024);
+   MESA_TRACE_COUNTER("disk cache get ms",
+                      p_atomic_read(&cache->stats.get_time_ns) / 1000000);
 
    return buf;
 }
 
+struct disk_cache_get_job {
+   struct util_queue_fence fence;
+
+   struct disk_cache *cache;
+   const uint8_t *key;
+   void **data;
+   size_t *size;
+};
+
+static void
+cache_get(void *job, void *gdata, int thread_index)
+{
+   struct disk_cache_get_job *dc_job = (struct disk_cache_get_job *) job;
+
+   *dc_job->data = disk_cache_get(dc_job->cache, dc_job->key, dc_job->size);
+}
+
+void
+disk_cache_get_batch(struct disk_cache *cache, unsigned num_keys,
+                     const cache_key *keys, void **data, size_t *sizes)
+{
+   struct disk_cache_get_job *jobs = NULL;
+
+   /* With a single key there is nothing to overlap, just do it here. */
+   if (num_keys > 1 && util_queue_is_initialized(&cache->cache_queue))
+      jobs = malloc(num_keys * sizeof(*jobs));
+
+   if (!jobs) {
+      for (unsigned i = 0; i < num_keys; i++)
+         data[i] = disk_cache_get(cache, keys[i], sizes ? &sizes[i] : NULL);
+      return;
+   }
+
+   for (unsigned i = 0; i < num_keys; i++) {
+      jobs[i].cache = cache;
+      jobs[i].key = keys[i];
+      jobs[i].data = &data[i];
+      jobs[i].size = sizes ? &sizes[i] : NULL;
+
+      util_queue_fence_init(&jobs[i].fence);
+      util_queue_add_job(&cache->cache_queue, &jobs[i], &jobs[i].fence,
+                         cache_get, NULL, 0);
+   }
+
+   for (unsigned i = 0; i < num_keys; i++) {
+      util_queue_fence_wait(&jobs[i].fence);
+      util_queue_fence_destroy(&jobs[i].fence);
+   }
+
+   free(jobs);
+}
+
 void
 disk_cache_put_key(struct disk_cache *cache, const cache_key key)
 {
@@ -671,13 +742,16 @@ void
 disk_cache_compute_key(struct disk_cache *cache, const void *data, size_t size,
                        cache_key key)
 {
-   struct mesa_sha1 ctx;
+   struct mesa_blake3 ctx;
 
-   _mesa_sha1_init(&ctx);
-   _mesa_sha1_update(&ctx, cache->driver_keys_blob,
-                     cache->driver_keys_blob_size);
-   _mesa_sha1_update(&ctx, data, size);
-   _mesa_sha1_final(&ctx, key);
+   /* BLAKE3 has an extendable output, so ask for exactly CACHE_KEY_SIZE
+    * bytes rather than truncating a full hash.
+    */
+   _mesa_blake3_init(&ctx);
+   _mesa_blake3_update(&ctx, cache->driver_keys_blob,
+                       cache->driver_keys_blob_size);
+   _mesa_blake3_update(&ctx, data, size);
+   blake3_hasher_finalize(&ctx, key, CACHE_KEY_SIZE);
 }
 
 void
@@ -689,4 +763,14 @@ disk_cache_set_callbacks(struct disk_cache *cache, disk_cache_put_cb put,
    disk_cache_init_queue(cache);
 }
 
+void
+disk_cache_get_stats(struct disk_cache *cache, struct disk_cache_stats *stats)
+{
+   stats->hits = p_atomic_read(&cache->stats.hits);
+   stats->misses = p_atomic_read(&cache->stats.misses);
+   stats->puts = p_atomic_read(&cache->stats.puts);
+   stats->bytes_read = p_atomic_read(&cache->stats.bytes_read);
+   stats->get_time_ns = p_atomic_read(&cache->stats.get_time_ns);
+}
+
 #endif /* ENABLE_SHADER_CACHE */
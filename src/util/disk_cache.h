@@ -32,6 +32,7 @@
 #include <assert.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 #include <sys/stat.h>
 #include "util/mesa-sha1.h"
 #include "util/detect_os.h"
@@ -49,6 +50,15 @@ extern "C" {
 
 typedef uint8_t cache_key[CACHE_KEY_SIZE];
 
+/* Running totals for one disk_cache, see disk_cache_get_stats(). */
+struct disk_cache_stats {
+   unsigned hits;
+   unsigned misses;
+   unsigned puts;
+   uint64_t bytes_read;
+   uint64_t get_time_ns;
+};
+
 /* WARNING: 3rd party applications might be reading the cache item metadata.
  * Do not change these values without making the change widely known.
  * Please contact Valve developers and make them aware of this change.
@@ -229,6 +239,19 @@ disk_cache_put_nocopy(struct disk_cache *cache, const cache_key key,
 void *
 disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size);
 
+/**
+ * Retrieve \num_keys items at once, like calling disk_cache_get() for each
+ * of \keys, but reading and decompressing them in parallel on the cache's
+ * thread queue.
+ *
+ * On return, \data[i] is the malloc'ed object for \keys[i] or NULL, and
+ * \sizes[i] (if \sizes is non-NULL) is its size.  This must not be called
+ * from a disk cache queue job.
+ */
+void
+disk_cache_get_batch(struct disk_cache *cache, unsigned num_keys,
+                     const cache_key *keys, void **data, size_t *sizes);
+
 /**
  * Store the name \key within the cache, (without any associated data).
  *
@@ -265,6 +288,15 @@ void
 disk_cache_set_callbacks(struct disk_cache *cache, disk_cache_put_cb put,
                          disk_cache_get_cb get);
 
+/**
+ * Return the number of hits, misses and puts, the number of bytes returned
+ * by disk_cache_get() and the total time spent in it since the cache was
+ * created.  These are always tracked, so this is cheap to poll (e.g. once
+ * per frame).
+ */
+void
+disk_cache_get_stats(struct disk_cache *cache, struct disk_cache_stats *stats);
+
 #else
 
 static inline struct disk_cache *
@@ -304,6 +336,17 @@ disk_cache_get(struct disk_cache *cache, const cache_key key, size_t *size)
    return NULL;
 }
 
+static inline void
+disk_cache_get_batch(struct disk_cache *cache, unsigned num_keys,
+                     const cache_key *keys, void **data, size_t *sizes)
+{
+   for (unsigned i = 0; i < num_keys; i++) {
+      data[i] = NULL;
+      if (sizes)
+         sizes[i] = 0;
+   }
+}
+
 static inline void
 disk_cache_put_key(struct disk_cache *cache, const cache_key key)
 {
@@ -327,6 +370,12 @@ disk_cache_set_callbacks(struct disk_cache *cache, disk_cache_put_cb put,
 {
 }
 
+static inline void
+disk_cache_get_stats(struct disk_cache *cache, struct disk_cache_stats *stats)
+{
+   memset(stats, 0, sizeof(*stats));
+}
+
 #endif /* ENABLE_SHADER_CACHE */
 
 #ifdef __cplusplus
@@ -96,10 +96,14 @@ struct disk_cache {
    /* Don't compress cached data. This is for testing purposes only. */
    bool compression_disabled;
 
+   /* Always updated; only printed on destruction when enabled. */
    struct {
       bool enabled;
       unsigned hits;
       unsigned misses;
+      unsigned puts;
+      uint64_t bytes_read;
+      uint64_t get_time_ns;
    } stats;
 
    /* Internal RO FOZ cache for combined use of RO and RW caches. */
@@ -173,6 +173,105 @@ static void fetch_2d_texel_rgba_dxt5(GLint srcRowStride, const GLubyte *pixdata,
 }
 
 
+/* Decode all 16 texels of a block at once, returning texel (i, j) in
+ * texels[j * 4 + i]. This gives the same results as the per-texel fetch
+ * functions above, but only expands the endpoints once per block.
+ */
+static inline void dxt135_decode_block( const GLubyte *img_block_src,
+                         GLuint dxt_type, GLchan texels[16][4] ) {
+   const GLushort color0 = img_block_src[0] | (img_block_src[1] << 8);
+   const GLushort color1 = img_block_src[2] | (img_block_src[3] << 8);
+   GLuint bits = img_block_src[4] | (img_block_src[5] << 8) |
+      (img_block_src[6] << 16) | ((GLuint)img_block_src[7] << 24);
+   GLchan palette[4][4];
+   GLuint c, k;
+
+   palette[0][RCOMP] = UBYTE_TO_CHAN( EXP5TO8R(color0) );
+   palette[0][GCOMP] = UBYTE_TO_CHAN( EXP6TO8G(color0) );
+   palette[0][BCOMP] = UBYTE_TO_CHAN( EXP5TO8B(color0) );
+   palette[0][ACOMP] = CHAN_MAX;
+   palette[1][RCOMP] = UBYTE_TO_CHAN( EXP5TO8R(color1) );
+   palette[1][GCOMP] = UBYTE_TO_CHAN( EXP6TO8G(color1) );
+   palette[1][BCOMP] = UBYTE_TO_CHAN( EXP5TO8B(color1) );
+   palette[1][ACOMP] = CHAN_MAX;
+
+   if ((dxt_type > 1) || (color0 > color1)) {
+      for (c = 0; c < 3; c++) {
+         palette[2][c] = (palette[0][c] * 2 + palette[1][c]) / 3;
+         palette[3][c] = (palette[0][c] + palette[1][c] * 2) / 3;
+      }
+      palette[2][ACOMP] = CHAN_MAX;
+      palette[3][ACOMP] = CHAN_MAX;
+   }
+   else {
+      for (c = 0; c < 3; c++) {
+         palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+         palette[3][c] = 0;
+      }
+      palette[2][ACOMP] = CHAN_MAX;
+      palette[3][ACOMP] = dxt_type == 1 ? UBYTE_TO_CHAN(0) : CHAN_MAX;
+   }
+
+   for (k = 0; k < 16; k++, bits >>= 2) {
+      const GLchan *color = palette[bits & 3];
+      texels[k][RCOMP] = color[RCOMP];
+      texels[k][GCOMP] = color[GCOMP];
+      texels[k][BCOMP] = color[BCOMP];
+      texels[k][ACOMP] = color[ACOMP];
+   }
+}
+
+static inline void decode_block_rgb_dxt1(const GLubyte *blksrc, GLchan texels[16][4])
+{
+   dxt135_decode_block(blksrc, 0, texels);
+}
+
+static inline void decode_block_rgba_dxt1(const GLubyte *blksrc, GLchan texels[16][4])
+{
+   dxt135_decode_block(blksrc, 1, texels);
+}
+
+static inline void decode_block_rgba_dxt3(const GLubyte *blksrc, GLchan texels[16][4])
+{
+   GLuint k;
+
+   dxt135_decode_block(blksrc + 8, 2, texels);
+   for (k = 0; k < 16; k++) {
+      const GLubyte anibble = (blksrc[k / 2] >> (4 * (k & 1))) & 0xf;
+      texels[k][ACOMP] = UBYTE_TO_CHAN( (GLubyte)(EXP4TO8(anibble)) );
+   }
+}
+
+static inline void decode_block_rgba_dxt5(const GLubyte *blksrc, GLchan texels[16][4])
+{
+   const GLubyte alpha0 = blksrc[0];
+   const GLubyte alpha1 = blksrc[1];
+   /* 16 3-bit codes, packed little-endian in bytes 2..7 */
+   uint64_t codes = 0;
+   GLchan alphas[8];
+   GLuint code, k;
+
+   for (k = 0; k < 6; k++)
+      codes |= (uint64_t)blksrc[2 + k] << (8 * k);
+
+   alphas[0] = UBYTE_TO_CHAN( alpha0 );
+   alphas[1] = UBYTE_TO_CHAN( alpha1 );
+   for (code = 2; code < 8; code++) {
+      if (alpha0 > alpha1)
+         alphas[code] = UBYTE_TO_CHAN( ((alpha0 * (8 - code) + (alpha1 * (code - 1))) / 7) );
+      else if (code < 6)
+         alphas[code] = UBYTE_TO_CHAN( ((alpha0 * (6 - code) + (alpha1 * (code - 1))) / 5) );
+      else if (code == 6)
+         alphas[code] = 0;
+      else
+         alphas[code] = CHAN_MAX;
+   }
+
+   dxt135_decode_block(blksrc + 8, 2, texels);
+   for (k = 0; k < 16; k++, codes >>= 3)
+      texels[k][ACOMP] = alphas[codes & 7];
+}
+
 /* weights used for error function, basically weights (unsquared 2/4/1) according to rgb->luminance conversion
    not sure if this really reflects visual perception */
 #define REDWEIGHT 4
@@ -52,10 +52,84 @@ util_format_b8g8r8a8_unorm_unpack_rgba_8unorm_neon(uint8_t *restrict dst, const
       util_format_b8g8r8a8_unorm_unpack_rgba_8unorm(dst, src, width);
 }
 
+static void
+util_format_b8g8r8x8_unorm_unpack_rgba_8unorm_neon(uint8_t *restrict dst, const uint8_t *restrict src, unsigned width)
+{
+   while (width >= 16) {
+      uint8x16x4_t load = vld4q_u8(src);
+      uint8x16x4_t swap = { .val = { load.val[2], load.val[1], load.val[0], vdupq_n_u8(0xff) } };
+      vst4q_u8(dst, swap);
+      width -= 16;
+      dst += 16 * 4;
+      src += 16 * 4;
+   }
+   if (width)
+      util_format_b8g8r8x8_unorm_unpack_rgba_8unorm(dst, src, width);
+}
+
+/* Converts 8 pixels worth of 8-bit unorm channels to RGBA floats, using the
+ * same x * (1.0f/0xff) conversion as the generated code.
+ */
+static inline void
+unpack_8unorm_rgba_float_neon(float *restrict dst, uint8x8_t r, uint8x8_t g, uint8x8_t b, uint8x8_t a)
+{
+   const float32x4_t scale = vdupq_n_f32(1.0f / 0xff);
+   const uint16x8_t c[4] = { vmovl_u8(r), vmovl_u8(g), vmovl_u8(b), vmovl_u8(a) };
+   float32x4x4_t lo, hi;
+
+   for (unsigned i = 0; i < 4; i++) {
+      lo.val[i] = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(c[i]))), scale);
+      hi.val[i] = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(c[i]))), scale);
+   }
+
+   vst4q_f32(dst, lo);
+   vst4q_f32(dst + 4 * 4, hi);
+}
+
+static void
+util_format_b8g8r8a8_unorm_unpack_rgba_float_neon(void *restrict dst_row, const uint8_t *restrict src, unsigned width)
+{
+   float *dst = dst_row;
+
+   while (width >= 8) {
+      uint8x8x4_t load = vld4_u8(src);
+      unpack_8unorm_rgba_float_neon(dst, load.val[2], load.val[1], load.val[0], load.val[3]);
+      width -= 8;
+      dst += 8 * 4;
+      src += 8 * 4;
+   }
+   if (width)
+      util_format_b8g8r8a8_unorm_unpack_rgba_float(dst, src, width);
+}
+
+static void
+util_format_r8g8b8a8_unorm_unpack_rgba_float_neon(void *restrict dst_row, const uint8_t *restrict src, unsigned width)
+{
+   float *dst = dst_row;
+
+   while (width >= 8) {
+      uint8x8x4_t load = vld4_u8(src);
+      unpack_8unorm_rgba_float_neon(dst, load.val[0], load.val[1], load.val[2], load.val[3]);
+      width -= 8;
+      dst += 8 * 4;
+      src += 8 * 4;
+   }
+   if (width)
+      util_format_r8g8b8a8_unorm_unpack_rgba_float(dst, src, width);
+}
+
 static const struct util_format_unpack_description util_format_unpack_descriptions_neon[] = {
    [PIPE_FORMAT_B8G8R8A8_UNORM] = {
       .unpack_rgba_8unorm = &util_format_b8g8r8a8_unorm_unpack_rgba_8unorm_neon,
-      .unpack_rgba = &util_format_b8g8r8a8_unorm_unpack_rgba_float,
+      .unpack_rgba = &util_format_b8g8r8a8_unorm_unpack_rgba_float_neon,
+   },
+   [PIPE_FORMAT_B8G8R8X8_UNORM] = {
+      .unpack_rgba_8unorm = &util_format_b8g8r8x8_unorm_unpack_rgba_8unorm_neon,
+      .unpack_rgba = &util_format_b8g8r8x8_unorm_unpack_rgba_float,
+   },
+   [PIPE_FORMAT_R8G8B8A8_UNORM] = {
+      .unpack_rgba_8unorm = &util_format_r8g8b8a8_unorm_unpack_rgba_8unorm,
+      .unpack_rgba = &util_format_r8g8b8a8_unorm_unpack_rgba_float_neon,
    },
 };
 
@@ -924,6 +924,28 @@ util_format_z32_float_s8x24_uint_pack_s_8uint(uint8_t *restrict dst_row, unsigne
    }
 }
 
+void
+util_format_z32_float_s8x24_uint_pack_separate(uint8_t *restrict dst_row, unsigned dst_stride,
+                                               const float *z_src_row, unsigned z_src_stride,
+                                               const uint8_t *s_src_row, unsigned s_src_stride,
+                                               unsigned width, unsigned height)
+{
+   unsigned x, y;
+   for (y = 0; y < height; ++y) {
+      const float *z_src = z_src_row;
+      const uint8_t *s_src = s_src_row;
+      float *dst = (float *)dst_row;
+      for (x = 0; x < width; ++x) {
+         dst[0] = *z_src++;
+         ((uint32_t *)dst)[1] = *s_src++;
+         dst += 2;
+      }
+      dst_row += dst_stride / sizeof(*dst_row);
+      z_src_row += z_src_stride / sizeof(*z_src_row);
+      s_src_row += s_src_stride / sizeof(*s_src_row);
+   }
+}
+
 
 void
 util_format_x24s8_uint_unpack_s_8uint(uint8_t *restrict dst_row, unsigned dst_stride, const uint8_t *restrict src_row, unsigned src_stride, unsigned width, unsigned height)
@@ -186,6 +186,32 @@ update_foz_index(struct foz_db *foz_db, FILE *db_idx, unsigned file_idx)
    fseek(db_idx, parsed_offset, SEEK_SET);
 }
 
+/* Write all of data at the given file offset, without going through (or
+ * moving) the FILE position that readers use.  The files are opened for
+ * appending, so on Linux pwrite() ignores the offset and appends; callers
+ * hold the flock and pass the current end of the file, so that's the same.
+ */
+static bool
+write_all_at(int fd, const void *data, size_t size, off_t offset)
+{
+   const char *ptr = data;
+
+   while (size) {
+      ssize_t ret = pwrite(fd, ptr, size, offset);
+      if (ret < 0) {
+         if (errno == EINTR)
+            continue;
+         return false;
+      }
+
+      ptr += ret;
+      size -= ret;
+      offset += ret;
+   }
+
+   return true;
+}
+
 /* exclusive flock with timeout. timeout is in nanoseconds */
 static int lock_file_with_timeout(FILE *f, int64_t timeout)
 {
@@ -676,13 +702,22 @@ foz_write_entry(struct foz_db *foz_db, const uint8_t *cache_key_160bit,
 
    struct foz_db_entry *entry =
       _mesa_hash_table_u64_search(foz_db->index_db, hash);
+
+   /* Everything below only appends to the files while holding the flock, so readers can keep
+    * using the index (and the FILE positions, which we don't touch) in the meantime. */
+   simple_mtx_unlock(&foz_db->mtx);
+
    if (entry) {
-      simple_mtx_unlock(&foz_db->mtx);
       flock(fileno(foz_db->file[0]), LOCK_UN);
       simple_mtx_unlock(&foz_db->flock_mtx);
       return NULL;
    }
 
+   struct stat db_stat, idx_stat;
+   if (fstat(fileno(foz_db->file[0]), &db_stat) == -1 ||
+       fstat(fileno(foz_db->db_idx), &idx_stat) == -1)
+      goto fail_file;
+
    /* Prepare db entry header and blob ready for writing */
    struct foz_payload_header header;
    header.uncompressed_size = blob_size;
@@ -690,64 +725,44 @@ foz_write_entry(struct foz_db *foz_db, const uint8_t *cache_key_160bit,
    header.payload_size = blob_size;
    header.crc = util_hash_crc32(blob, blob_size);
 
-   fseek(foz_db->file[0], 0, SEEK_END);
-
-   /* Write hash header to db */
+   /* Hash header followed by the db entry header, then the db entry blob */
+   char record[FOSSILIZE_BLOB_HASH_LENGTH + sizeof(header) + sizeof(uint64_t)];
    char hash_str[FOSSILIZE_BLOB_HASH_LENGTH + 1]; /* 40 digits + null */
    _mesa_sha1_format(hash_str, cache_key_160bit);
-   if (fwrite(hash_str, 1, FOSSILIZE_BLOB_HASH_LENGTH, foz_db->file[0]) !=
-       FOSSILIZE_BLOB_HASH_LENGTH)
-      goto fail;
+   memcpy(record, hash_str, FOSSILIZE_BLOB_HASH_LENGTH);
+   memcpy(record + FOSSILIZE_BLOB_HASH_LENGTH, &header, sizeof(header));
 
-   off_t offset = ftell(foz_db->file[0]);
+   uint64_t offset = db_stat.st_size + FOSSILIZE_BLOB_HASH_LENGTH;
 
-   /* Write db entry header */
-   if (fwrite(&header, 1, sizeof(header), foz_db->file[0]) != sizeof(header))
-      goto fail;
-
-   /* Now write the db entry blob */
-   if (fwrite(blob, 1, blob_size, foz_db->file[0]) != blob_size)
-      goto fail;
-
-   /* Flush everything to file to reduce chance of cache corruption */
-   fflush(foz_db->file[0]);
-
-   /* Write hash header to index db */
-   if (fwrite(hash_str, 1, FOSSILIZE_BLOB_HASH_LENGTH, foz_db->db_idx) !=
-       FOSSILIZE_BLOB_HASH_LENGTH)
-      goto fail;
+   if (!write_all_at(fileno(foz_db->file[0]), record,
+                     FOSSILIZE_BLOB_HASH_LENGTH + sizeof(header), db_stat.st_size) ||
+       !write_all_at(fileno(foz_db->file[0]), blob, blob_size,
+                     offset + sizeof(header)))
+      goto fail_file;
 
+   /* The index record is written last so that other processes never see an
+    * index entry pointing at a partially written blob. */
    header.uncompressed_size = sizeof(uint64_t);
    header.format = FOSSILIZE_COMPRESSION_NONE;
    header.payload_size = sizeof(uint64_t);
    header.crc = 0;
 
-   if (fwrite(&header, 1, sizeof(header), foz_db->db_idx) !=
-       sizeof(header))
-      goto fail;
+   memcpy(record + FOSSILIZE_BLOB_HASH_LENGTH, &header, sizeof(header));
+   memcpy(record + FOSSILIZE_BLOB_HASH_LENGTH + sizeof(header), &offset, sizeof(offset));
 
-   if (fwrite(&offset, 1, sizeof(uint64_t), foz_db->db_idx) !=
-       sizeof(uint64_t))
-      goto fail;
-
-   /* Flush everything to file to reduce chance of cache corruption */
-   fflush(foz_db->db_idx);
-
-   entry = ralloc(foz_db->mem_ctx, struct foz_db_entry);
-   entry->header = header;
-   entry->offset = offset;
-   entry->file_idx = 0;
-   _mesa_sha1_hex_to_sha1(entry->key, hash_str);
-   _mesa_hash_table_u64_insert(foz_db->index_db, hash, entry);
+   if (!write_all_at(fileno(foz_db->db_idx), record, sizeof(record), idx_stat.st_size))
+      goto fail_file;
 
+   /* Pick up the new entry (and any other process' entries) from the index. */
+   simple_mtx_lock(&foz_db->mtx);
+   update_foz_index(foz_db, foz_db->db_idx, 0);
    simple_mtx_unlock(&foz_db->mtx);
+
    flock(fileno(foz_db->file[0]), LOCK_UN);
    simple_mtx_unlock(&foz_db->flock_mtx);
 
    return true;
 
-fail:
-   simple_mtx_unlock(&foz_db->mtx);
 fail_file:
    flock(fileno(foz_db->file[0]), LOCK_UN);
    simple_mtx_unlock(&foz_db->flock_mtx);
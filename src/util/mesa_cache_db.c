@@ -686,8 +686,8 @@ mesa_cache_db_read_entry(struct mesa_cache_db *db,
 {
    uint64_t hash = to_mesa_cache_db_hash(cache_key_160bit);
    struct mesa_cache_db_file_entry cache_entry;
-   struct mesa_index_db_file_entry index_entry;
    struct mesa_index_db_hash_entry *hash_entry;
+   uint64_t last_access_time;
    void *data = NULL;
 
    if (!mesa_db_lock(db))
@@ -714,6 +714,9 @@ mesa_cache_db_read_entry(struct mesa_cache_db *db,
    if (memcmp(cache_entry.key, cache_key_160bit, sizeof(cache_entry.key)))
       goto fail;
 
+   if (cache_entry.size != hash_entry->size)
+      goto fail_fatal;
+
    data = malloc(cache_entry.size);
    if (!data)
       goto fail;
@@ -722,18 +725,16 @@ mesa_cache_db_read_entry(struct mesa_cache_db *db,
        util_hash_crc32(data, cache_entry.size) != cache_entry.crc)
       goto fail_fatal;
 
-   if (!mesa_db_seek(db->index.file, hash_entry->index_db_file_offset) ||
-       !mesa_db_read(db->index.file, &index_entry) ||
-       !mesa_db_index_entry_valid(&index_entry) ||
-       index_entry.cache_db_file_offset != hash_entry->cache_db_file_offset ||
-       index_entry.size != hash_entry->size)
-      goto fail_fatal;
-
-   index_entry.last_access_time = os_time_get_nano();
-   hash_entry->last_access_time = index_entry.last_access_time;
+   /* The in-memory index mirrors the index file for as long as the UUID
+    * doesn't change (compaction always changes it), so there is no need to
+    * read the index entry back.  Only overwrite its access time.
+    */
+   last_access_time = os_time_get_nano();
+   hash_entry->last_access_time = last_access_time;
 
-   if (!mesa_db_seek(db->index.file, hash_entry->index_db_file_offset) ||
-       !mesa_db_write(db->index.file, &index_entry))
+   if (!mesa_db_seek(db->index.file, hash_entry->index_db_file_offset +
+                     offsetof(struct mesa_index_db_file_entry, last_access_time)) ||
+       !mesa_db_write(db->index.file, &last_access_time))
       goto fail_fatal;
 
    fflush(db->index.file);
@@ -885,6 +886,9 @@ mesa_cache_db_entry_remove(struct mesa_cache_db *db,
    if (memcmp(cache_entry.key, cache_key_160bit, sizeof(cache_entry.key)))
       goto fail;
 
+   if (cache_entry.size != hash_entry->size)
+      goto fail_fatal;
+
    if (!mesa_db_compact(db, 0, hash_entry))
       goto fail_fatal;
 
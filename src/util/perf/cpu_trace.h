@@ -27,6 +27,12 @@
          util_perfetto_trace_end(category);                                  \
    } while (0)
 
+#define _MESA_TRACE_COUNTER(category, name, value)                           \
+   do {                                                                      \
+      if (unlikely(util_perfetto_is_category_enabled(category)))             \
+         util_perfetto_counter_set(category, name, value);                   \
+   } while (0)
+
 /* NOTE: for now disable atrace for C++ to workaround a ndk bug with ordering
  * between stdatomic.h and atomic.h.  See:
  *
@@ -39,11 +45,14 @@
 #define _MESA_TRACE_BEGIN(category, name)                                    \
    atrace_begin(ATRACE_TAG_GRAPHICS, name)
 #define _MESA_TRACE_END(category) atrace_end(ATRACE_TAG_GRAPHICS)
+#define _MESA_TRACE_COUNTER(category, name, value)                           \
+   atrace_int64(ATRACE_TAG_GRAPHICS, name, value)
 
 #else
 
 #define _MESA_TRACE_BEGIN(category, name)
 #define _MESA_TRACE_END(category)
+#define _MESA_TRACE_COUNTER(category, name, value)
 
 #endif /* HAVE_PERFETTO */
 
@@ -96,6 +105,9 @@ _mesa_trace_scope_end(int *scope)
    _MESA_TRACE_SCOPE(UTIL_PERFETTO_CATEGORY_DEFAULT, name)
 #define MESA_TRACE_FUNC()                                                    \
    _MESA_TRACE_SCOPE(UTIL_PERFETTO_CATEGORY_DEFAULT, __func__)
+/* name must be a string literal, perfetto keeps the pointer */
+#define MESA_TRACE_COUNTER(name, value)                                      \
+   _MESA_TRACE_COUNTER(UTIL_PERFETTO_CATEGORY_DEFAULT, name, value)
 
 /* these use the slow category */
 #define MESA_TRACE_BEGIN_SLOW(name)                                          \
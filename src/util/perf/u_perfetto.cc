@@ -95,6 +95,26 @@ util_perfetto_trace_end(enum util_perfetto_category category)
    util_perfetto_update_category_states();
 }
 
+void
+util_perfetto_counter_set(enum util_perfetto_category category,
+                          const char *name, double value)
+{
+#define TRACE_COUNTER_SET(cat, name, value)                                  \
+   TRACE_COUNTER(UTIL_PERFETTO_CATEGORY_##cat##_STR,                         \
+                 perfetto::CounterTrack(name), value)
+   switch (category) {
+   case UTIL_PERFETTO_CATEGORY_DEFAULT:
+      TRACE_COUNTER_SET(DEFAULT, name, value);
+      break;
+   case UTIL_PERFETTO_CATEGORY_SLOW:
+      TRACE_COUNTER_SET(SLOW, name, value);
+      break;
+   default:
+      unreachable("bad perfetto category");
+   }
+#undef TRACE_COUNTER_SET
+}
+
 class UtilPerfettoObserver : public perfetto::TrackEventSessionObserver {
  public:
    UtilPerfettoObserver() { perfetto::TrackEvent::AddSessionObserver(this); }
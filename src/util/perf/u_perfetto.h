@@ -54,6 +54,10 @@ void util_perfetto_trace_begin(enum util_perfetto_category category,
 
 void util_perfetto_trace_end(enum util_perfetto_category category);
 
+/* name must have static storage duration */
+void util_perfetto_counter_set(enum util_perfetto_category category,
+                               const char *name, double value);
+
 #else /* HAVE_PERFETTO */
 
 static inline void
@@ -78,6 +82,12 @@ util_perfetto_trace_end(enum util_perfetto_category category)
 {
 }
 
+static inline void
+util_perfetto_counter_set(enum util_perfetto_category category,
+                          const char *name, double value)
+{
+}
+
 #endif /* HAVE_PERFETTO */
 
 #ifdef __cplusplus
@@ -278,12 +278,48 @@ u_trace_payload_buf_unref(struct u_trace_payload_buf *payload)
       free(payload);
 }
 
-static void
-free_chunk(void *ptr)
+static void *
+get_timestamp_buffer(struct u_trace_context *utctx)
 {
-   struct u_trace_chunk *chunk = ptr;
+   void *timestamps = NULL;
+
+   simple_mtx_lock(&utctx->ts_buffer_cache_lock);
+   if (utctx->num_cached_ts_buffers > 0)
+      timestamps = utctx->ts_buffer_cache[--utctx->num_cached_ts_buffers];
+   simple_mtx_unlock(&utctx->ts_buffer_cache_lock);
+
+   if (timestamps)
+      utctx->clear_timestamp_buffer(utctx, timestamps);
+   else
+      timestamps = utctx->create_timestamp_buffer(utctx, TIMESTAMP_BUF_SIZE);
+
+   return timestamps;
+}
+
+/* Only buffers of processed chunks may be recycled, since for those the
+ * GPU is known to be done writing timestamps.
+ */
+static void
+put_timestamp_buffer(struct u_trace_context *utctx, void *timestamps,
+                     bool idle)
+{
+   if (idle && utctx->clear_timestamp_buffer) {
+      simple_mtx_lock(&utctx->ts_buffer_cache_lock);
+      if (utctx->num_cached_ts_buffers < U_TRACE_TS_BUFFER_CACHE_SIZE) {
+         utctx->ts_buffer_cache[utctx->num_cached_ts_buffers++] = timestamps;
+         timestamps = NULL;
+      }
+      simple_mtx_unlock(&utctx->ts_buffer_cache_lock);
+   }
+
+   if (timestamps)
+      utctx->delete_timestamp_buffer(utctx, timestamps);
+}
 
-   chunk->utctx->delete_timestamp_buffer(chunk->utctx, chunk->timestamps);
+static void
+release_chunk(struct u_trace_chunk *chunk, bool processed)
+{
+   put_timestamp_buffer(chunk->utctx, chunk->timestamps, processed);
 
    /* Unref payloads attached to this chunk. */
    struct u_trace_payload_buf **payload;
@@ -295,6 +331,12 @@ free_chunk(void *ptr)
    free(chunk);
 }
 
+static void
+free_chunk(void *ptr)
+{
+   release_chunk(ptr, false);
+}
+
 static void
 free_chunks(struct list_head *chunks)
 {
@@ -345,8 +387,7 @@ get_chunk(struct u_trace *ut, size_t payload_size)
    chunk = calloc(1, sizeof(*chunk));
 
    chunk->utctx = ut->utctx;
-   chunk->timestamps =
-      ut->utctx->create_timestamp_buffer(ut->utctx, TIMESTAMP_BUF_SIZE);
+   chunk->timestamps = get_timestamp_buffer(ut->utctx);
    chunk->last = true;
    u_vector_init(&chunk->payloads, 4, sizeof(struct u_trace_payload_buf *));
    if (payload_size > 0) {
@@ -448,6 +489,7 @@ u_trace_context_init(struct u_trace_context *utctx,
    utctx->record_timestamp = record_timestamp;
    utctx->read_timestamp = read_timestamp;
    utctx->delete_flush_data = delete_flush_data;
+   utctx->clear_timestamp_buffer = NULL;
 
    utctx->last_time_ns = 0;
    utctx->first_time_ns = 0;
@@ -458,6 +500,9 @@ u_trace_context_init(struct u_trace_context *utctx,
 
    list_inithead(&utctx->flushed_trace_chunks);
 
+   simple_mtx_init(&utctx->ts_buffer_cache_lock, mtx_plain);
+   utctx->num_cached_ts_buffers = 0;
+
    if (utctx->enabled_traces & U_TRACE_TYPE_PRINT) {
       utctx->out = u_trace_state.trace_file;
 
@@ -507,11 +552,16 @@ u_trace_context_fini(struct u_trace_context *utctx)
       fflush(utctx->out);
    }
 
-   if (!utctx->queue.jobs)
-      return;
-   util_queue_finish(&utctx->queue);
-   util_queue_destroy(&utctx->queue);
-   free_chunks(&utctx->flushed_trace_chunks);
+   if (utctx->queue.jobs) {
+      util_queue_finish(&utctx->queue);
+      util_queue_destroy(&utctx->queue);
+      free_chunks(&utctx->flushed_trace_chunks);
+   }
+
+   for (unsigned i = 0; i < utctx->num_cached_ts_buffers; i++)
+      utctx->delete_timestamp_buffer(utctx, utctx->ts_buffer_cache[i]);
+   utctx->num_cached_ts_buffers = 0;
+   simple_mtx_destroy(&utctx->ts_buffer_cache_lock);
 }
 
 #ifdef HAVE_PERFETTO
@@ -635,7 +685,7 @@ process_chunk(void *job, void *gdata, int thread_index)
 static void
 cleanup_chunk(void *job, void *gdata, int thread_index)
 {
-   free_chunk(job);
+   release_chunk(job, true);
 }
 
 void
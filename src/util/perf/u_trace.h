@@ -136,6 +136,15 @@ typedef uint64_t (*u_trace_read_ts)(struct u_trace_context *utctx,
 typedef void (*u_trace_delete_flush_data)(struct u_trace_context *utctx,
                                           void *flush_data);
 
+/**
+ * Optional driver provided callback to reset a timestamp buffer that is
+ * about to be reused to the contents create_timestamp_buffer() gives a new
+ * one.  Only contexts that set it get the timestamp buffers of processed
+ * chunks recycled; otherwise they are deleted.
+ */
+typedef void (*u_trace_clear_ts_buffer)(struct u_trace_context *utctx,
+                                        void *timestamps);
+
 enum u_trace_type {
    U_TRACE_TYPE_PRINT = 1u << 0,
    U_TRACE_TYPE_JSON = 1u << 1,
@@ -158,6 +167,8 @@ enum u_trace_type {
       U_TRACE_TYPE_PRINT | U_TRACE_TYPE_PERFETTO_ACTIVE,
 };
 
+#define U_TRACE_TS_BUFFER_CACHE_SIZE 32
+
 /**
  * The trace context provides tracking for "in-flight" traces, once the
  * cmdstream that records timestamps has been flushed.
@@ -173,6 +184,8 @@ struct u_trace_context {
    u_trace_record_ts record_timestamp;
    u_trace_read_ts read_timestamp;
    u_trace_delete_flush_data delete_flush_data;
+   /* Set by the driver after u_trace_context_init(), may be NULL: */
+   u_trace_clear_ts_buffer clear_timestamp_buffer;
 
    FILE *out;
    struct u_trace_printer *out_printer;
@@ -201,6 +214,16 @@ struct u_trace_context {
 
    /* list of unprocessed trace chunks in fifo order: */
    struct list_head flushed_trace_chunks;
+
+   /* Timestamp buffers of already processed chunks, kept around so that
+    * new chunks do not have to go through create_timestamp_buffer() (which
+    * usually means a BO allocation).  Only used if the driver provides
+    * clear_timestamp_buffer.  Chunks are retired on the queue thread, hence
+    * the lock.
+    */
+   simple_mtx_t ts_buffer_cache_lock;
+   void *ts_buffer_cache[U_TRACE_TS_BUFFER_CACHE_SIZE];
+   unsigned num_cached_ts_buffers;
 };
 
 /**
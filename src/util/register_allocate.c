@@ -765,17 +765,21 @@ ra_simplify(struct ra_graph *g)
              * know we're going to loop again before attempting to do anything
              * optimistic.
              */
-            for (int j = high_bit; j >= 0; j--) {
-               if (pq & BITSET_BIT(j)) {
-                  unsigned int n = i * BITSET_WORDBITS + j;
-                  assert(n < g->count);
-                  add_node_to_stack(g, n);
-                  /* add_node_to_stack() may update pq_test for this word so
-                   * we need to update our local copy.
-                   */
-                  pq = g->tmp.pq_test[i] & ~skip;
-                  progress = true;
-               }
+            pq &= mask;
+            while (pq) {
+               /* Walk the set bits from the top down, jumping straight to
+                * the next one instead of testing every bit of the word.
+                */
+               const int j = util_last_bit(pq) - 1;
+               unsigned int n = i * BITSET_WORDBITS + j;
+               assert(n < g->count);
+               add_node_to_stack(g, n);
+               /* add_node_to_stack() may update pq_test for this word so
+                * we need to update our local copy.  Bits at or above j were
+                * already visited in this pass.
+                */
+               pq = g->tmp.pq_test[i] & ~skip & BITFIELD_MASK(j);
+               progress = true;
             }
          } else if (!progress) {
             if (g->tmp.min_q_total[i] == UINT_MAX) {
@@ -6,7 +6,49 @@
 
 #include "simple_mtx.h"
 
-#if !UTIL_FUTEX_SUPPORTED
+#if UTIL_FUTEX_SUPPORTED
+
+/* Number of times to poll a held, uncontended lock before going to sleep.
+ * Most simple_mtx critical sections are a handful of instructions, so the
+ * holder is likely to be done long before a futex round trip would be.
+ */
+#define SIMPLE_MTX_SPIN_COUNT 128
+
+static inline void
+cpu_relax(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+   __builtin_ia32_pause();
+#elif defined(__aarch64__)
+   __asm__ volatile("yield" ::: "memory");
+#endif
+}
+
+void
+_simple_mtx_lock_contended(simple_mtx_t *mtx, uint32_t c)
+{
+   /* Only spin while nobody is parked on the lock.  Once there are waiters
+    * (c == 2) the unlocker is going to wake one of them anyway.
+    */
+   for (unsigned i = 0; c == 1 && i < SIMPLE_MTX_SPIN_COUNT; i++) {
+      cpu_relax();
+      c = p_atomic_read_relaxed(&mtx->val);
+      if (c == 0) {
+         c = p_atomic_cmpxchg(&mtx->val, 0, 1);
+         if (c == 0)
+            return;
+      }
+   }
+
+   if (c != 2)
+      c = p_atomic_xchg(&mtx->val, 2);
+   while (c != 0) {
+      futex_wait(&mtx->val, 2, NULL);
+      c = p_atomic_xchg(&mtx->val, 2);
+   }
+}
+
+#else /* !UTIL_FUTEX_SUPPORTED */
 
 void _simple_mtx_plain_init_once(simple_mtx_t *mtx)
 {
@@ -98,6 +98,9 @@ simple_mtx_destroy(ASSERTED simple_mtx_t *mtx)
 #endif
 }
 
+void
+_simple_mtx_lock_contended(simple_mtx_t *mtx, uint32_t c);
+
 static inline void
 simple_mtx_lock(simple_mtx_t *mtx)
 {
@@ -107,14 +110,8 @@ simple_mtx_lock(simple_mtx_t *mtx)
 
    assert(c != _SIMPLE_MTX_INVALID_VALUE);
 
-   if (__builtin_expect(c != 0, 0)) {
-      if (c != 2)
-         c = p_atomic_xchg(&mtx->val, 2);
-      while (c != 0) {
-         futex_wait(&mtx->val, 2, NULL);
-         c = p_atomic_xchg(&mtx->val, 2);
-      }
-   }
+   if (__builtin_expect(c != 0, 0))
+      _simple_mtx_lock_contended(mtx, c);
 
    HG(ANNOTATE_RWLOCK_ACQUIRED(mtx, 1));
 }
@@ -296,6 +296,27 @@ test_put_and_get(bool test_cache_size_limit, const char *driver_id)
 
    free(result);
 
+   /* Test batched get of both items plus one that doesn't exist. */
+   cache_key batch_keys[3];
+   void *batch_data[3];
+   size_t batch_sizes[3];
+
+   memcpy(batch_keys[0], string_key, sizeof(cache_key));
+   memcpy(batch_keys[1], blob_key, sizeof(cache_key));
+   memcpy(batch_keys[2], blob_key, sizeof(cache_key));
+   batch_keys[2][0] ^= 0xff;
+
+   disk_cache_get_batch(cache, 3, batch_keys, batch_data, batch_sizes);
+   EXPECT_STREQ((char *) batch_data[0], string) << "disk_cache_get_batch of 1st item (pointer)";
+   EXPECT_EQ(batch_sizes[0], sizeof(string)) << "disk_cache_get_batch of 1st item (size)";
+   EXPECT_STREQ((char *) batch_data[1], blob) << "disk_cache_get_batch of 2nd item (pointer)";
+   EXPECT_EQ(batch_sizes[1], sizeof(blob)) << "disk_cache_get_batch of 2nd item (size)";
+   EXPECT_EQ(batch_data[2], nullptr) << "disk_cache_get_batch of non-existent item (pointer)";
+   EXPECT_EQ(batch_sizes[2], 0) << "disk_cache_get_batch of non-existent item (size)";
+
+   for (unsigned i = 0; i < 3; i++)
+      free(batch_data[i]);
+
    /* Set the cache size to 1KB and add a 1KB item to force an eviction. */
    disk_cache_destroy(cache);
 
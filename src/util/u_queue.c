@@ -286,8 +286,11 @@ util_queue_thread_func(void *input)
       assert(queue->num_queued >= 0 && queue->num_queued <= queue->max_jobs);
 
       /* wait if the queue is empty */
-      while (thread_index < queue->num_threads && queue->num_queued == 0)
+      while (thread_index < queue->num_threads && queue->num_queued == 0) {
+         queue->num_idle_threads++;
          cnd_wait(&queue->has_queued_cond, &queue->lock);
+         queue->num_idle_threads--;
+      }
 
       /* only kill threads that are above "num_threads" */
       if (thread_index >= queue->num_threads) {
@@ -300,11 +303,17 @@ util_queue_thread_func(void *input)
       queue->read_idx = (queue->read_idx + 1) % queue->max_jobs;
 
       queue->num_queued--;
-      cnd_signal(&queue->has_space_cond);
+      bool wake_producer = queue->num_waiting_producers > 0;
       if (job.job)
          queue->total_jobs_size -= job.job_size;
       mtx_unlock(&queue->lock);
 
+      /* Signal after unlocking, so that the woken thread doesn't immediately
+       * block on the mutex we are still holding.
+       */
+      if (wake_producer)
+         cnd_signal(&queue->has_space_cond);
+
       if (job.job) {
          job.execute(job.job, job.global_data, thread_index);
          if (job.fence)
@@ -618,8 +627,11 @@ util_queue_add_job_locked(struct util_queue *queue,
          queue->max_jobs = new_max_jobs;
       } else {
          /* Wait until there is a free slot. */
-         while (queue->num_queued == queue->max_jobs)
+         while (queue->num_queued == queue->max_jobs) {
+            queue->num_waiting_producers++;
             cnd_wait(&queue->has_space_cond, &queue->lock);
+            queue->num_waiting_producers--;
+         }
       }
    }
 
@@ -636,9 +648,20 @@ util_queue_add_job_locked(struct util_queue *queue,
    queue->total_jobs_size += ptr->job_size;
 
    queue->num_queued++;
-   cnd_signal(&queue->has_queued_cond);
-   if (!locked)
+
+   /* Only wake up a thread if one is idle; busy threads will pick up the job
+    * when they are done. When we own the lock, signal after unlocking so that
+    * the woken thread doesn't immediately block on it.
+    */
+   bool wake_thread = queue->num_idle_threads > 0;
+   if (locked) {
+      if (wake_thread)
+         cnd_signal(&queue->has_queued_cond);
+   } else {
       mtx_unlock(&queue->lock);
+      if (wake_thread)
+         cnd_signal(&queue->has_queued_cond);
+   }
 }
 
 void
@@ -211,6 +211,11 @@ struct util_queue {
    thrd_t *threads;
    unsigned flags;
    int num_queued;
+   /* Threads blocked on has_queued_cond/has_space_cond, so that the other
+    * side only signals the condition variable when somebody is waiting.
+    */
+   unsigned num_idle_threads;
+   unsigned num_waiting_producers;
    unsigned max_threads;
    unsigned num_threads; /* decreasing this number will terminate threads */
    int max_jobs;
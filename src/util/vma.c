@@ -170,6 +170,12 @@ util_vma_heap_alloc(struct util_vma_heap *heap,
             BITFIELD64_BIT(heap->nospan_shift));
    }
 
+   /* No hole can be larger than all of the free space put together, so
+    * don't walk the whole hole list just to find that out.
+    */
+   if (size > heap->free_size)
+      return 0;
+
    if (heap->alloc_high) {
       util_vma_foreach_hole_safe(hole, heap) {
          if (size > hole->size)
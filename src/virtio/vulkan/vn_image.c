@@ -21,8 +21,198 @@
 #include "vn_physical_device.h"
 #include "vn_wsi.h"
 
+#include "util/hash_table.h"
+
 /* image commands */
 
+#define VN_IMAGE_REQS_CACHE_MAX_ENTRY_COUNT 1024
+
+static uint32_t
+vn_image_reqs_cache_key_hash(const void *key)
+{
+   return _mesa_hash_data(key, SHA1_DIGEST_LENGTH);
+}
+
+static bool
+vn_image_reqs_cache_key_equal(const void *a, const void *b)
+{
+   return memcmp(a, b, SHA1_DIGEST_LENGTH) == 0;
+}
+
+void
+vn_image_reqs_cache_init(struct vn_device *dev)
+{
+   struct vn_image_reqs_cache *cache = &dev->image_reqs_cache;
+
+   if (VN_PERF(NO_ASYNC_IMAGE_CREATE))
+      return;
+
+   /* caching is simply skipped if the table cannot be allocated */
+   cache->ht = _mesa_hash_table_create(NULL, vn_image_reqs_cache_key_hash,
+                                       vn_image_reqs_cache_key_equal);
+   simple_mtx_init(&cache->mutex, mtx_plain);
+}
+
+static void
+vn_image_reqs_cache_debug_dump(struct vn_image_reqs_cache *cache)
+{
+   vn_log(NULL, "dumping image reqs cache statistics");
+   vn_log(NULL, "  cache hit: %d", cache->debug.cache_hit_count);
+   vn_log(NULL, "  cache miss: %d", cache->debug.cache_miss_count);
+   vn_log(NULL, "  cache skip: %d", cache->debug.cache_skip_count);
+}
+
+void
+vn_image_reqs_cache_fini(struct vn_device *dev)
+{
+   const VkAllocationCallbacks *alloc = &dev->base.base.alloc;
+   struct vn_image_reqs_cache *cache = &dev->image_reqs_cache;
+
+   if (VN_PERF(NO_ASYNC_IMAGE_CREATE))
+      return;
+
+   if (cache->ht) {
+      hash_table_foreach(cache->ht, hash_entry)
+         vk_free(alloc, hash_entry->data);
+      _mesa_hash_table_destroy(cache->ht, NULL);
+   }
+   simple_mtx_destroy(&cache->mutex);
+
+   if (VN_DEBUG(CACHE))
+      vn_image_reqs_cache_debug_dump(cache);
+}
+
+static bool
+vn_image_get_reqs_cache_key(struct vn_device *dev,
+                            const VkImageCreateInfo *create_info,
+                            uint8_t *key)
+{
+   struct vn_image_reqs_cache *cache = &dev->image_reqs_cache;
+   struct mesa_sha1 sha1_ctx;
+
+   if (!cache->ht)
+      return false;
+
+   /* For simplicity, cache only single-plane images whose pNext chain
+    * consists of structs known not to carry handles or external state.
+    * Anything else, including wsi and external memory images, always goes
+    * to the renderer.
+    */
+   if (create_info->flags & VK_IMAGE_CREATE_DISJOINT_BIT)
+      goto skip;
+
+   _mesa_sha1_init(&sha1_ctx);
+
+   vk_foreach_struct_const(src, create_info->pNext) {
+      switch (src->sType) {
+      case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO: {
+         const VkImageFormatListCreateInfo *list =
+            (const VkImageFormatListCreateInfo *)src;
+         _mesa_sha1_update(&sha1_ctx, &list->sType, sizeof(list->sType));
+         _mesa_sha1_update(&sha1_ctx, list->pViewFormats,
+                           sizeof(VkFormat) * list->viewFormatCount);
+      } break;
+      case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO: {
+         const VkImageStencilUsageCreateInfo *stencil =
+            (const VkImageStencilUsageCreateInfo *)src;
+         _mesa_sha1_update(&sha1_ctx, &stencil->sType,
+                           sizeof(stencil->sType));
+         _mesa_sha1_update(&sha1_ctx, &stencil->stencilUsage,
+                           sizeof(stencil->stencilUsage));
+      } break;
+      default:
+         goto skip;
+      }
+   }
+
+   /* flags through queueFamilyIndexCount are tightly packed 32-bit members */
+   const size_t begin = offsetof(VkImageCreateInfo, flags);
+   const size_t end = offsetof(VkImageCreateInfo, queueFamilyIndexCount) +
+                      sizeof(create_info->queueFamilyIndexCount);
+   _mesa_sha1_update(&sha1_ctx, (const uint8_t *)create_info + begin,
+                     end - begin);
+   if (create_info->sharingMode == VK_SHARING_MODE_CONCURRENT) {
+      _mesa_sha1_update(&sha1_ctx, create_info->pQueueFamilyIndices,
+                        sizeof(uint32_t) *
+                           create_info->queueFamilyIndexCount);
+   }
+   _mesa_sha1_update(&sha1_ctx, &create_info->initialLayout,
+                     sizeof(create_info->initialLayout));
+   _mesa_sha1_final(&sha1_ctx, key);
+
+   return true;
+
+skip:
+   p_atomic_inc(&cache->debug.cache_skip_count);
+   return false;
+}
+
+static bool
+vn_image_get_cached_memory_requirements(
+   struct vn_device *dev,
+   const uint8_t *key,
+   struct vn_image_memory_requirements *out)
+{
+   struct vn_image_reqs_cache *cache = &dev->image_reqs_cache;
+   bool found = false;
+
+   simple_mtx_lock(&cache->mutex);
+   struct hash_entry *hash_entry = _mesa_hash_table_search(cache->ht, key);
+   if (hash_entry) {
+      const struct vn_image_reqs_cache_entry *entry = hash_entry->data;
+      *out = entry->requirements;
+      found = true;
+   }
+   simple_mtx_unlock(&cache->mutex);
+
+   if (!found) {
+      p_atomic_inc(&cache->debug.cache_miss_count);
+      return false;
+   }
+
+   /* fix up the pNext chain which points back into the cache entry */
+   out->memory.pNext = &out->dedicated;
+   out->dedicated.pNext = NULL;
+
+   p_atomic_inc(&cache->debug.cache_hit_count);
+   return true;
+}
+
+static void
+vn_image_store_reqs_in_cache(struct vn_device *dev,
+                             const uint8_t *key,
+                             const struct vn_image_memory_requirements *req)
+{
+   const VkAllocationCallbacks *alloc = &dev->base.base.alloc;
+   struct vn_image_reqs_cache *cache = &dev->image_reqs_cache;
+
+   simple_mtx_lock(&cache->mutex);
+
+   /* Entry might have already been added by another thread before the
+    * lock.  Stop growing once the cap is hit rather than evicting, since
+    * apps keep creating images from a small working set of create infos.
+    */
+   if (cache->entry_count >= VN_IMAGE_REQS_CACHE_MAX_ENTRY_COUNT ||
+       _mesa_hash_table_search(cache->ht, key))
+      goto unlock;
+
+   struct vn_image_reqs_cache_entry *entry =
+      vk_alloc(alloc, sizeof(*entry), VN_DEFAULT_ALIGN,
+               VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+   if (!entry)
+      goto unlock;
+
+   entry->requirements = *req;
+   memcpy(entry->key, key, SHA1_DIGEST_LENGTH);
+   if (_mesa_hash_table_insert(cache->ht, entry->key, entry))
+      cache->entry_count++;
+   else
+      vk_free(alloc, entry);
+
+unlock:
+   simple_mtx_unlock(&cache->mutex);
+}
+
 static void
 vn_image_init_memory_requirements(struct vn_image *img,
                                   struct vn_device *dev,
@@ -65,7 +255,6 @@ vn_image_init_memory_requirements(struct vn_image *img,
    }
    assert(plane_count <= ARRAY_SIZE(img->requirements));
 
-   /* TODO add a per-device cache for the requirements */
    for (uint32_t i = 0; i < plane_count; i++) {
       img->requirements[i].memory.sType =
          VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
@@ -110,6 +299,35 @@ vn_image_init_memory_requirements(struct vn_image *img,
    }
 }
 
+static void
+vn_copy_cached_memory_requirements(
+   const struct vn_image_memory_requirements *cached,
+   VkMemoryRequirements2 *out_mem_req)
+{
+   union {
+      VkBaseOutStructure *pnext;
+      VkMemoryRequirements2 *two;
+      VkMemoryDedicatedRequirements *dedicated;
+   } u = { .two = out_mem_req };
+
+   while (u.pnext) {
+      switch (u.pnext->sType) {
+      case VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2:
+         u.two->memoryRequirements = cached->memory.memoryRequirements;
+         break;
+      case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS:
+         u.dedicated->prefersDedicatedAllocation =
+            cached->dedicated.prefersDedicatedAllocation;
+         u.dedicated->requiresDedicatedAllocation =
+            cached->dedicated.requiresDedicatedAllocation;
+         break;
+      default:
+         break;
+      }
+      u.pnext = u.pnext->pNext;
+   }
+}
+
 static VkResult
 vn_image_deferred_info_init(struct vn_image *img,
                             const VkImageCreateInfo *create_info,
@@ -209,7 +427,24 @@ vn_image_init(struct vn_device *dev,
 
    img->sharing_mode = create_info->sharingMode;
 
-   /* TODO async */
+   /* AHB backed images override the dedicated requirements, and their
+    * create info is rewritten from the deferred info, so keep them out of
+    * the cache.
+    */
+   uint8_t key[SHA1_DIGEST_LENGTH];
+   const bool cacheable =
+      !img->deferred_info &&
+      vn_image_get_reqs_cache_key(dev, create_info, key);
+
+   /* If cacheable and mem requirements found in cache, make async call */
+   if (cacheable && vn_image_get_cached_memory_requirements(
+                       dev, key, &img->requirements[0])) {
+      vn_async_vkCreateImage(dev->instance, device, create_info, NULL,
+                             &image);
+      return VK_SUCCESS;
+   }
+
+   /* If cache miss or not cacheable, make synchronous call */
    result =
       vn_call_vkCreateImage(dev->instance, device, create_info, NULL, &image);
    if (result != VK_SUCCESS)
@@ -217,6 +452,10 @@ vn_image_init(struct vn_device *dev,
 
    vn_image_init_memory_requirements(img, dev, create_info);
 
+   /* If cacheable, store mem requirements from the synchronous call */
+   if (cacheable)
+      vn_image_store_reqs_in_cache(dev, key, &img->requirements[0]);
+
    return VK_SUCCESS;
 }
 
@@ -469,11 +708,6 @@ vn_GetImageMemoryRequirements2(VkDevice device,
                                VkMemoryRequirements2 *pMemoryRequirements)
 {
    const struct vn_image *img = vn_image_from_handle(pInfo->image);
-   union {
-      VkBaseOutStructure *pnext;
-      VkMemoryRequirements2 *two;
-      VkMemoryDedicatedRequirements *dedicated;
-   } u = { .two = pMemoryRequirements };
 
    uint32_t plane = 0;
    const VkImagePlaneMemoryRequirementsInfo *plane_info =
@@ -493,23 +727,8 @@ vn_GetImageMemoryRequirements2(VkDevice device,
       }
    }
 
-   while (u.pnext) {
-      switch (u.pnext->sType) {
-      case VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2:
-         u.two->memoryRequirements =
-            img->requirements[plane].memory.memoryRequirements;
-         break;
-      case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS:
-         u.dedicated->prefersDedicatedAllocation =
-            img->requirements[plane].dedicated.prefersDedicatedAllocation;
-         u.dedicated->requiresDedicatedAllocation =
-            img->requirements[plane].dedicated.requiresDedicatedAllocation;
-         break;
-      default:
-         break;
-      }
-      u.pnext = u.pnext->pNext;
-   }
+   vn_copy_cached_memory_requirements(&img->requirements[plane],
+                                      pMemoryRequirements);
 }
 
 void
@@ -849,7 +1068,15 @@ vn_GetDeviceImageMemoryRequirements(
 {
    struct vn_device *dev = vn_device_from_handle(device);
 
-   /* TODO per-device cache */
+   /* Disjoint images are never cached, so the plane aspect can be ignored */
+   uint8_t key[SHA1_DIGEST_LENGTH];
+   struct vn_image_memory_requirements cached;
+   if (vn_image_get_reqs_cache_key(dev, pInfo->pCreateInfo, key) &&
+       vn_image_get_cached_memory_requirements(dev, key, &cached)) {
+      vn_copy_cached_memory_requirements(&cached, pMemoryRequirements);
+      return;
+   }
+
    vn_call_vkGetDeviceImageMemoryRequirements(dev->instance, device, pInfo,
                                               pMemoryRequirements);
 }
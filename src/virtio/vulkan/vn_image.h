@@ -13,6 +13,8 @@
 
 #include "vn_common.h"
 
+#include "util/mesa-sha1.h"
+
 /* changing this to VK_IMAGE_LAYOUT_PRESENT_SRC_KHR disables ownership
  * transfers and can be useful for debugging
  */
@@ -23,6 +25,25 @@ struct vn_image_memory_requirements {
    VkMemoryDedicatedRequirements dedicated;
 };
 
+struct vn_image_reqs_cache_entry {
+   struct vn_image_memory_requirements requirements;
+   uint8_t key[SHA1_DIGEST_LENGTH];
+};
+
+struct vn_image_reqs_cache {
+   /* cache memory requirements keyed by a hash of the image create info */
+   struct hash_table *ht;
+   uint32_t entry_count;
+
+   simple_mtx_t mutex;
+
+   struct {
+      uint32_t cache_skip_count;
+      uint32_t cache_hit_count;
+      uint32_t cache_miss_count;
+   } debug;
+};
+
 struct vn_image_create_deferred_info {
    VkImageCreateInfo create;
    VkImageFormatListCreateInfo list;
@@ -97,6 +118,12 @@ VK_DEFINE_NONDISP_HANDLE_CASTS(vn_sampler_ycbcr_conversion,
                                VkSamplerYcbcrConversion,
                                VK_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION)
 
+void
+vn_image_reqs_cache_init(struct vn_device *dev);
+
+void
+vn_image_reqs_cache_fini(struct vn_device *dev);
+
 VkResult
 vn_image_create(struct vn_device *dev,
                 const VkImageCreateInfo *create_info,
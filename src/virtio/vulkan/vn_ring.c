@@ -92,17 +92,25 @@ vn_ring_retire_submits(struct vn_ring *ring, uint32_t seqno)
 static uint32_t
 vn_ring_wait_seqno(struct vn_ring *ring, uint32_t seqno)
 {
+   /* The renderer has often retired the seqno by the time we get here.
+    * Check once before setting up the relax state, which may have to
+    * acquire the ring monitor.
+    */
+   uint32_t head = vn_ring_load_head(ring);
+   if (likely(vn_ring_ge_seqno(ring, head, seqno)))
+      return head;
+
    /* A renderer wait incurs several hops and the renderer might poll
     * repeatedly anyway.  Let's just poll here.
     */
    struct vn_relax_state relax_state = vn_relax_init(ring, "ring seqno");
    do {
-      const uint32_t head = vn_ring_load_head(ring);
+      vn_relax(&relax_state);
+      head = vn_ring_load_head(ring);
       if (vn_ring_ge_seqno(ring, head, seqno)) {
          vn_relax_fini(&relax_state);
          return head;
       }
-      vn_relax(&relax_state);
    } while (true);
 }
 
@@ -54,6 +54,15 @@ struct instance_info {
    PFN_vkGetPhysicalDeviceProperties2 GetPhysicalDeviceProperties2;
    bool has_pci_bus, has_vulkan11;
    bool has_wayland, has_xcb;
+
+   /* Result of the last selection, keyed on the list of physical devices it
+    * was computed for.  Applications usually enumerate twice (count, then
+    * fill) and selection may need a round trip to the display server, so
+    * only redo it when the list changes.  Protected by device_select_mutex.
+    */
+   VkPhysicalDevice *cached_physical_devices;
+   uint32_t cached_physical_device_count;
+   unsigned cached_selected_index;
 };
 
 static struct hash_table *device_select_instance_ht = NULL;
@@ -181,6 +190,7 @@ static void device_select_DestroyInstance(VkInstance instance, const VkAllocatio
 
    device_select_layer_remove_instance(instance);
    info->DestroyInstance(instance, pAllocator);
+   free(info->cached_physical_devices);
    free(info);
 }
 
@@ -528,7 +538,24 @@ static VkResult device_select_EnumeratePhysicalDevices(VkInstance instance,
    if (result != VK_SUCCESS)
       goto out;
 
-   for (unsigned i = 0; i < physical_device_count; i++) {
+   unsigned selected_index;
+   bool have_selection = false;
+   bool list_devices = should_debug_device_selection() || (selection && strcmp(selection, "list") == 0);
+
+   simple_mtx_lock(&device_select_mutex);
+   if (!list_devices && info->cached_physical_devices &&
+       info->cached_physical_device_count == physical_device_count &&
+       !memcmp(info->cached_physical_devices, physical_devices,
+               physical_device_count * sizeof(VkPhysicalDevice))) {
+      selected_index = info->cached_selected_index;
+      have_selection = true;
+   }
+   simple_mtx_unlock(&device_select_mutex);
+
+   if (have_selection)
+      goto select;
+
+   for (unsigned i = 0; i < physical_device_count && !info->has_pci_bus; i++) {
       uint32_t count;
       info->EnumerateDeviceExtensionProperties(physical_devices[i], NULL, &count, NULL);
       if (count > 0) {
@@ -542,7 +569,7 @@ static VkResult device_select_EnumeratePhysicalDevices(VkInstance instance,
 	 free(extensions);
       }
    }
-   if (should_debug_device_selection() || (selection && strcmp(selection, "list") == 0)) {
+   if (list_devices) {
       fprintf(stderr, "selectable devices:\n");
       for (unsigned i = 0; i < physical_device_count; ++i)
          print_gpu(info, i, physical_devices[i]);
@@ -551,7 +578,20 @@ static VkResult device_select_EnumeratePhysicalDevices(VkInstance instance,
          exit(0);
    }
 
-   unsigned selected_index = get_default_device(info, selection, physical_device_count, physical_devices);
+   selected_index = get_default_device(info, selection, physical_device_count, physical_devices);
+
+   VkPhysicalDevice *cached_physical_devices = malloc(physical_device_count * sizeof(VkPhysicalDevice));
+   if (cached_physical_devices) {
+      memcpy(cached_physical_devices, physical_devices, physical_device_count * sizeof(VkPhysicalDevice));
+      simple_mtx_lock(&device_select_mutex);
+      free(info->cached_physical_devices);
+      info->cached_physical_devices = cached_physical_devices;
+      info->cached_physical_device_count = physical_device_count;
+      info->cached_selected_index = selected_index;
+      simple_mtx_unlock(&device_select_mutex);
+   }
+
+ select:
    selected_physical_device_count = physical_device_count;
    selected_physical_devices[0] = physical_devices[selected_index];
    for (unsigned i = 0; i < physical_device_count - 1; ++i) {
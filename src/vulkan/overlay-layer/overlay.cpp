@@ -1699,6 +1699,13 @@ static void setup_swapchain_data(struct swapchain_data *data,
 
    struct device_data *device_data = data->device;
 
+   /* Nothing is ever drawn into the swapchain images when the display is
+    * disabled, so don't bother creating the rendering resources.
+    * shutdown_swapchain_data() copes with the NULL handles.
+    */
+   if (device_data->instance->params.no_display)
+      return;
+
    /* Render pass */
    VkAttachmentDescription attachment_desc = {};
    attachment_desc.format = pCreateInfo->imageFormat;
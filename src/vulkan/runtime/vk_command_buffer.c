@@ -124,6 +124,13 @@ vk_common_ResetCommandBuffer(VkCommandBuffer commandBuffer,
    return VK_SUCCESS;
 }
 
+/* For drivers which record secondaries into a vk_cmd_queue but primaries
+ * natively: the secondary is replayed into the primary through the dispatch
+ * table every time it is executed.  Drivers which queue primaries as well
+ * (lavapipe) should instead keep the generated enqueue for
+ * vkCmdExecuteCommands and walk the secondary's list at submit time, which
+ * doesn't copy anything.
+ */
 VKAPI_ATTR void VKAPI_CALL
 vk_common_CmdExecuteCommands(VkCommandBuffer commandBuffer,
                              uint32_t commandBufferCount,
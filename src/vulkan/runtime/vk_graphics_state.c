@@ -1849,6 +1849,12 @@ vk_dynamic_graphics_state_copy(struct vk_dynamic_graphics_state *dst,
 #define COPY_IF_SET(STATE, state) \
    if (IS_SET_IN_SRC(STATE)) SET_DYN_VALUE(dst, STATE, state, src->state)
 
+   /* Pipelines with everything dynamic (common with extended dynamic state 3)
+    * have nothing to merge, so skip testing each state individually.
+    */
+   if (BITSET_IS_EMPTY(src->set))
+      return;
+
    if (IS_SET_IN_SRC(VI)) {
       assert(dst->vi != NULL);
       COPY_MEMBER(VI, vi->bindings_valid);
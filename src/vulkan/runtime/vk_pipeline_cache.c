@@ -134,22 +134,40 @@ object_key_hash(const void *void_object)
    return _mesa_hash_data(object->key_data, object->key_size);
 }
 
+/* Lookups and serialization only read object_cache and take references
+ * atomically, so they can share the lock.  Anything that adds or removes
+ * entries, including dropping the last reference to a weakly owned object,
+ * has to take it exclusively.
+ */
+static void
+vk_pipeline_cache_rdlock(struct vk_pipeline_cache *cache)
+{
+   if (!(cache->flags & VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT))
+      u_rwlock_rdlock(&cache->lock);
+}
+
 static void
-vk_pipeline_cache_lock(struct vk_pipeline_cache *cache)
+vk_pipeline_cache_rdunlock(struct vk_pipeline_cache *cache)
 {
+   if (!(cache->flags & VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT))
+      u_rwlock_rdunlock(&cache->lock);
+}
 
+static void
+vk_pipeline_cache_wrlock(struct vk_pipeline_cache *cache)
+{
    if (!(cache->flags & VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT))
-      simple_mtx_lock(&cache->lock);
+      u_rwlock_wrlock(&cache->lock);
 }
 
 static void
-vk_pipeline_cache_unlock(struct vk_pipeline_cache *cache)
+vk_pipeline_cache_wrunlock(struct vk_pipeline_cache *cache)
 {
    if (!(cache->flags & VK_PIPELINE_CACHE_CREATE_EXTERNALLY_SYNCHRONIZED_BIT))
-      simple_mtx_unlock(&cache->lock);
+      u_rwlock_wrunlock(&cache->lock);
 }
 
-/* cache->lock must be held when calling */
+/* cache->lock must be held for writing when calling */
 static void
 vk_pipeline_cache_remove_object(struct vk_pipeline_cache *cache,
                                 uint32_t hash,
@@ -185,13 +203,13 @@ vk_pipeline_cache_object_unref(struct vk_device *device, struct vk_pipeline_cach
       if (p_atomic_dec_zero(&object->ref_cnt))
          object->ops->destroy(device, object);
    } else {
-      vk_pipeline_cache_lock(weak_owner);
+      vk_pipeline_cache_wrlock(weak_owner);
       bool destroy = p_atomic_dec_zero(&object->ref_cnt);
       if (destroy) {
          uint32_t hash = object_key_hash(object);
          vk_pipeline_cache_remove_object(weak_owner, hash, object);
       }
-      vk_pipeline_cache_unlock(weak_owner);
+      vk_pipeline_cache_wrunlock(weak_owner);
       if (destroy)
          object->ops->destroy(device, object);
    }
@@ -289,7 +307,7 @@ vk_pipeline_cache_insert_object(struct vk_pipeline_cache *cache,
 
    uint32_t hash = object_key_hash(object);
 
-   vk_pipeline_cache_lock(cache);
+   vk_pipeline_cache_wrlock(cache);
    bool found = false;
    struct set_entry *entry = _mesa_set_search_or_add_pre_hashed(
        cache->object_cache, hash, object, &found);
@@ -315,7 +333,7 @@ vk_pipeline_cache_insert_object(struct vk_pipeline_cache *cache,
       else
          vk_pipeline_cache_object_weak_ref(cache, result);
    }
-   vk_pipeline_cache_unlock(cache);
+   vk_pipeline_cache_wrunlock(cache);
 
    if (found) {
       vk_pipeline_cache_object_unref(cache->base.device, object);
@@ -344,7 +362,7 @@ vk_pipeline_cache_lookup_object(struct vk_pipeline_cache *cache,
    struct vk_pipeline_cache_object *object = NULL;
 
    if (cache != NULL && cache->object_cache != NULL) {
-      vk_pipeline_cache_lock(cache);
+      vk_pipeline_cache_rdlock(cache);
       struct set_entry *entry =
          _mesa_set_search_pre_hashed(cache->object_cache, hash, &key);
       if (entry) {
@@ -352,7 +370,7 @@ vk_pipeline_cache_lookup_object(struct vk_pipeline_cache *cache,
          if (cache_hit != NULL)
             *cache_hit = true;
       }
-      vk_pipeline_cache_unlock(cache);
+      vk_pipeline_cache_rdunlock(cache);
    }
 
    if (object == NULL) {
@@ -397,9 +415,9 @@ vk_pipeline_cache_lookup_object(struct vk_pipeline_cache *cache,
          vk_pipeline_cache_log(cache,
                                "Deserializing pipeline cache object failed");
 
-         vk_pipeline_cache_lock(cache);
+         vk_pipeline_cache_wrlock(cache);
          vk_pipeline_cache_remove_object(cache, hash, object);
-         vk_pipeline_cache_unlock(cache);
+         vk_pipeline_cache_wrunlock(cache);
          vk_pipeline_cache_object_unref(cache->base.device, object);
          return NULL;
       }
@@ -413,6 +431,88 @@ vk_pipeline_cache_lookup_object(struct vk_pipeline_cache *cache,
    return object;
 }
 
+void
+vk_pipeline_cache_lookup_objects(struct vk_pipeline_cache *cache,
+                                 unsigned count,
+                                 const void *const *key_data, size_t key_size,
+                                 const struct vk_pipeline_cache_object_ops *ops,
+                                 struct vk_pipeline_cache_object **objects)
+{
+   assert(key_size <= UINT32_MAX);
+   assert(ops != NULL);
+
+   struct disk_cache *disk_cache = cache->base.device->physical->disk_cache;
+   cache_key *cache_keys = NULL;
+   unsigned *missing = NULL;
+   unsigned num_missing = 0;
+
+   if (count > 1 && !cache->skip_disk_cache && disk_cache &&
+       cache->object_cache != NULL) {
+      cache_keys = malloc(count * (sizeof(*cache_keys) + sizeof(*missing)));
+      if (cache_keys != NULL)
+         missing = (unsigned *)(cache_keys + count);
+   }
+
+   for (unsigned i = 0; i < count; i++)
+      objects[i] = NULL;
+
+   if (cache_keys != NULL) {
+      /* Find everything that would have to come from the disk cache. */
+      vk_pipeline_cache_rdlock(cache);
+      for (unsigned i = 0; i < count; i++) {
+         struct vk_pipeline_cache_object key = {
+            .key_data = key_data[i],
+            .key_size = key_size,
+         };
+         if (!_mesa_set_search_pre_hashed(cache->object_cache,
+                                          object_key_hash(&key), &key))
+            missing[num_missing++] = i;
+      }
+      vk_pipeline_cache_rdunlock(cache);
+
+      for (unsigned m = 0; m < num_missing; m++) {
+         disk_cache_compute_key(disk_cache, key_data[missing[m]], key_size,
+                                cache_keys[m]);
+      }
+
+      void **data = num_missing > 0 ?
+         malloc(num_missing * (sizeof(*data) + sizeof(size_t))) : NULL;
+      if (data != NULL) {
+         size_t *data_sizes = (size_t *)(data + num_missing);
+
+         disk_cache_get_batch(disk_cache, num_missing, cache_keys,
+                              data, data_sizes);
+
+         for (unsigned m = 0; m < num_missing; m++) {
+            if (data[m] == NULL)
+               continue;
+
+            const unsigned i = missing[m];
+            struct vk_pipeline_cache_object *object =
+               vk_pipeline_cache_object_deserialize(cache,
+                                                    key_data[i], key_size,
+                                                    data[m], data_sizes[m],
+                                                    ops);
+            free(data[m]);
+            if (object != NULL)
+               objects[i] = vk_pipeline_cache_insert_object(cache, object);
+         }
+      }
+      free(data);
+      free(cache_keys);
+   }
+
+   /* Everything else goes through the regular path, which also handles
+    * objects that are still raw data and ones that went away in between.
+    */
+   for (unsigned i = 0; i < count; i++) {
+      if (objects[i] == NULL) {
+         objects[i] = vk_pipeline_cache_lookup_object(cache, key_data[i],
+                                                      key_size, ops, NULL);
+      }
+   }
+}
+
 struct vk_pipeline_cache_object *
 vk_pipeline_cache_add_object(struct vk_pipeline_cache *cache,
                              struct vk_pipeline_cache_object *object)
@@ -435,7 +535,13 @@ vk_pipeline_cache_add_object(struct vk_pipeline_cache *cache,
             disk_cache_compute_key(disk_cache, object->key_data,
                                    object->key_size, cache_key);
 
-            disk_cache_put(disk_cache, cache_key, blob.data, blob.size, NULL);
+            /* Hand the serialized data over to the disk cache instead of
+             * having it copy the whole blob into the put job.
+             */
+            void *data;
+            size_t size;
+            blob_finish_get_buffer(&blob, &data, &size);
+            disk_cache_put_nocopy(disk_cache, cache_key, data, size, NULL);
          }
 
          blob_finish(&blob);
@@ -637,7 +743,7 @@ vk_pipeline_cache_create(struct vk_device *device,
    };
    memcpy(cache->header.uuid, pdevice_props.pipelineCacheUUID, VK_UUID_SIZE);
 
-   simple_mtx_init(&cache->lock, mtx_plain);
+   u_rwlock_init(&cache->lock);
 
    if (info->force_enable ||
        debug_get_bool_option("VK_ENABLE_PIPELINE_CACHE", true)) {
@@ -667,7 +773,7 @@ vk_pipeline_cache_destroy(struct vk_pipeline_cache *cache,
       }
       _mesa_set_destroy(cache->object_cache, NULL);
    }
-   simple_mtx_destroy(&cache->lock);
+   u_rwlock_destroy(&cache->lock);
    vk_object_free(cache->base.device, pAllocator, cache);
 }
 
@@ -732,7 +838,7 @@ vk_common_GetPipelineCacheData(VkDevice _device,
       return VK_INCOMPLETE;
    }
 
-   vk_pipeline_cache_lock(cache);
+   vk_pipeline_cache_rdlock(cache);
 
    VkResult result = VK_SUCCESS;
    if (cache->object_cache != NULL) {
@@ -778,7 +884,7 @@ vk_common_GetPipelineCacheData(VkDevice _device,
       }
    }
 
-   vk_pipeline_cache_unlock(cache);
+   vk_pipeline_cache_rdunlock(cache);
 
    blob_overwrite_uint32(&blob, count_offset, count);
 
@@ -803,7 +909,7 @@ vk_common_MergePipelineCaches(VkDevice _device,
    if (!dst->object_cache)
       return VK_SUCCESS;
 
-   vk_pipeline_cache_lock(dst);
+   vk_pipeline_cache_wrlock(dst);
 
    for (uint32_t i = 0; i < srcCacheCount; i++) {
       VK_FROM_HANDLE(vk_pipeline_cache, src, pSrcCaches[i]);
@@ -816,7 +922,7 @@ vk_common_MergePipelineCaches(VkDevice _device,
       if (src == dst)
          continue;
 
-      vk_pipeline_cache_lock(src);
+      vk_pipeline_cache_rdlock(src);
 
       set_foreach(src->object_cache, src_entry) {
          struct vk_pipeline_cache_object *src_object = (void *)src_entry->key;
@@ -843,10 +949,10 @@ vk_common_MergePipelineCaches(VkDevice _device,
          }
       }
 
-      vk_pipeline_cache_unlock(src);
+      vk_pipeline_cache_rdunlock(src);
    }
 
-   vk_pipeline_cache_unlock(dst);
+   vk_pipeline_cache_wrunlock(dst);
 
    return VK_SUCCESS;
 }
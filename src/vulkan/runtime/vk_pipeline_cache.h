@@ -26,7 +26,7 @@
 #include "vk_object.h"
 #include "vk_util.h"
 
-#include "util/simple_mtx.h"
+#include "util/rwlock.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -159,7 +159,7 @@ struct vk_pipeline_cache {
    struct vk_pipeline_cache_header header;
 
    /** Protects object_cache */
-   simple_mtx_t lock;
+   struct u_rwlock lock;
 
    struct set *object_cache;
 };
@@ -234,6 +234,23 @@ vk_pipeline_cache_lookup_object(struct vk_pipeline_cache *cache,
                                 const struct vk_pipeline_cache_object_ops *ops,
                                 bool *cache_hit);
 
+/** Looks up several objects of the same type at once
+ *
+ * This is equivalent to calling vk_pipeline_cache_lookup_object() for each
+ * of the \p count keys in \p key_data, except that all of the objects
+ * missing from the in-memory cache are fetched from the disk cache in a
+ * single parallel batch.
+ *
+ * On return, objects[i] holds a reference to the object for key_data[i] or
+ * NULL if it was not found.
+ */
+void
+vk_pipeline_cache_lookup_objects(struct vk_pipeline_cache *cache,
+                                 unsigned count,
+                                 const void *const *key_data, size_t key_size,
+                                 const struct vk_pipeline_cache_object_ops *ops,
+                                 struct vk_pipeline_cache_object **objects);
+
 /** Adds an object to the pipeline cache
  *
  * This function adds the given object to the pipeline cache.  We do not
@@ -1132,6 +1132,34 @@ vk_queue_finish(struct vk_queue *queue)
    vk_object_base_finish(&queue->base);
 }
 
+/* Returns how many of the given submits, starting with the first, can be
+ * folded into a single batch.  That's the case as long as none of them
+ * waits, only the last one signals and none of them chain anything that
+ * applies on a per-batch basis.  Execution order and semaphore semantics are
+ * unchanged; the driver just sees the command buffers in one go.
+ *
+ * Batches with waits are never merged: the waits would then also gate the
+ * later batches and their signals, which can deadlock with timeline
+ * wait-before-signal if the host only signals the waited value after one of
+ * those later signals.
+ */
+static uint32_t
+vk_queue_mergeable_submit2_count(const VkSubmitInfo2 *submits, uint32_t count)
+{
+   if (submits[0].pNext != NULL || submits[0].waitSemaphoreInfoCount != 0)
+      return 1;
+
+   uint32_t n = 1;
+   while (n < count &&
+          submits[n - 1].signalSemaphoreInfoCount == 0 &&
+          submits[n].waitSemaphoreInfoCount == 0 &&
+          submits[n].pNext == NULL &&
+          submits[n].flags == submits[0].flags)
+      n++;
+
+   return n;
+}
+
 VKAPI_ATTR VkResult VKAPI_CALL
 vk_common_QueueSubmit2KHR(VkQueue _queue,
                           uint32_t submitCount,
@@ -1152,18 +1180,42 @@ vk_common_QueueSubmit2KHR(VkQueue _queue,
       }
    }
 
-   for (uint32_t i = 0; i < submitCount; i++) {
+   for (uint32_t i = 0; i < submitCount;) {
+      const uint32_t merge_count =
+         vk_queue_mergeable_submit2_count(&pSubmits[i], submitCount - i);
+      const VkSubmitInfo2 *first = &pSubmits[i];
+      const VkSubmitInfo2 *last = &pSubmits[i + merge_count - 1];
+
+      uint32_t command_buffer_count = 0;
+      for (uint32_t j = 0; j < merge_count; j++)
+         command_buffer_count += first[j].commandBufferInfoCount;
+
+      STACK_ARRAY(VkCommandBufferSubmitInfo, command_buffers,
+                  merge_count > 1 ? command_buffer_count : 0);
+      if (merge_count > 1) {
+         uint32_t c = 0;
+         for (uint32_t j = 0; j < merge_count; j++) {
+            typed_memcpy(&command_buffers[c], first[j].pCommandBufferInfos,
+                         first[j].commandBufferInfoCount);
+            c += first[j].commandBufferInfoCount;
+         }
+      }
+
+      i += merge_count;
+
       struct vulkan_submit_info info = {
-         .pNext = pSubmits[i].pNext,
-         .command_buffer_count = pSubmits[i].commandBufferInfoCount,
-         .command_buffers = pSubmits[i].pCommandBufferInfos,
-         .wait_count = pSubmits[i].waitSemaphoreInfoCount,
-         .waits = pSubmits[i].pWaitSemaphoreInfos,
-         .signal_count = pSubmits[i].signalSemaphoreInfoCount,
-         .signals = pSubmits[i].pSignalSemaphoreInfos,
-         .fence = i == submitCount - 1 ? fence : NULL
+         .pNext = first->pNext,
+         .command_buffer_count = command_buffer_count,
+         .command_buffers = merge_count > 1 ? command_buffers :
+                                              first->pCommandBufferInfos,
+         .wait_count = first->waitSemaphoreInfoCount,
+         .waits = first->pWaitSemaphoreInfos,
+         .signal_count = last->signalSemaphoreInfoCount,
+         .signals = last->pSignalSemaphoreInfos,
+         .fence = i == submitCount ? fence : NULL
       };
       VkResult result = vk_queue_submit(queue, &info);
+      STACK_ARRAY_FINISH(command_buffers);
       if (unlikely(result != VK_SUCCESS))
          return result;
    }
@@ -75,6 +75,7 @@ vk_sync_timeline_init(struct vk_device *device,
       return vk_errorf(device, VK_ERROR_UNKNOWN, "cnd_init failed");
    }
 
+   timeline->num_waiters = 0;
    timeline->highest_past =
       timeline->highest_pending = initial_value;
    list_inithead(&timeline->pending_points);
@@ -304,7 +305,7 @@ vk_sync_timeline_point_install(struct vk_device *device,
    point->pending = true;
    list_addtail(&point->link, &timeline->pending_points);
 
-   int ret = cnd_broadcast(&timeline->cond);
+   int ret = timeline->num_waiters ? cnd_broadcast(&timeline->cond) : thrd_success;
 
    mtx_unlock(&timeline->mutex);
 
@@ -381,7 +382,7 @@ vk_sync_timeline_signal_locked(struct vk_device *device,
    assert(timeline->highest_pending == timeline->highest_past);
    timeline->highest_pending = timeline->highest_past = value;
 
-   int ret = cnd_broadcast(&timeline->cond);
+   int ret = timeline->num_waiters ? cnd_broadcast(&timeline->cond) : thrd_success;
    if (ret == thrd_error)
       return vk_errorf(device, VK_ERROR_UNKNOWN, "cnd_broadcast failed");
 
@@ -437,6 +438,7 @@ vk_sync_timeline_wait_locked(struct vk_device *device,
          return VK_TIMEOUT;
 
       int ret;
+      timeline->num_waiters++;
       if (abs_timeout_ns >= INT64_MAX) {
          /* Common infinite wait case */
          ret = cnd_wait(&timeline->cond, &timeline->mutex);
@@ -458,6 +460,7 @@ vk_sync_timeline_wait_locked(struct vk_device *device,
                                 &abs_timeout_ts);
          }
       }
+      timeline->num_waiters--;
       if (ret == thrd_error)
          return vk_errorf(device, VK_ERROR_UNKNOWN, "cnd_timedwait failed");
 
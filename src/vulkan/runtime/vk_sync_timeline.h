@@ -81,6 +81,11 @@ struct vk_sync_timeline {
    mtx_t mutex;
    cnd_t cond;
 
+   /* Number of threads blocked on cond, so signals can skip the broadcast
+    * when nobody is waiting.
+    */
+   uint32_t num_waiters;
+
    uint64_t highest_past;
    uint64_t highest_pending;
 
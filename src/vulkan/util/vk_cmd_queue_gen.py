@@ -78,10 +78,17 @@ extern "C" {
 #endif
 
 struct vk_device_dispatch_table;
+struct vk_cmd_queue_chunk;
 
 struct vk_cmd_queue {
    const VkAllocationCallbacks *alloc;
    struct list_head cmds;
+
+   /* Entries and all of their argument copies are sub-allocated from these
+    * chunks and only released as a whole by vk_cmd_queue_reset() and
+    * vk_cmd_queue_finish().
+    */
+   struct vk_cmd_queue_chunk *chunk;
 };
 
 enum vk_cmd_type {
@@ -118,6 +125,11 @@ struct ${to_struct_name(c.name)} {
 
 struct vk_cmd_queue_entry;
 
+/* driver_free_cb is only needed for things like dropping references; the
+ * entry itself, and anything the driver put into driver_data, must come from
+ * vk_cmd_queue_zalloc() and is freed along with the queue.
+ */
+
 /* this ordering must match vk_cmd_queue_entry */
 struct vk_cmd_queue_entry_base {
    struct list_head cmd_link;
@@ -168,6 +180,8 @@ struct vk_cmd_queue_entry {
 
 % endfor
 
+void *vk_cmd_queue_zalloc(struct vk_cmd_queue *queue, size_t size);
+
 void vk_free_queue(struct vk_cmd_queue *queue);
 
 static inline void
@@ -175,21 +189,12 @@ vk_cmd_queue_init(struct vk_cmd_queue *queue, VkAllocationCallbacks *alloc)
 {
    queue->alloc = alloc;
    list_inithead(&queue->cmds);
+   queue->chunk = NULL;
 }
 
-static inline void
-vk_cmd_queue_reset(struct vk_cmd_queue *queue)
-{
-   vk_free_queue(queue);
-   list_inithead(&queue->cmds);
-}
+void vk_cmd_queue_reset(struct vk_cmd_queue *queue);
 
-static inline void
-vk_cmd_queue_finish(struct vk_cmd_queue *queue)
-{
-   vk_free_queue(queue);
-   list_inithead(&queue->cmds);
-}
+void vk_cmd_queue_finish(struct vk_cmd_queue *queue);
 
 void vk_cmd_queue_execute(struct vk_cmd_queue *queue,
                           VkCommandBuffer commandBuffer,
@@ -248,25 +253,6 @@ size_t vk_cmd_queue_type_sizes[] = {
 % if c.guard is not None:
 #ifdef ${c.guard}
 % endif
-static void
-vk_free_${to_underscore(c.name)}(struct vk_cmd_queue *queue,
-${' ' * len('vk_free_' + to_underscore(c.name) + '(')}\\
-struct vk_cmd_queue_entry *cmd)
-{
-   if (cmd->driver_free_cb)
-      cmd->driver_free_cb(queue, cmd);
-   else
-      vk_free(queue->alloc, cmd->driver_data);
-% for p in c.params[1:]:
-% if p.len:
-   vk_free(queue->alloc, (${remove_suffix(p.decl.replace("const", ""), p.name)})cmd->u.${to_struct_field_name(c.name)}.${to_field_name(p.name)});
-% elif '*' in p.decl:
-   ${get_struct_free(c, p, types)}
-% endif
-% endfor
-   vk_free(queue->alloc, cmd);
-}
-
 % if c.name not in manual_commands and c.name not in no_enqueue_commands:
 VkResult vk_enqueue_${to_underscore(c.name)}(struct vk_cmd_queue *queue
 % for p in c.params[1:]:
@@ -274,8 +260,7 @@ VkResult vk_enqueue_${to_underscore(c.name)}(struct vk_cmd_queue *queue
 % endfor
 )
 {
-   struct vk_cmd_queue_entry *cmd = vk_zalloc(queue->alloc, vk_cmd_queue_type_sizes[${to_enum_name(c.name)}], 8,
-                                              VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+   struct vk_cmd_queue_entry *cmd = vk_cmd_queue_zalloc(queue, vk_cmd_queue_type_sizes[${to_enum_name(c.name)}]);
    if (!cmd) return VK_ERROR_OUT_OF_HOST_MEMORY;
 
    cmd->type = ${to_enum_name(c.name)};
@@ -305,8 +290,7 @@ VkResult vk_enqueue_${to_underscore(c.name)}(struct vk_cmd_queue *queue
 
 % if need_error_handling:
 err:
-   if (cmd)
-      vk_free_${to_underscore(c.name)}(queue, cmd);
+   /* anything already allocated is released with the rest of the queue */
    return VK_ERROR_OUT_OF_HOST_MEMORY;
 % endif
 }
@@ -317,27 +301,82 @@ err:
 
 % endfor
 
+struct vk_cmd_queue_chunk {
+   struct vk_cmd_queue_chunk *prev;
+   size_t size;
+   size_t offset;
+   uint64_t data[];
+};
+
+#define VK_CMD_QUEUE_MIN_CHUNK_SIZE (16 * 1024)
+#define VK_CMD_QUEUE_MAX_CHUNK_SIZE (1024 * 1024)
+
+void *
+vk_cmd_queue_zalloc(struct vk_cmd_queue *queue, size_t size)
+{
+   struct vk_cmd_queue_chunk *chunk = queue->chunk;
+
+   size = ALIGN_POT(size, 8);
+   if (!chunk || chunk->size - chunk->offset < size) {
+      size_t chunk_size = chunk ? MIN2(chunk->size * 2, VK_CMD_QUEUE_MAX_CHUNK_SIZE) :
+                                  VK_CMD_QUEUE_MIN_CHUNK_SIZE;
+      chunk_size = MAX2(chunk_size, size);
+
+      chunk = vk_alloc(queue->alloc, sizeof(*chunk) + chunk_size, 8,
+                       VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+      if (!chunk)
+         return NULL;
+
+      chunk->prev = queue->chunk;
+      chunk->size = chunk_size;
+      chunk->offset = 0;
+      queue->chunk = chunk;
+   }
+
+   void *ptr = (uint8_t *)chunk->data + chunk->offset;
+   chunk->offset += size;
+   memset(ptr, 0, size);
+   return ptr;
+}
+
 void
 vk_free_queue(struct vk_cmd_queue *queue)
 {
-   struct vk_cmd_queue_entry *tmp, *cmd;
-   LIST_FOR_EACH_ENTRY_SAFE(cmd, tmp, &queue->cmds, cmd_link) {
-      switch(cmd->type) {
-% for c in commands:
-% if c.guard is not None:
-#ifdef ${c.guard}
-% endif
-      case ${to_enum_name(c.name)}:
-         vk_free_${to_underscore(c.name)}(queue, cmd);
-         break;
-% if c.guard is not None:
-#endif // ${c.guard}
-% endif
-% endfor
+   list_for_each_entry(struct vk_cmd_queue_entry, cmd, &queue->cmds, cmd_link) {
+      if (cmd->driver_free_cb)
+         cmd->driver_free_cb(queue, cmd);
+   }
+   list_inithead(&queue->cmds);
+
+   /* keep the newest (and largest) chunk so re-recording doesn't have to
+    * allocate again
+    */
+   if (queue->chunk) {
+      struct vk_cmd_queue_chunk *chunk = queue->chunk->prev;
+      while (chunk) {
+         struct vk_cmd_queue_chunk *prev = chunk->prev;
+         vk_free(queue->alloc, chunk);
+         chunk = prev;
       }
+      queue->chunk->prev = NULL;
+      queue->chunk->offset = 0;
    }
 }
 
+void
+vk_cmd_queue_reset(struct vk_cmd_queue *queue)
+{
+   vk_free_queue(queue);
+}
+
+void
+vk_cmd_queue_finish(struct vk_cmd_queue *queue)
+{
+   vk_free_queue(queue);
+   vk_free(queue->alloc, queue->chunk);
+   queue->chunk = NULL;
+}
+
 void
 vk_cmd_queue_execute(struct vk_cmd_queue *queue,
                      VkCommandBuffer commandBuffer,
@@ -459,7 +498,7 @@ def get_array_copy(command, param):
         field_size = "1"
     else:
         field_size = "sizeof(*%s)" % field_name
-    allocation = "%s = vk_zalloc(queue->alloc, %s * (%s), 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);\n   if (%s == NULL) goto err;\n" % (field_name, field_size, param.len, field_name)
+    allocation = "%s = vk_cmd_queue_zalloc(queue, %s * (%s));\n   if (%s == NULL) goto err;\n" % (field_name, field_size, param.len, field_name)
     const_cast = remove_suffix(param.decl.replace("const", ""), param.name)
     copy = "memcpy((%s)%s, %s, %s * (%s));" % (const_cast, field_name, param.name, field_size, param.len)
     return "%s\n   %s" % (allocation, copy)
@@ -470,7 +509,7 @@ def get_array_member_copy(struct, src_name, member):
         field_size = "sizeof(*%s)" % (field_name)
     else:
         field_size = "sizeof(*%s) * %s->%s" % (field_name, struct, member.len)
-    allocation = "%s = vk_zalloc(queue->alloc, %s, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);\n   if (%s == NULL) goto err;\n" % (field_name, field_size, field_name)
+    allocation = "%s = vk_cmd_queue_zalloc(queue, %s);\n   if (%s == NULL) goto err;\n" % (field_name, field_size, field_name)
     const_cast = remove_suffix(member.decl.replace("const", ""), member.name)
     copy = "memcpy((%s)%s, %s->%s, %s);" % (const_cast, field_name, src_name, member.name, field_size)
     return "if (%s->%s) {\n   %s\n   %s\n}\n" % (src_name, member.name, allocation, copy)
@@ -507,7 +546,7 @@ def get_struct_copy(dst, src_name, src_type, size, types, level=0):
     global tmp_dst_idx
     global tmp_src_idx
 
-    allocation = "%s = vk_zalloc(queue->alloc, %s, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);\n      if (%s == NULL) goto err;\n" % (dst, size, dst)
+    allocation = "%s = vk_cmd_queue_zalloc(queue, %s);\n      if (%s == NULL) goto err;\n" % (dst, size, dst)
     copy = "memcpy((void*)%s, %s, %s);" % (dst, src_name, size)
 
     level += 1
@@ -526,19 +565,6 @@ def get_struct_copy(dst, src_name, src_type, size, types, level=0):
     if_stmt = "if (%s) {" % src_name
     return "%s\n      %s\n      %s\n   %s\n   %s   \n   %s   } else {\n      %s\n   }" % (if_stmt, allocation, copy, tmp_dst, tmp_src, member_copies, null_assignment)
 
-def get_struct_free(command, param, types):
-    field_name = "cmd->u.%s.%s" % (to_struct_field_name(command.name), to_field_name(param.name))
-    const_cast = remove_suffix(param.decl.replace("const", ""), param.name)
-    struct_free = "vk_free(queue->alloc, (%s)%s);" % (const_cast, field_name)
-    member_frees = ""
-    if (param.type in types):
-        for member in types[param.type].members:
-            if member.len and member.len != 'null-terminated':
-                member_name = "cmd->u.%s.%s->%s" % (to_struct_field_name(command.name), to_field_name(param.name), member.name)
-                const_cast = remove_suffix(member.decl.replace("const", ""), member.name)
-                member_frees += "vk_free(queue->alloc, (%s)%s);\n" % (const_cast, member_name)
-    return "%s      %s\n" % (member_frees, struct_free)
-
 EntrypointType = namedtuple('EntrypointType', 'name enum members extended_by guard')
 
 def get_types_defines(doc):
@@ -654,7 +680,6 @@ def main():
         'to_struct_name': to_struct_name,
         'get_array_copy': get_array_copy,
         'get_struct_copy': get_struct_copy,
-        'get_struct_free': get_struct_free,
         'types': types,
         'manual_commands': MANUAL_COMMANDS,
         'no_enqueue_commands': NO_ENQUEUE_COMMANDS,
@@ -1886,6 +1886,13 @@ presentation_handle_presented(void *data,
 {
    struct wsi_wl_present_id *id = data;
 
+   /* Feedback is only requested for VK_KHR_present_wait, which only cares
+    * that the present completed.  The timestamp, refresh and sequence are
+    * what VK_GOOGLE_display_timing would report, but they are only sent for
+    * presents that carry a present id, so they can't drive frame pacing for
+    * the rest.
+    */
+
    /* present_ids.lock already held around dispatch */
    if (id->present_id > id->chain->present_ids.max_completed)
       id->chain->present_ids.max_completed = id->present_id;
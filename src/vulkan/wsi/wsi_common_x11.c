@@ -1049,6 +1049,7 @@ struct x11_swapchain {
    bool                                         has_dri3_modifiers;
    bool                                         has_mit_shm;
    bool                                         has_async_may_tear;
+   bool                                         is_xwayland;
 
    xcb_connection_t *                           conn;
    xcb_window_t                                 window;
@@ -1594,14 +1595,9 @@ x11_present_to_x11_dri3(struct x11_swapchain *chain, uint32_t image_index,
    int64_t divisor = 0;
    int64_t remainder = 0;
 
-   struct wsi_x11_connection *wsi_conn =
-      wsi_x11_get_connection((struct wsi_device*)chain->base.wsi, chain->conn);
-   if (!wsi_conn)
-      return VK_ERROR_OUT_OF_HOST_MEMORY;
-
    if (chain->base.present_mode == VK_PRESENT_MODE_IMMEDIATE_KHR ||
        (chain->base.present_mode == VK_PRESENT_MODE_MAILBOX_KHR &&
-        wsi_conn->is_xwayland) ||
+        chain->is_xwayland) ||
        chain->base.present_mode == VK_PRESENT_MODE_FIFO_RELAXED_KHR)
       options |= XCB_PRESENT_OPTION_ASYNC;
 
@@ -2735,6 +2731,7 @@ x11_surface_create_swapchain(VkIcdSurfaceBase *icd_surface,
    chain->status = VK_SUCCESS;
    chain->has_dri3_modifiers = wsi_conn->has_dri3_modifiers;
    chain->has_mit_shm = wsi_conn->has_mit_shm;
+   chain->is_xwayland = wsi_conn->is_xwayland;
 
    xcb_present_query_capabilities_cookie_t present_query_cookie;
    xcb_present_query_capabilities_reply_t *present_query_reply;